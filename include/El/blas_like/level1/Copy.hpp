@@ -11,7 +11,9 @@
 
 #include <El/blas_like/level1/Copy/internal_decl.hpp>
 #include <El/blas_like/level1/Copy/GeneralPurpose.hpp>
+#include <El/blas_like/level1/Copy/RedistributionPlan.hpp>
 #include <El/blas_like/level1/Copy/util.hpp>
+#include <El/blas_like/level1/Copy/NonblockingAllGather.hpp>
 
 namespace El {
 
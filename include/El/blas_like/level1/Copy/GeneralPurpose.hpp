@@ -92,7 +92,8 @@ void Helper
     // ====================
     const Int totalSend = remoteEntries.size();
     mpi::Comm comm;
-    vector<int> sendCounts, owners(totalSend);
+    vector<Int> sendCounts;
+    vector<int> owners(totalSend);
     if( includeViewers )
     {
         comm = g.ViewingComm();
@@ -142,7 +143,7 @@ void Helper
 
     // Pack the data
     // =============
-    vector<int> sendOffs;
+    vector<Int> sendOffs;
     Scan( sendCounts, sendOffs );
     vector<Entry<S>> sendBuf;
     FastResize( sendBuf, totalSend );
@@ -0,0 +1,189 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_COPY_NONBLOCKINGALLGATHER_HPP
+#define EL_BLAS_COPY_NONBLOCKINGALLGATHER_HPP
+
+namespace El {
+namespace copy {
+
+// Non-blocking analogues of RowAllGather, PartialColAllGather, and
+// PartialRowAllGather: the Start routine packs A and posts the AllGather, and
+// the matching Finish routine waits on it and unpacks the result into B, so
+// that the communication can be overlapped with local computation. A must not
+// be modified in between, and B must be aligned with A.
+template<typename T>
+struct PendingAllGather
+{
+    Int portionSize=0;
+    vector<T> buffer;
+    mpi::Request<T> request;
+};
+
+namespace util {
+
+template<typename T>
+void PostAllGather
+( const ElementalMatrix<T>& A,
+  Int portionSize, mpi::Comm comm, Int commSize,
+  PendingAllGather<T>& pending )
+{
+    EL_DEBUG_CSE
+    pending.portionSize = portionSize;
+    FastResize( pending.buffer, (commSize+1)*portionSize );
+    T* sendBuf = &pending.buffer[0];
+    T* recvBuf = &pending.buffer[portionSize];
+    InterleaveMatrix
+    ( A.LocalHeight(), A.LocalWidth(),
+      A.LockedBuffer(), 1, A.LDim(),
+      sendBuf,          1, A.LocalHeight() );
+    mpi::IAllGather
+    ( sendBuf, portionSize, recvBuf, portionSize, comm, pending.request );
+}
+
+} // namespace util
+
+// (U,V) |-> (U,Collect(V))
+template<typename T>
+void StartRowAllGather
+( const ElementalMatrix<T>& A, PendingAllGather<T>& pending )
+{
+    EL_DEBUG_CSE
+    if( !A.Participating() )
+        return;
+    const Int rowStride = A.RowStride();
+    const Int portionSize =
+      mpi::Pad( A.LocalHeight()*MaxLength(A.Width(),rowStride) );
+    util::PostAllGather( A, portionSize, A.RowComm(), rowStride, pending );
+}
+
+template<typename T>
+void FinishRowAllGather
+( const ElementalMatrix<T>& A,
+  PendingAllGather<T>& pending,
+  ElementalMatrix<T>& B )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.ColDist() != B.ColDist() ||
+          Collect(A.RowDist()) != B.RowDist() )
+          LogicError("Incompatible distributions");
+    )
+    AssertSameGrids( A, B );
+    B.AlignColsAndResize( A.ColAlign(), A.Height(), A.Width(), false, false );
+    if( B.ColAlign() != A.ColAlign() )
+        LogicError("Unaligned non-blocking RowAllGather");
+    if( !A.Participating() )
+        return;
+    mpi::Wait( pending.request );
+    util::RowStridedUnpack
+    ( A.LocalHeight(), A.Width(), A.RowAlign(), A.RowStride(),
+      &pending.buffer[pending.portionSize], pending.portionSize,
+      B.Buffer(), B.LDim() );
+}
+
+// (U,V) |-> (Partial(U),V)
+template<typename T>
+void StartPartialColAllGather
+( const ElementalMatrix<T>& A, PendingAllGather<T>& pending )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.LocalWidth() != A.Width() )
+          LogicError("This routine assumes rows are not distributed");
+    )
+    if( !A.Participating() )
+        return;
+    const Int portionSize =
+      mpi::Pad( MaxLength(A.Height(),A.ColStride())*A.Width() );
+    util::PostAllGather
+    ( A, portionSize, A.PartialUnionColComm(), A.PartialUnionColStride(),
+      pending );
+}
+
+template<typename T>
+void FinishPartialColAllGather
+( const ElementalMatrix<T>& A,
+  PendingAllGather<T>& pending,
+  ElementalMatrix<T>& B )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( B.ColDist() != Partial(A.ColDist()) ||
+          B.RowDist() != A.RowDist() )
+          LogicError("Incompatible distributions");
+    )
+    AssertSameGrids( A, B );
+    B.AlignColsAndResize
+    ( Mod(A.ColAlign(),B.ColStride()), A.Height(), A.Width(), false, false );
+    if( B.ColAlign() != Mod(A.ColAlign(),B.ColStride()) )
+        LogicError("Unaligned non-blocking PartialColAllGather");
+    if( !A.Participating() )
+        return;
+    mpi::Wait( pending.request );
+    util::PartialColStridedUnpack
+    ( A.Height(), A.Width(),
+      A.ColAlign(), A.ColStride(),
+      A.PartialUnionColStride(), A.PartialColStride(), A.PartialColRank(),
+      B.ColShift(),
+      &pending.buffer[pending.portionSize], pending.portionSize,
+      B.Buffer(), B.LDim() );
+}
+
+// (U,V) |-> (U,Partial(V))
+template<typename T>
+void StartPartialRowAllGather
+( const ElementalMatrix<T>& A, PendingAllGather<T>& pending )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.LocalHeight() != A.Height() )
+          LogicError("This routine assumes columns are not distributed");
+    )
+    if( !A.Participating() )
+        return;
+    const Int portionSize =
+      mpi::Pad( A.Height()*MaxLength(A.Width(),A.RowStride()) );
+    util::PostAllGather
+    ( A, portionSize, A.PartialUnionRowComm(), A.PartialUnionRowStride(),
+      pending );
+}
+
+template<typename T>
+void FinishPartialRowAllGather
+( const ElementalMatrix<T>& A,
+  PendingAllGather<T>& pending,
+  ElementalMatrix<T>& B )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( B.ColDist() != A.ColDist() ||
+          B.RowDist() != Partial(A.RowDist()) )
+          LogicError("Incompatible distributions");
+    )
+    AssertSameGrids( A, B );
+    B.AlignRowsAndResize
+    ( Mod(A.RowAlign(),B.RowStride()), A.Height(), A.Width(), false, false );
+    if( B.RowAlign() != Mod(A.RowAlign(),B.RowStride()) )
+        LogicError("Unaligned non-blocking PartialRowAllGather");
+    if( !A.Participating() )
+        return;
+    mpi::Wait( pending.request );
+    util::PartialRowStridedUnpack
+    ( A.Height(), A.Width(),
+      A.RowAlign(), A.RowStride(),
+      A.PartialUnionRowStride(), A.PartialRowStride(), A.PartialRowRank(),
+      B.RowShift(),
+      &pending.buffer[pending.portionSize], pending.portionSize,
+      B.Buffer(), B.LDim() );
+}
+
+} // namespace copy
+} // namespace El
+
+#endif // ifndef EL_BLAS_COPY_NONBLOCKINGALLGATHER_HPP
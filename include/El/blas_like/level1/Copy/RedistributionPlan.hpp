@@ -0,0 +1,276 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_COPY_REDISTRIBUTIONPLAN_HPP
+#define EL_BLAS_COPY_REDISTRIBUTIONPLAN_HPP
+
+namespace El {
+
+// A reusable plan for copying between a fixed pair of distributed matrix
+// layouts. Whereas copy::GeneralPurpose transmits an (i,j,value) triplet for
+// each entry and recomputes the owners on every call, building a plan
+// exchanges the local indices once so that each subsequent Execute only
+// needs to pack, AllToAll, and unpack the values themselves.
+class RedistributionPlan
+{
+public:
+    RedistributionPlan() { }
+
+    // NOTE: B is resized to match A
+    template<typename S,typename T>
+    RedistributionPlan
+    ( const AbstractDistMatrix<S>& A, AbstractDistMatrix<T>& B )
+    { Build( A, B ); }
+
+    template<typename S,typename T>
+    void Build( const AbstractDistMatrix<S>& A, AbstractDistMatrix<T>& B );
+
+    // Whether the plan was built for the current layouts of A and B
+    template<typename S,typename T>
+    bool Matches
+    ( const AbstractDistMatrix<S>& A,
+      const AbstractDistMatrix<T>& B ) const;
+
+    template<typename S,typename T>
+    void Execute
+    ( const AbstractDistMatrix<S>& A, AbstractDistMatrix<T>& B ) const;
+
+    Int NumSendEntries() const EL_NO_EXCEPT { return sendPerm_.size(); }
+    Int NumRecvEntries() const EL_NO_EXCEPT { return recvRows_.size(); }
+    // The number of times the plan has been (re)built
+    Int NumBuilds() const EL_NO_EXCEPT { return numBuilds_; }
+
+private:
+    bool built_=false;
+    Int numBuilds_=0;
+    Int height_=0, width_=0;
+    DistData distA_, distB_;
+
+    // Whether or not this process takes part in the exchange and, if so,
+    // over which communicator
+    bool active_=false;
+    mpi::Comm comm_;
+
+    vector<Int> sendCounts_, sendOffs_, recvCounts_, recvOffs_;
+    // The send buffer position of each local entry of A (in column-major
+    // order); empty if this process does not send its entries
+    vector<Int> sendPerm_;
+    // The local position in B of each entry of the receive buffer
+    vector<Int> recvRows_, recvCols_;
+};
+
+template<typename S,typename T>
+bool RedistributionPlan::Matches
+( const AbstractDistMatrix<S>& A,
+  const AbstractDistMatrix<T>& B ) const
+{
+    return built_ &&
+           A.Height() == height_ && A.Width() == width_ &&
+           B.Height() == height_ && B.Width() == width_ &&
+           DistData(A) == distA_ && DistData(B) == distB_;
+}
+
+template<typename S,typename T>
+void RedistributionPlan::Build
+( const AbstractDistMatrix<S>& A, AbstractDistMatrix<T>& B )
+{
+    EL_DEBUG_CSE
+    height_ = A.Height();
+    width_ = A.Width();
+    B.Resize( height_, width_ );
+    distA_ = DistData(A);
+    distB_ = DistData(B);
+    built_ = true;
+    ++numBuilds_;
+
+    const Grid& g = B.Grid();
+    const bool includeViewers = (A.Grid() != B.Grid());
+    active_ = includeViewers || g.InGrid();
+    SwapClear( sendPerm_ );
+    SwapClear( recvRows_ );
+    SwapClear( recvCols_ );
+    if( !active_ )
+        return;
+
+    // Determine the communicator and the map from B's distribution ranks
+    // into it. As in copy::GeneralPurpose, we only send to redundant rank
+    // zero of B and broadcast afterwards.
+    const int redundantRootB = 0;
+    const int BRoot = B.Root();
+    const int distBSize = mpi::Size( B.DistComm() );
+    vector<int> distBToComm(distBSize);
+    for( int distBRank=0; distBRank<distBSize; ++distBRank )
+    {
+        const int vcOwner =
+          g.CoordsToVC
+          (B.ColDist(),B.RowDist(),distBRank,BRoot,redundantRootB);
+        distBToComm[distBRank] =
+          ( includeViewers ? g.VCToViewing(vcOwner) : vcOwner );
+    }
+    comm_ = ( includeViewers ? g.ViewingComm() : g.VCComm() );
+    const int commSize = mpi::Size( comm_ );
+
+    // Count and record the destination of each of our local entries
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    const bool sending = ( A.Participating() && A.RedundantRank() == 0 );
+    sendCounts_.assign( commSize, 0 );
+    vector<int> owners;
+    vector<Int> localRows, localCols;
+    if( sending )
+    {
+        const int colStride = B.ColStride();
+        vector<int> ownerRows(localHeight);
+        vector<Int> localRowsB(localHeight);
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Int i = A.GlobalRow(iLoc);
+            ownerRows[iLoc] = B.RowOwner(i);
+            localRowsB[iLoc] = B.LocalRow(i,ownerRows[iLoc]);
+        }
+
+        FastResize( owners, localHeight*localWidth );
+        FastResize( localRows, localHeight*localWidth );
+        FastResize( localCols, localHeight*localWidth );
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            const Int j = A.GlobalCol(jLoc);
+            const int ownerCol = B.ColOwner(j);
+            const Int localCol = B.LocalCol(j,ownerCol);
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            {
+                const Int k = iLoc + jLoc*localHeight;
+                owners[k] = distBToComm[ownerRows[iLoc]+colStride*ownerCol];
+                localRows[k] = localRowsB[iLoc];
+                localCols[k] = localCol;
+                ++sendCounts_[owners[k]];
+            }
+        }
+    }
+    const Int totalSend = Scan( sendCounts_, sendOffs_ );
+
+    // Form the pack permutation and the (one-time) index payload
+    // NOTE: The plan's own index vectors are sized (rather than merely
+    //       reserved by FastResize) since Execute relies on their lengths
+    sendPerm_.resize( totalSend );
+    vector<Int> sendIndices;
+    FastResize( sendIndices, 2*totalSend );
+    auto offs = sendOffs_;
+    for( Int k=0; k<totalSend; ++k )
+    {
+        const Int slot = offs[owners[k]]++;
+        sendPerm_[k] = slot;
+        sendIndices[2*slot  ] = localRows[k];
+        sendIndices[2*slot+1] = localCols[k];
+    }
+    SwapClear( owners );
+    SwapClear( localRows );
+    SwapClear( localCols );
+
+    recvCounts_.resize( commSize );
+    mpi::AllToAll( sendCounts_.data(), 1, recvCounts_.data(), 1, comm_ );
+    const Int totalRecv = Scan( recvCounts_, recvOffs_ );
+
+    vector<Int> sendIndexCounts(commSize), sendIndexOffs(commSize),
+                recvIndexCounts(commSize), recvIndexOffs(commSize);
+    for( int q=0; q<commSize; ++q )
+    {
+        sendIndexCounts[q] = 2*sendCounts_[q];
+        sendIndexOffs[q] = 2*sendOffs_[q];
+        recvIndexCounts[q] = 2*recvCounts_[q];
+        recvIndexOffs[q] = 2*recvOffs_[q];
+    }
+    vector<Int> recvIndices;
+    FastResize( recvIndices, 2*totalRecv );
+    mpi::AllToAll
+    ( sendIndices.data(), sendIndexCounts.data(), sendIndexOffs.data(),
+      recvIndices.data(), recvIndexCounts.data(), recvIndexOffs.data(),
+      comm_ );
+
+    recvRows_.resize( totalRecv );
+    recvCols_.resize( totalRecv );
+    for( Int k=0; k<totalRecv; ++k )
+    {
+        recvRows_[k] = recvIndices[2*k  ];
+        recvCols_[k] = recvIndices[2*k+1];
+    }
+}
+
+template<typename S,typename T>
+void RedistributionPlan::Execute
+( const AbstractDistMatrix<S>& A, AbstractDistMatrix<T>& B ) const
+{
+    EL_DEBUG_CSE
+    if( !Matches( A, B ) )
+        LogicError("Redistribution plan does not match the given matrices");
+    if( !active_ )
+        return;
+
+    // Pack the values in the precomputed order
+    const Int totalSend = sendPerm_.size();
+    vector<S> sendBuf;
+    FastResize( sendBuf, totalSend );
+    if( totalSend > 0 )
+    {
+        const Int localHeight = A.LocalHeight();
+        const Int localWidth = A.LocalWidth();
+        const S* ABuf = A.LockedBuffer();
+        const Int ALDim = A.LDim();
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            const Int* perm = &sendPerm_[jLoc*localHeight];
+            const S* ACol = &ABuf[jLoc*ALDim];
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                sendBuf[perm[iLoc]] = ACol[iLoc];
+        }
+    }
+
+    // Exchange only the values
+    const Int totalRecv = recvRows_.size();
+    vector<S> recvBuf;
+    FastResize( recvBuf, totalRecv );
+    mpi::AllToAll
+    ( sendBuf.data(), sendCounts_.data(), sendOffs_.data(),
+      recvBuf.data(), recvCounts_.data(), recvOffs_.data(), comm_ );
+    SwapClear( sendBuf );
+
+    // Unpack into redundant rank zero of B and then broadcast
+    if( B.Participating() )
+    {
+        if( B.RedundantRank() == 0 )
+        {
+            T* BBuf = B.Buffer();
+            const Int BLDim = B.LDim();
+            for( Int k=0; k<totalRecv; ++k )
+                BBuf[recvRows_[k]+recvCols_[k]*BLDim] =
+                  Caster<S,T>::Cast(recvBuf[k]);
+        }
+        El::Broadcast( B, B.RedundantComm(), 0 );
+    }
+}
+
+namespace copy {
+
+// Redistribute using (and, if necessary, rebuilding) a cached plan
+template<typename S,typename T,typename=EnableIf<CanCast<S,T>>>
+void GeneralPurpose
+( const AbstractDistMatrix<S>& A,
+        AbstractDistMatrix<T>& B,
+        RedistributionPlan& plan )
+{
+    EL_DEBUG_CSE
+    B.Resize( A.Height(), A.Width() );
+    if( !plan.Matches( A, B ) )
+        plan.Build( A, B );
+    plan.Execute( A, B );
+}
+
+} // namespace copy
+} // namespace El
+
+#endif // ifndef EL_BLAS_COPY_REDISTRIBUTIONPLAN_HPP
@@ -26,11 +26,68 @@ enum GemmAlgorithm {
   GEMM_SUMMA_B,
   GEMM_SUMMA_C,
   GEMM_SUMMA_DOT,
-  GEMM_CANNON
+  GEMM_CANNON,
+  GEMM_SUMMA_PIPELINED,
+  GEMM_25D
 };
 }
 using namespace GemmAlgorithmNS;
 
+// The number of layers used by GEMM_25D. If zero (the default), it is chosen
+// automatically from the matrix sizes and the per-process memory limit.
+void SetGemm25DLayers( Int numLayers );
+Int Gemm25DLayers();
+
+// The number of bytes each process may devote to the layered copies used by
+// GEMM_25D. If zero (the default), the free physical memory of each node is
+// divided evenly among the processes sharing it.
+void SetGemm25DMemoryLimit( double numBytes );
+double Gemm25DMemoryLimit();
+
+// The tuned blocksize of a distributed kernel for a given datatype and
+// process grid shape (or Blocksize() if none has been tuned)
+template<typename T>
+Int TunedBlocksize( const string& kernel, const Grid& grid )
+{
+    if( !HaveTunedParameters() )
+        return Blocksize();
+    return TunedBlocksize( kernel, TypeName<T>(), grid.Height(), grid.Width() );
+}
+
+// The parameters of the heuristic used by GEMM_DEFAULT (and by Herk/Syrk):
+// the dot-product variant, with blocksize 'dotBlocksize', is used when the
+// inner dimension is at least 'weightAwayFromDot' times both of the outer
+// dimensions, and otherwise the smaller of A and B is kept stationary if the
+// inner dimension is at least 'weightTowardsC' times its outer dimension.
+struct GemmHeuristics
+{
+    double weightTowardsC=2.;
+    double weightAwayFromDot=10.;
+    Int dotBlocksize=2000;
+};
+
+template<typename T>
+GemmHeuristics TunedGemmHeuristics( const Grid& grid )
+{
+    GemmHeuristics heuristics;
+    if( HaveTunedParameters() )
+    {
+        const string typeName = TypeName<T>();
+        const Int height = grid.Height();
+        const Int width = grid.Width();
+        heuristics.weightTowardsC = TunedParameter
+          ( "Gemm", "weightTowardsC", typeName, height, width,
+            heuristics.weightTowardsC );
+        heuristics.weightAwayFromDot = TunedParameter
+          ( "Gemm", "weightAwayFromDot", typeName, height, width,
+            heuristics.weightAwayFromDot );
+        heuristics.dotBlocksize = Int(TunedParameter
+          ( "Gemm", "dotBlocksize", typeName, height, width,
+            double(heuristics.dotBlocksize) ));
+    }
+    return heuristics;
+}
+
 template<typename T>
 void Gemm
 ( Orientation orientA, Orientation orientB,
@@ -66,6 +123,27 @@ void LocalGemm
            const AbstractDistMatrix<T>& B,
                  AbstractDistMatrix<T>& C );
 
+// Batched Gemm
+// ------------
+// C[b] := alpha op(A[b]) op(B[b]) + beta C[b] for each of a batch of
+// independent (typically small) problems. Problems of equal size are
+// processed in interleaved groups so that the arithmetic vectorizes across
+// the batch, and the groups are distributed over OpenMP threads.
+template<typename T>
+void BatchedGemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const vector<Matrix<T>>& A, const vector<Matrix<T>>& B,
+  T beta,        vector<Matrix<T>>& C );
+
+// The same as above, but with the batchSize problems of each operand stored
+// side by side in the columns of a single matrix
+template<typename T>
+void BatchedGemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const Matrix<T>& A, const Matrix<T>& B,
+  T beta,        Matrix<T>& C,
+  Int batchSize );
+
 // Hemm
 // ====
 template<typename T>
@@ -182,6 +260,62 @@ void Multiply
   T beta,
         AbstractDistMatrix<T>& Y );
 
+// A sliced ELLPACK (SELL-C-sigma) copy of a sparse matrix which can be formed
+// once and then reused for repeated products. The rows are sorted by
+// decreasing length within windows of 'sigma' rows, and each chunk of
+// 'chunkSize' consecutive sorted rows is padded with explicit zeros to the
+// length of its longest row and stored column-major, so that the rows of a
+// chunk can be processed in lockstep with unit-stride (vectorizable) loops.
+template<typename T>
+struct SellCSigmaMatrix
+{
+    Int height=0, width=0;
+    Int chunkSize=8, sigma=128;
+
+    // The original row index of each of the sorted rows
+    vector<Int> rowPerm;
+    // The offset of the first entry of each chunk, followed by the total
+    vector<Int> chunkOffsets;
+    vector<Int> colIndices;
+    vector<T> values;
+};
+
+// The local rows of a DistSparseMatrix split into the entries which reference
+// locally-owned columns (the interior) and the remaining (boundary) entries,
+// each stored in SELL-C-sigma format with column indices into the ghost
+// buffer described by the multiplication metadata of the DistSparseMatrix.
+// NOTE: The copy must be reformed if the sparse matrix is modified.
+template<typename T>
+struct DistSellCSigmaMatrix
+{
+    SellCSigmaMatrix<T> interior, boundary;
+};
+
+// NOTE: The chunk size must be at most 32
+template<typename T>
+void SparseToSell
+( const SparseMatrix<T>& A, SellCSigmaMatrix<T>& ASell,
+  Int chunkSize=8, Int sigma=128 );
+template<typename T>
+void SparseToSell
+( const DistSparseMatrix<T>& A, DistSellCSigmaMatrix<T>& ASell,
+  Int chunkSize=8, Int sigma=128 );
+
+template<typename T>
+void Multiply
+( Orientation orientation,
+  T alpha, const SellCSigmaMatrix<T>& A, const Matrix<T>& X,
+  T beta,                                      Matrix<T>& Y );
+template<typename T>
+void Multiply
+( Orientation orientation,
+  T alpha,
+  const DistSparseMatrix<T>& A,
+  const DistSellCSigmaMatrix<T>& ASell,
+  const DistMultiVec<T>& X,
+  T beta,
+        DistMultiVec<T>& Y );
+
 // MultiShiftQuasiTrsm
 // ===================
 template<typename F>
@@ -253,6 +253,7 @@ template<typename T> struct IsStdField<Complex<T>>
 #include <El/core/imports/choice.hpp>
 #include <El/core/imports/mpi_choice.hpp>
 #include <El/core/environment/decl.hpp>
+#include <El/core/imports/mpi_large_count.hpp>
 
 #include <El/core/Timer.hpp>
 #include <El/core/indexing/decl.hpp>
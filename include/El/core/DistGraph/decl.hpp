@@ -28,9 +28,18 @@ struct DistGraphMultMeta
     bool ready;
     // NOTE: The 'send' and 'recv' roles reverse for adjoint multiplication
     Int numRecvInds;
-    vector<int> sendSizes, sendOffs,
+    vector<Int> sendSizes, sendOffs,
                 recvSizes, recvOffs;
     vector<Int> sendInds, colOffs;
+    // The processes with nonzero send and receive sizes, so that each
+    // exchange only needs to contact the (typically few) neighbors rather
+    // than every process in the communicator
+    vector<int> sendNeighbors, recvNeighbors;
+    // The entries of each local row which reference locally-owned columns
+    // ("interior" entries) are [interiorBeg[iLoc],interiorEnd[iLoc]), which
+    // allows their contribution to be formed while the ghost values are
+    // exchanged. Only the rows in 'boundaryRows' have any other entries.
+    vector<Int> interiorBeg, interiorEnd, boundaryRows;
 
     DistGraphMultMeta() : ready(false), numRecvInds(0) { }
 
@@ -44,6 +53,11 @@ struct DistGraphMultMeta
         SwapClear( recvOffs );
         SwapClear( sendInds );
         SwapClear( colOffs );
+        SwapClear( sendNeighbors );
+        SwapClear( recvNeighbors );
+        SwapClear( interiorBeg );
+        SwapClear( interiorEnd );
+        SwapClear( boundaryRows );
     }
 
     const DistGraphMultMeta& operator=( const DistGraphMultMeta& meta )
@@ -56,6 +70,11 @@ struct DistGraphMultMeta
         recvOffs = meta.recvOffs;
         sendInds = meta.sendInds;
         colOffs = meta.colOffs;
+        sendNeighbors = meta.sendNeighbors;
+        recvNeighbors = meta.recvNeighbors;
+        interiorBeg = meta.interiorBeg;
+        interiorEnd = meta.interiorEnd;
+        boundaryRows = meta.boundaryRows;
         return *this;
     }
 };
@@ -382,13 +382,13 @@ void DistMultiVec<Ring>::ProcessQueues()
     EL_DEBUG_CSE
     // Compute the send counts
     // -----------------------
-    vector<int> sendCounts(grid_->Size());
+    vector<Int> sendCounts(grid_->Size());
     for( const auto& entry : remoteUpdates_ )
         ++sendCounts[Owner(entry.i,entry.j)];
     // Pack the send data
     // ------------------
-    vector<int> sendOffs;
-    const int totalSend = Scan( sendCounts, sendOffs );
+    vector<Int> sendOffs;
+    const Int totalSend = Scan( sendCounts, sendOffs );
     auto offs = sendOffs;
     vector<Entry<Ring>> sendEntries(totalSend);
     for( const auto& entry : remoteUpdates_ )
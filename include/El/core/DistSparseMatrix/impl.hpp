@@ -259,14 +259,14 @@ void DistSparseMatrix<Ring>::ProcessQueues()
     {
         // Compute the send counts
         // -----------------------
-        vector<int> sendCounts(commSize,0);
+        vector<Int> sendCounts(commSize,0);
         for( auto s : distGraph_.remoteSources_ )
             ++sendCounts[RowOwner(s)];
 
         // Pack the send data
         // ------------------
-        vector<int> sendOffs;
-        const int totalSend = Scan( sendCounts, sendOffs );
+        vector<Int> sendOffs;
+        const Int totalSend = Scan( sendCounts, sendOffs );
         auto offs = sendOffs;
         vector<Entry<Ring>> sendBuf(totalSend);
         for( Int i=0; i<totalSend; ++i )
@@ -294,14 +294,14 @@ void DistSparseMatrix<Ring>::ProcessQueues()
     {
         // Compute the send counts
         // -----------------------
-        vector<int> sendCounts(commSize,0);
+        vector<Int> sendCounts(commSize,0);
         const Int numRemoteRemovals = distGraph_.remoteRemovals_.size();
         for( Int i=0; i<numRemoteRemovals; ++i )
             ++sendCounts[RowOwner(distGraph_.remoteRemovals_[i].first)];
         // Pack the send data
         // ------------------
-        vector<int> sendOffs;
-        const int totalSend = Scan( sendCounts, sendOffs );
+        vector<Int> sendOffs;
+        const Int totalSend = Scan( sendCounts, sendOffs );
         auto offs = sendOffs;
         vector<Int> sendRows(totalSend), sendCols(totalSend);
         for( Int i=0; i<totalSend; ++i )
@@ -10,6 +10,8 @@
 #ifndef EL_GRID_HPP
 #define EL_GRID_HPP
 
+#include <map>
+
 namespace El {
 
 class Grid
@@ -91,6 +93,20 @@ public:
     int BlacsMCMRContext() const;
 #endif
 
+    // The grids formed by splitting the owning processes into the given
+    // number of contiguous layers, each viewed by all of the viewing
+    // processes, and the communicator connecting the owning processes at the
+    // same position within each layer. Each layering is built upon its first
+    // request and kept until the grid is destroyed.
+    //
+    // NOTE: These caches are not thread-safe, and so concurrent calls upon
+    //       the same grid must be serialized
+    const vector<unique_ptr<Grid>>& LayerGrids( int numLayers ) const;
+    mpi::Comm LayerDepthComm( int numLayers ) const;
+    // The viewing processes which share a node with this one (cached after
+    // the first call)
+    mpi::Comm NodeComm() const;
+
     static int DefaultHeight( int gridSize ) EL_NO_EXCEPT;
 
     // To be used internally by Elemental
@@ -134,6 +150,14 @@ private:
     int blacsMCMRContext_;
 #endif
 
+    struct Layering
+    {
+        vector<unique_ptr<Grid>> grids;
+        mpi::Comm depthComm=mpi::COMM_NULL;
+    };
+    mutable std::map<int,Layering> layerings_;
+    mutable mpi::Comm nodeComm_=mpi::COMM_NULL;
+
     void SetUpGrid();
 
     // Disable copying this class due to MPI_Comm/MPI_Group ownership issues
@@ -11,12 +11,100 @@
 
 namespace El {
 
+// An abstract source of raw buffers for Memory<G>. Implementations must be
+// able to accept Free calls for buffers returned by Allocate with the same
+// number of bytes, and must throw std::bad_alloc upon failure.
+class Allocator
+{
+public:
+    virtual ~Allocator() { }
+    virtual void* Allocate( size_t numBytes ) = 0;
+    virtual void Free( void* buffer, size_t numBytes ) EL_NO_EXCEPT = 0;
+    // Return any cached buffers to the operating system
+    virtual void Trim() { }
+};
+
+struct AllocatorCtrl
+{
+    // The byte alignment of each returned buffer (a power of two which is
+    // a multiple of sizeof(void*))
+    size_t alignment=64;
+
+    // Whether freed buffers should be cached in size-class pools and reused
+    bool pool=true;
+    // Allocations larger than this bypass the pool
+    size_t maxPooledBytes=size_t(1) << 28;
+    // The maximum number of bytes held in the pools before freed buffers are
+    // returned to the operating system
+    size_t maxCachedBytes=size_t(1) << 30;
+
+    // Whether allocations of at least hugePageBytes should be aligned to, and
+    // advised to use, (transparent) huge pages
+    bool hugePages=false;
+    size_t hugePageBytes=size_t(1) << 21;
+
+    // Whether fresh (non-pooled) allocations should have their pages touched
+    // in parallel so that first-touch NUMA placement follows the threads
+    bool firstTouch=false;
+    size_t pageBytes=4096;
+};
+
+// The default allocator: size-class pools in front of an aligned allocator.
+// Each size class is a power of two subdivided into four equal steps so that
+// at most 25% of each buffer is wasted.
+class PoolAllocator : public Allocator
+{
+public:
+    PoolAllocator( const AllocatorCtrl& ctrl=AllocatorCtrl() );
+    ~PoolAllocator();
+
+    void* Allocate( size_t numBytes ) override;
+    void Free( void* buffer, size_t numBytes ) EL_NO_EXCEPT override;
+    void Trim() override;
+
+    const AllocatorCtrl& Ctrl() const EL_NO_EXCEPT;
+    size_t CachedBytes() const;
+    size_t NumPoolHits() const;
+
+private:
+    struct Impl;
+    unique_ptr<Impl> impl_;
+};
+
+// Per-process counters for all buffers handed out to Memory<G>
+struct MemoryStats
+{
+    size_t liveBytes=0;
+    size_t peakBytes=0;
+    size_t numAllocations=0;
+    size_t numFrees=0;
+};
+
+// The allocator used for all subsequent Memory<G> allocations. Buffers are
+// always returned to the allocator which provided them, so the allocator may
+// be safely swapped while buffers are live.
+shared_ptr<Allocator> GetAllocator();
+void SetAllocator( shared_ptr<Allocator> allocator );
+// Install a fresh PoolAllocator with the given control structure
+void SetAllocatorCtrl( const AllocatorCtrl& ctrl );
+// Return the cached buffers of the current allocator to the operating system
+void TrimAllocator();
+
+MemoryStats GetMemoryStats();
+void ResetPeakMemory();
+void PrintMemoryStats( ostream& os=cout );
+
+// For internal usage by Memory<G>
+void RecordAllocation( size_t numBytes ) EL_NO_EXCEPT;
+void RecordFree( size_t numBytes ) EL_NO_EXCEPT;
+
 template<typename G>
 class Memory
 {
     size_t size_;
     G* rawBuffer_;
     G* buffer_;
+    shared_ptr<Allocator> allocator_;
 public:
     Memory();
     Memory( size_t size );
@@ -11,16 +11,58 @@ namespace El {
 
 namespace {
 
-template<typename G>
-static G* New( size_t size )
+template<typename G,typename=EnableIf<IsPacked<G>>>
+static G* New( size_t size, Allocator& allocator )
 {
-    return new G[size];
+    const size_t numBytes = size*sizeof(G);
+    G* ptr = static_cast<G*>( allocator.Allocate( numBytes ) );
+    RecordAllocation( numBytes );
+    return ptr;
 }
 
-template<typename G>
-static void Delete( G*& ptr )
+template<typename G,typename=DisableIf<IsPacked<G>>,typename=void>
+static G* New( size_t size, Allocator& allocator )
 {
-    delete[] ptr;
+    const size_t numBytes = size*sizeof(G);
+    G* ptr = static_cast<G*>( allocator.Allocate( numBytes ) );
+    size_t numConstructed = 0;
+    try
+    {
+        for( ; numConstructed<size; ++numConstructed )
+            new (ptr+numConstructed) G;
+    }
+    catch( ... )
+    {
+        for( size_t i=0; i<numConstructed; ++i )
+            ptr[i].~G();
+        allocator.Free( ptr, numBytes );
+        throw;
+    }
+    RecordAllocation( numBytes );
+    return ptr;
+}
+
+template<typename G,typename=EnableIf<IsPacked<G>>>
+static void Delete( G*& ptr, size_t size, Allocator* allocator )
+{
+    if( ptr == nullptr )
+        return;
+    const size_t numBytes = size*sizeof(G);
+    allocator->Free( ptr, numBytes );
+    RecordFree( numBytes );
+    ptr = nullptr;
+}
+
+template<typename G,typename=DisableIf<IsPacked<G>>,typename=void>
+static void Delete( G*& ptr, size_t size, Allocator* allocator )
+{
+    if( ptr == nullptr )
+        return;
+    for( size_t i=0; i<size; ++i )
+        ptr[i].~G();
+    const size_t numBytes = size*sizeof(G);
+    allocator->Free( ptr, numBytes );
+    RecordFree( numBytes );
     ptr = nullptr;
 }
 
@@ -38,7 +80,7 @@ Memory<G>::Memory( size_t size )
 
 template<typename G>
 Memory<G>::Memory( Memory<G>&& mem )
-: size_(mem.size_), rawBuffer_(nullptr), buffer_(nullptr)
+: size_(0), rawBuffer_(nullptr), buffer_(nullptr)
 { ShallowSwap(mem); }
 
 template<typename G>
@@ -51,12 +93,13 @@ void Memory<G>::ShallowSwap( Memory<G>& mem )
     std::swap(size_,mem.size_);
     std::swap(rawBuffer_,mem.rawBuffer_);
     std::swap(buffer_,mem.buffer_);
+    std::swap(allocator_,mem.allocator_);
 }
 
 template<typename G>
 Memory<G>::~Memory() 
 { 
-    Delete( rawBuffer_ );
+    Delete( rawBuffer_, size_, allocator_.get() );
 }
 
 template<typename G>
@@ -70,14 +113,16 @@ G* Memory<G>::Require( size_t size )
 {
     if( size > size_ )
     {
-        Delete( rawBuffer_ );
+        Delete( rawBuffer_, size_, allocator_.get() );
+        buffer_ = nullptr;
+        size_ = 0;
 
 #ifndef EL_RELEASE
         try {
 #endif
-
-            // TODO: Optionally overallocate to force alignment of buffer_
-            rawBuffer_ = New<G>( size );
+            // The allocator is responsible for the alignment of the buffer
+            allocator_ = GetAllocator();
+            rawBuffer_ = New<G>( size, *allocator_ );
             buffer_ = rawBuffer_;
 
             size_ = size;
@@ -110,7 +155,7 @@ void Memory<G>::Release()
 template<typename G>
 void Memory<G>::Empty()
 {
-    Delete( rawBuffer_ );
+    Delete( rawBuffer_, size_, allocator_.get() );
     buffer_ = nullptr;
     size_ = 0;
 }
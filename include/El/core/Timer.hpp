@@ -33,6 +33,7 @@ public:
     double Stop();
     double Partial() const; // time since last start
     double Total() const; // total elapsed time
+    bool Running() const;
 
     void Reset( const string& name="[blank]" );
 private:
@@ -42,6 +43,92 @@ private:
     Clock::time_point lastTime_;
 };
 
+// Region timers
+// =============
+// A release-mode profiler of named, nested regions of code. While enabled,
+// each RegionTimer accumulates the number of entries into, and the inclusive
+// time spent within, its region, which is identified by the path of the
+// enclosing region names (e.g., "HermitianEig/Condense"). If tracing is also
+// enabled, each entry is additionally recorded as a Chrome trace event.
+//
+// Setting the environment variable EL_REGION_TIMERS (to anything but "0")
+// enables the timers from Initialize onwards, and setting EL_REGION_TRACE to
+// a filename additionally enables tracing. If the timers are still enabled
+// when Elemental is finalized, their summary over mpi::COMM_WORLD is printed
+// and, if a trace file was requested, the trace is written to it.
+
+void EnableRegionTimers();
+void DisableRegionTimers();
+bool RegionTimersEnabled();
+void ResetRegionTimers();
+
+void EnableRegionTrace( const string& filename="" );
+void DisableRegionTrace();
+bool RegionTraceEnabled();
+
+// NOTE: Pushes and pops are ignored while the timers are disabled, and
+//       disabling the timers discards any open regions. RegionTimer should
+//       usually be preferred since it is exception-safe.
+void PushRegion( const string& name );
+void PopRegion();
+
+class RegionTimer
+{
+public:
+    RegionTimer( const string& name )
+    : active_(RegionTimersEnabled())
+    {
+        if( active_ )
+            PushRegion( name );
+    }
+    ~RegionTimer()
+    {
+        if( active_ )
+            PopRegion();
+    }
+    RegionTimer( const RegionTimer& ) = delete;
+    RegionTimer& operator=( const RegionTimer& ) = delete;
+private:
+    bool active_;
+};
+
+// The number of completed entries into, and the inclusive time spent within,
+// the region with the given path on this process (zero if it was never
+// entered)
+Int RegionCalls( const string& path );
+double RegionTime( const string& path );
+
+// Serves the legacy 'time' members of the control structures: if 'enable' is
+// true and the region timers are not already enabled, they are reset and
+// enabled for the lifetime of the object, and their summary over 'comm' is
+// then printed before they are disabled again
+class ScopedRegionTimers
+{
+public:
+    ScopedRegionTimers( bool enable, mpi::Comm comm=mpi::COMM_WORLD );
+    ~ScopedRegionTimers();
+    ScopedRegionTimers( const ScopedRegionTimers& ) = delete;
+    ScopedRegionTimers& operator=( const ScopedRegionTimers& ) = delete;
+private:
+    bool owner_;
+    mpi::Comm comm_;
+};
+
+// Gathers the region statistics over 'comm' and prints, from its root, the
+// number of entries and the minimum, average, and maximum inclusive times
+// of each region over the processes (this is collective)
+void PrintRegionTimers( mpi::Comm comm=mpi::COMM_WORLD, ostream& os=cout );
+
+// Gathers the trace events over 'comm' and writes them from its root, using
+// one Chrome trace 'process' per rank (this is collective)
+void WriteRegionTrace
+( const string& filename, mpi::Comm comm=mpi::COMM_WORLD );
+
+// Called by Initialize and Finalize to respectively read the environment
+// variables and report the results
+void InitializeRegionTimers();
+void FinalizeRegionTimers();
+
 } // namespace El
 
 #endif // ifndef EL_TIMER_HPP
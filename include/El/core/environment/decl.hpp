@@ -93,6 +93,39 @@ void PushBlocksizeStack( Int blocksize );
 void PopBlocksizeStack();
 void EmptyBlocksizeStack();
 
+// Pushes a blocksize onto the stack for the lifetime of the object so that
+// it is popped even if an exception is thrown
+class BlocksizeScope
+{
+public:
+    BlocksizeScope( Int blocksize ) { PushBlocksizeStack( blocksize ); }
+    ~BlocksizeScope() { PopBlocksizeStack(); }
+private:
+    BlocksizeScope( const BlocksizeScope& ) = delete;
+    BlocksizeScope& operator=( const BlocksizeScope& ) = delete;
+};
+
+// Algorithmic parameters (e.g., blocksizes) chosen by Autotune are stored per
+// kernel, parameter name, datatype, and process grid shape (where a grid
+// shape of 0 x 0 denotes a sequential parameter). A profile of these
+// parameters can be saved to a file and, if the environment variable
+// EL_TUNING_PROFILE names such a file, it is loaded by Initialize.
+void SetTunedParameter
+( const string& kernel, const string& param, const string& typeName,
+  Int gridHeight, Int gridWidth, double value );
+double TunedParameter
+( const string& kernel, const string& param, const string& typeName,
+  Int gridHeight, Int gridWidth, double defaultValue );
+bool HaveTunedParameters();
+void ClearTunedParameters();
+void LoadTuningProfile( const string& filename );
+void SaveTuningProfile( const string& filename );
+
+// The tuned blocksize of the given kernel, or Blocksize() if there is none
+Int TunedBlocksize
+( const string& kernel, const string& typeName,
+  Int gridHeight, Int gridWidth );
+
 template<typename T,
          typename=EnableIf<IsScalar<T>>>
 const T& Max( const T& m, const T& n ) EL_NO_EXCEPT;
@@ -245,6 +278,12 @@ EL_DEBUG_ONLY(
     void PushCallStack( string s );
     void PopCallStack();
     void DumpCallStack( ostream& os=cerr );
+    // The qualified name of the function of a call-stack entry, e.g.,
+    // "El::AxpyContract" for "void El::AxpyContract(T, ...) [with T = double]"
+    string CallStackFunctionName( const string& entry );
+    // The innermost call-stack entry whose function name does not begin with
+    // 'exclude' (or the empty string if there is none)
+    string InnermostCallStackEntry( const string& exclude="" );
 
     class CallStackEntry
     {
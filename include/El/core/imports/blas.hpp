@@ -566,6 +566,9 @@ void Trsv
 
 // Level 3 BLAS
 // ============
+
+// The generic Gemm packs its operands into register- and cache-sized blocks
+// (and, with EL_HYBRID, distributes the row blocks over OpenMP threads)
 template<typename T>
 void Gemm
 ( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
@@ -575,6 +578,17 @@ void Gemm
   const T& beta,
         T* C, BlasInt CLDim );
 
+// The unblocked triple loop which the generic Gemm falls back to for small
+// products (exposed for benchmarking)
+template<typename T>
+void NaiveGemm
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+  const T* B, BlasInt BLDim,
+  const T& beta,
+        T* C, BlasInt CLDim );
+
 void Gemm
 ( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
   const float& alpha,
@@ -694,6 +708,17 @@ void Herk
   const Base<T>& beta,
         T* C, BlasInt CLDim );
 
+// The unblocked loops which the generic Herk, Syrk, Trmm and Trsm apply to
+// their diagonal blocks (exposed for testing)
+template<typename T>
+void NaiveHerk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  const Base<T>& alpha,
+  const T* A, BlasInt ALDim,
+  const Base<T>& beta,
+        T* C, BlasInt CLDim );
+
 void Herk
 ( char uplo, char trans,
   BlasInt n, BlasInt k,
@@ -818,6 +843,15 @@ void Syrk
   const T& beta,
         T* C, BlasInt CLDim );
 
+template<typename T>
+void NaiveSyrk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+  const T& beta,
+        T* C, BlasInt CLDim );
+
 void Syrk
 ( char uplo, char trans,
   BlasInt n, BlasInt k,
@@ -855,6 +889,14 @@ void Trmm
   const T* A, BlasInt ALDim,
         T* B, BlasInt BLDim );
 
+template<typename T>
+void NaiveTrmm
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+        T* B, BlasInt BLDim );
+
 void Trmm
 ( char side,  char uplo, char trans, char unit,
   BlasInt m, BlasInt n,
@@ -888,6 +930,14 @@ void Trsm
   const F* A, BlasInt ALDim,
         F* B, BlasInt BLDim );
 
+template<typename F>
+void NaiveTrsm
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const F& alpha,
+  const F* A, BlasInt ALDim,
+        F* B, BlasInt BLDim );
+
 void Trsm
 ( char side,  char uplo, char trans, char unit,
   BlasInt m, BlasInt n,
@@ -913,6 +963,13 @@ void Trsm
   const dcomplex* A, BlasInt ALDim,
         dcomplex* B, BlasInt BLDim );
 
+// Thread control
+// ==============
+// The number of threads used by the vendor BLAS (which is only adjustable
+// for MKL and OpenBLAS; otherwise the OpenMP setting is used)
+int NumThreads();
+void SetNumThreads( int numThreads );
+
 } // namespace blas
 } // namespace El
 
@@ -22,6 +22,7 @@ namespace mpi {
 #if defined(EL_HAVE_MPI3_NONBLOCKING_COLLECTIVES) || \
     defined(EL_HAVE_MPIX_NONBLOCKING_COLLECTIVES)
 #define EL_HAVE_NONBLOCKING 1
+#define EL_HAVE_NONBLOCKING_COLLECTIVES
 #else
 #define EL_HAVE_NONBLOCKING 0
 #endif
@@ -212,6 +213,43 @@ const int MIN_COLL_MSG = 1; // minimum message size for collectives
 inline int Pad( int count ) EL_NO_EXCEPT
 { return std::max(count,MIN_COLL_MSG); }
 
+// The largest number of entries which the large-count overloads (see
+// mpi_large_count.hpp) pass to a single MPI call. This defaults to half of
+// the largest int so that complex data can always be sent as pairs of reals.
+Int MaxMessageCount() EL_NO_EXCEPT;
+void SetMaxMessageCount( Int maxCount );
+
+// Communication profiling
+// -----------------------
+// While profiling is enabled, each communication routine records its call
+// count, payload bytes, and time against the current profile scope, which is
+// the innermost ProfileScope tag followed (in debug builds) by the innermost
+// routine outside of El::mpi on the call stack. If profiling is still enabled
+// when Elemental is finalized, the profile over COMM_WORLD is printed.
+void EnableProfiling() EL_NO_EXCEPT;
+void DisableProfiling() EL_NO_EXCEPT;
+bool Profiling() EL_NO_EXCEPT;
+void ResetProfile();
+
+void PushProfileScope( const std::string& scope );
+void PopProfileScope();
+
+class ProfileScope
+{
+public:
+    ProfileScope( const std::string& scope ) { PushProfileScope( scope ); }
+    ~ProfileScope() { PopProfileScope(); }
+};
+
+// The scopes which have recorded calls on this process (in sorted order) and
+// the number of calls recorded against a scope, summed over the operations
+std::vector<std::string> ProfiledScopes();
+Int ProfiledCalls( const std::string& scope );
+
+// Aggregates the profiles of the processes in 'comm' and prints them from its
+// root, sorted by the maximum time over the processes (this is collective)
+void PrintProfile( Comm comm=COMM_WORLD, std::ostream& os=std::cout );
+
 bool CommSameSizeAsInteger() EL_NO_EXCEPT;
 bool GroupSameSizeAsInteger() EL_NO_EXCEPT;
 
@@ -235,6 +273,8 @@ void Create
 ( Comm parentComm, Group subsetGroup, Comm& subsetComm ) EL_NO_RELEASE_EXCEPT;
 void Dup( Comm original, Comm& duplicate ) EL_NO_RELEASE_EXCEPT;
 void Split( Comm comm, int color, int key, Comm& newComm ) EL_NO_RELEASE_EXCEPT;
+// Split into the groups of processes which can share memory (i.e., nodes)
+void SplitShared( Comm comm, int key, Comm& newComm ) EL_NO_RELEASE_EXCEPT;
 void Free( Comm& comm ) EL_NO_RELEASE_EXCEPT;
 bool Congruent( Comm comm1, Comm comm2 ) EL_NO_RELEASE_EXCEPT;
 void ErrorHandlerSet
@@ -728,6 +768,31 @@ void AllGather
 ( const T* sbuf, int sc,
         T* rbuf, int rc, Comm comm ) EL_NO_RELEASE_EXCEPT;
 
+// Non-blocking AllGather
+// ----------------------
+// NOTE: If Elemental was not configured with non-blocking collectives, or the
+// datatype requires serialization, the AllGather is completed eagerly and the
+// request is set to null
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllGather
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm comm,
+  Request<Real>& request );
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllGather
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm comm,
+  Request<Complex<Real>>& request );
+template<typename T,
+         typename=DisableIf<IsPacked<T>>,
+         typename=void>
+void IAllGather
+( const T* sbuf, int sc,
+        T* rbuf, int rc, Comm comm,
+  Request<T>& request );
+
 // AllGather with variable recv sizes
 // ----------------------------------
 template<typename Real,
@@ -0,0 +1,525 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_IMPORTS_MPI_LARGE_COUNT_HPP
+#define EL_IMPORTS_MPI_LARGE_COUNT_HPP
+
+namespace El {
+namespace mpi {
+
+// Large-count communication
+// =========================
+// The wrappers in mpi.hpp, like MPI itself prior to the MPI-4 "_c"
+// interfaces, accept 'int' counts and displacements. The overloads below
+// accept any other integral count type (e.g., a 64-bit Int or a size_t) and
+// transparently split messages with more than MaxMessageCount() entries:
+//
+//  - Point-to-point messages, broadcasts, and (elementwise) reductions are
+//    performed as a sequence of calls on consecutive chunks.
+//  - Gathers and all-to-alls, whose data layouts depend upon the counts,
+//    fall back to pairwise exchanges of chunked point-to-point messages
+//    whenever a count or displacement is too large, and are otherwise passed
+//    straight through to the 'int' wrappers.
+//  - A single non-blocking message is tied to a single request, and so
+//    non-blocking routines raise an exception rather than silently
+//    truncating an excessive count.
+//
+// Calls with 'int' counts resolve to the original wrappers. Otherwise, each
+// process decides locally whether a message fits, as the counts of the
+// fixed-count collectives must be the same on every process. The only
+// exceptions are the variable-count Gather and AllToAll, where no single
+// process knows every count, and so the processes agree upon the path with
+// an extra AllReduce whenever the count type can hold an excessive count.
+
+template<typename Count>
+struct IsLargeCount
+{
+    static const bool value =
+      std::is_integral<Count>::value &&
+      !std::is_same<Count,int>::value &&
+      !std::is_same<Count,bool>::value;
+};
+
+namespace large_count {
+
+// Call op(offset,count) for consecutive chunks of [0,totalCount), each of
+// which contains at most MaxMessageCount() entries
+template<typename Count,class Function>
+void ForEachChunk( Count totalCount, const Function& op )
+{
+    const Int total = totalCount;
+    const Int maxCount = MaxMessageCount();
+    if( total <= maxCount )
+    {
+        op( Int(0), int(total) );
+        return;
+    }
+    for( Int offset=0; offset<total; offset+=maxCount )
+        op( offset, int(Min(maxCount,total-offset)) );
+}
+
+template<typename Count>
+bool Fits( Count count ) EL_NO_EXCEPT
+{ return Int(count) <= MaxMessageCount(); }
+
+template<typename Count>
+bool Fits( const Count* counts, int size ) EL_NO_EXCEPT
+{
+    for( int q=0; q<size; ++q )
+        if( !Fits(counts[q]) )
+            return false;
+    return true;
+}
+
+// Whether or not the count type can represent more than MaxMessageCount()
+template<typename Count>
+bool MayExceed() EL_NO_EXCEPT
+{
+    typedef unsigned long long ULL;
+    return ULL(std::numeric_limits<Count>::max()) > ULL(MaxMessageCount());
+}
+
+// Whether or not every process in the communicator found its counts to fit
+template<typename Count>
+bool AllFit( bool fits, Comm comm )
+{
+    if( !MayExceed<Count>() )
+        return true;
+    return AllReduce( int(fits), MIN, comm ) != 0;
+}
+
+template<typename Count>
+vector<int> ToInt( const Count* counts, int size )
+{
+    vector<int> intCounts(size);
+    for( int q=0; q<size; ++q )
+        intCounts[q] = int(counts[q]);
+    return intCounts;
+}
+
+template<typename Count>
+void CheckNonblocking( Count count )
+{
+    if( !Fits(count) )
+        LogicError
+        ("Non-blocking messages are limited to ",MaxMessageCount(),
+         " entries, but ",count," were requested");
+}
+
+// Send sendCounts[q] entries, starting at sbuf+sendOffs[q], to each process q
+// and receive recvCounts[q] entries from each process q into rbuf+recvOffs[q]
+// using a shifted sequence of chunked SendRecv's
+template<typename T>
+void PairwiseExchange
+( const T* sbuf, const Int* sendCounts, const Int* sendOffs,
+        T* rbuf, const Int* recvCounts, const Int* recvOffs, Comm comm )
+{
+    EL_DEBUG_CSE
+    const int commSize = Size( comm );
+    const int commRank = Rank( comm );
+    std::copy_n
+    ( &sbuf[sendOffs[commRank]], sendCounts[commRank],
+      &rbuf[recvOffs[commRank]] );
+    for( int shift=1; shift<commSize; ++shift )
+    {
+        const int to = (commRank+shift) % commSize;
+        const int from = (commRank+commSize-shift) % commSize;
+        SendRecv
+        ( &sbuf[sendOffs[to]], sendCounts[to], to,
+          &rbuf[recvOffs[from]], recvCounts[from], from, comm );
+    }
+}
+
+} // namespace large_count
+
+// Send
+// ----
+template<typename T,typename Count,typename=EnableIf<IsLargeCount<Count>>>
+void TaggedSend( const T* buf, Count count, int to, int tag, Comm comm )
+{
+    large_count::ForEachChunk
+    ( count, [&]( Int offset, int chunk )
+      { TaggedSend( &buf[offset], chunk, to, tag, comm ); } );
+}
+template<typename T,typename Count,typename=EnableIf<IsLargeCount<Count>>>
+void Send( const T* buf, Count count, int to, Comm comm )
+{ TaggedSend( buf, count, to, 0, comm ); }
+
+// Recv
+// ----
+template<typename T,typename Count,typename=EnableIf<IsLargeCount<Count>>>
+void TaggedRecv( T* buf, Count count, int from, int tag, Comm comm )
+{
+    large_count::ForEachChunk
+    ( count, [&]( Int offset, int chunk )
+      { TaggedRecv( &buf[offset], chunk, from, tag, comm ); } );
+}
+template<typename T,typename Count,typename=EnableIf<IsLargeCount<Count>>>
+void Recv( T* buf, Count count, int from, Comm comm )
+{ TaggedRecv( buf, count, from, 0, comm ); }
+
+// SendRecv
+// --------
+// NOTE: The chunks of the send and receive are paired with those of the
+//       partner processes, so the receive counts must exactly match the
+//       corresponding send counts
+template<typename T,typename Count,typename=EnableIf<IsLargeCount<Count>>>
+void TaggedSendRecv
+( const T* sbuf, Count sc, int to,   int stag,
+        T* rbuf, Count rc, int from, int rtag, Comm comm )
+{
+    const Int sendCount = sc;
+    const Int recvCount = rc;
+    if( large_count::Fits(sc) && large_count::Fits(rc) )
+    {
+        TaggedSendRecv
+        ( sbuf, int(sc), to, stag, rbuf, int(rc), from, rtag, comm );
+        return;
+    }
+    // Each side sends (receives) ceil(count/MaxMessageCount()) messages (and
+    // at least one), and sits out the remaining steps with MPI_PROC_NULL
+    const Int maxCount = MaxMessageCount();
+    const Int numSendChunks = Max((sendCount+maxCount-1)/maxCount,Int(1));
+    const Int numRecvChunks = Max((recvCount+maxCount-1)/maxCount,Int(1));
+    const Int numChunks = Max(numSendChunks,numRecvChunks);
+    for( Int k=0; k<numChunks; ++k )
+    {
+        const Int offset = k*maxCount;
+        const bool sending = ( k < numSendChunks );
+        const bool recving = ( k < numRecvChunks );
+        TaggedSendRecv
+        ( &sbuf[sending ? offset : 0],
+          sending ? int(Min(maxCount,sendCount-offset)) : 0,
+          sending ? to : MPI_PROC_NULL, stag,
+          &rbuf[recving ? offset : 0],
+          recving ? int(Min(maxCount,recvCount-offset)) : 0,
+          recving ? from : MPI_PROC_NULL, rtag, comm );
+    }
+}
+template<typename T,typename Count,typename=EnableIf<IsLargeCount<Count>>>
+void SendRecv
+( const T* sbuf, Count sc, int to,
+        T* rbuf, Count rc, int from, Comm comm )
+{ TaggedSendRecv( sbuf, sc, to, 0, rbuf, rc, from, ANY_TAG, comm ); }
+
+template<typename T,typename Count,typename=EnableIf<IsLargeCount<Count>>>
+void TaggedSendRecv
+( T* buf, Count count, int to, int stag, int from, int rtag, Comm comm )
+{
+    large_count::ForEachChunk
+    ( count, [&]( Int offset, int chunk )
+      { TaggedSendRecv( &buf[offset], chunk, to, stag, from, rtag, comm ); } );
+}
+template<typename T,typename Count,typename=EnableIf<IsLargeCount<Count>>>
+void SendRecv( T* buf, Count count, int to, int from, Comm comm )
+{ TaggedSendRecv( buf, count, to, 0, from, ANY_TAG, comm ); }
+
+// Non-blocking point-to-point
+// ---------------------------
+template<typename T,typename Count,typename=EnableIf<IsLargeCount<Count>>>
+void ISend( const T* buf, Count count, int to, Comm comm, Request<T>& request )
+{
+    large_count::CheckNonblocking( count );
+    ISend( buf, int(count), to, comm, request );
+}
+template<typename T,typename Count,typename=EnableIf<IsLargeCount<Count>>>
+void IRecv( T* buf, Count count, int from, Comm comm, Request<T>& request )
+{
+    large_count::CheckNonblocking( count );
+    IRecv( buf, int(count), from, comm, request );
+}
+
+// Broadcast
+// ---------
+template<typename T,typename Count,typename=EnableIf<IsLargeCount<Count>>>
+void Broadcast( T* buf, Count count, int root, Comm comm )
+{
+    large_count::ForEachChunk
+    ( count, [&]( Int offset, int chunk )
+      { Broadcast( &buf[offset], chunk, root, comm ); } );
+}
+
+template<typename T,typename Count,typename=EnableIf<IsLargeCount<Count>>>
+void IBroadcast( T* buf, Count count, int root, Comm comm, Request<T>& request )
+{
+    large_count::CheckNonblocking( count );
+    IBroadcast( buf, int(count), root, comm, request );
+}
+
+// Reduce
+// ------
+template<typename T,typename Count,typename=EnableIf<IsLargeCount<Count>>>
+void Reduce( const T* sbuf, T* rbuf, Count count, Op op, int root, Comm comm )
+{
+    large_count::ForEachChunk
+    ( count, [&]( Int offset, int chunk )
+      { Reduce( &sbuf[offset], &rbuf[offset], chunk, op, root, comm ); } );
+}
+template<typename T,typename Count,typename=EnableIf<IsLargeCount<Count>>>
+void Reduce( const T* sbuf, T* rbuf, Count count, int root, Comm comm )
+{ Reduce( sbuf, rbuf, count, SUM, root, comm ); }
+
+template<typename T,typename Count,typename=EnableIf<IsLargeCount<Count>>>
+void Reduce( T* buf, Count count, Op op, int root, Comm comm )
+{
+    large_count::ForEachChunk
+    ( count, [&]( Int offset, int chunk )
+      { Reduce( &buf[offset], chunk, op, root, comm ); } );
+}
+template<typename T,typename Count,typename=EnableIf<IsLargeCount<Count>>>
+void Reduce( T* buf, Count count, int root, Comm comm )
+{ Reduce( buf, count, SUM, root, comm ); }
+
+// AllReduce
+// ---------
+template<typename T,typename Count,typename=EnableIf<IsLargeCount<Count>>>
+void AllReduce( const T* sbuf, T* rbuf, Count count, Op op, Comm comm )
+{
+    large_count::ForEachChunk
+    ( count, [&]( Int offset, int chunk )
+      { AllReduce( &sbuf[offset], &rbuf[offset], chunk, op, comm ); } );
+}
+template<typename T,typename Count,typename=EnableIf<IsLargeCount<Count>>>
+void AllReduce( const T* sbuf, T* rbuf, Count count, Comm comm )
+{ AllReduce( sbuf, rbuf, count, SUM, comm ); }
+
+template<typename T,typename Count,typename=EnableIf<IsLargeCount<Count>>>
+void AllReduce( T* buf, Count count, Op op, Comm comm )
+{
+    large_count::ForEachChunk
+    ( count, [&]( Int offset, int chunk )
+      { AllReduce( &buf[offset], chunk, op, comm ); } );
+}
+template<typename T,typename Count,typename=EnableIf<IsLargeCount<Count>>>
+void AllReduce( T* buf, Count count, Comm comm )
+{ AllReduce( buf, count, SUM, comm ); }
+
+// Gather
+// ------
+template<typename T,typename Count,typename=EnableIf<IsLargeCount<Count>>>
+void Gather
+( const T* sbuf, Count sc,
+        T* rbuf, Count rc, int root, Comm comm )
+{
+    EL_DEBUG_CSE
+    const int commSize = Size( comm );
+    const int commRank = Rank( comm );
+    if( large_count::Fits(sc) && large_count::Fits(Int(rc)*commSize) )
+    {
+        Gather( sbuf, int(sc), rbuf, int(rc), root, comm );
+        return;
+    }
+    if( commRank == root )
+    {
+        for( int q=0; q<commSize; ++q )
+        {
+            if( q == root )
+                std::copy_n( sbuf, Int(sc), &rbuf[q*Int(rc)] );
+            else
+                Recv( &rbuf[q*Int(rc)], Int(rc), q, comm );
+        }
+    }
+    else
+        Send( sbuf, Int(sc), root, comm );
+}
+
+template<typename T,typename Count,typename=EnableIf<IsLargeCount<Count>>>
+void Gather
+( const T* sbuf, Count sc,
+        T* rbuf, const Count* rcs, const Count* rds, int root, Comm comm )
+{
+    EL_DEBUG_CSE
+    const int commSize = Size( comm );
+    const int commRank = Rank( comm );
+    // Only the root's receive counts and displacements are significant
+    bool fits = large_count::Fits(sc);
+    if( commRank == root )
+        fits = fits && large_count::Fits(rcs,commSize) &&
+                       large_count::Fits(rds,commSize);
+    if( large_count::AllFit<Count>( fits, comm ) )
+    {
+        vector<int> intCounts, intDispls;
+        if( commRank == root )
+        {
+            intCounts = large_count::ToInt( rcs, commSize );
+            intDispls = large_count::ToInt( rds, commSize );
+        }
+        Gather
+        ( sbuf, int(sc), rbuf, intCounts.data(), intDispls.data(),
+          root, comm );
+        return;
+    }
+    if( commRank == root )
+    {
+        for( int q=0; q<commSize; ++q )
+        {
+            if( q == root )
+                std::copy_n( sbuf, Int(sc), &rbuf[rds[q]] );
+            else
+                Recv( &rbuf[rds[q]], Int(rcs[q]), q, comm );
+        }
+    }
+    else
+        Send( sbuf, Int(sc), root, comm );
+}
+
+// AllGather
+// ---------
+template<typename T,typename Count,typename=EnableIf<IsLargeCount<Count>>>
+void AllGather
+( const T* sbuf, Count sc,
+        T* rbuf, Count rc, Comm comm )
+{
+    EL_DEBUG_CSE
+    const int commSize = Size( comm );
+    if( large_count::Fits(sc) && large_count::Fits(Int(rc)*commSize) )
+    {
+        AllGather( sbuf, int(sc), rbuf, int(rc), comm );
+        return;
+    }
+    vector<Int> sendCounts(commSize,sc), sendOffs(commSize,0),
+                recvCounts(commSize,rc), recvOffs(commSize);
+    for( int q=0; q<commSize; ++q )
+        recvOffs[q] = q*Int(rc);
+    large_count::PairwiseExchange
+    ( sbuf, sendCounts.data(), sendOffs.data(),
+      rbuf, recvCounts.data(), recvOffs.data(), comm );
+}
+
+template<typename T,typename Count,typename=EnableIf<IsLargeCount<Count>>>
+void AllGather
+( const T* sbuf, Count sc,
+        T* rbuf, const Count* rcs, const Count* rds, Comm comm )
+{
+    EL_DEBUG_CSE
+    const int commSize = Size( comm );
+    // The receive counts and displacements are identical on every process
+    if( large_count::Fits(rcs,commSize) && large_count::Fits(rds,commSize) )
+    {
+        auto intCounts = large_count::ToInt( rcs, commSize );
+        auto intDispls = large_count::ToInt( rds, commSize );
+        AllGather
+        ( sbuf, int(sc), rbuf, intCounts.data(), intDispls.data(), comm );
+        return;
+    }
+    vector<Int> sendCounts(commSize,sc), sendOffs(commSize,0),
+                recvCounts(rcs,rcs+commSize), recvOffs(rds,rds+commSize);
+    large_count::PairwiseExchange
+    ( sbuf, sendCounts.data(), sendOffs.data(),
+      rbuf, recvCounts.data(), recvOffs.data(), comm );
+}
+
+// Scatter
+// -------
+template<typename T,typename Count,typename=EnableIf<IsLargeCount<Count>>>
+void Scatter
+( const T* sbuf, Count sc,
+        T* rbuf, Count rc, int root, Comm comm )
+{
+    EL_DEBUG_CSE
+    const int commSize = Size( comm );
+    const int commRank = Rank( comm );
+    if( large_count::Fits(rc) && large_count::Fits(Int(sc)*commSize) )
+    {
+        Scatter( sbuf, int(sc), rbuf, int(rc), root, comm );
+        return;
+    }
+    if( commRank == root )
+    {
+        for( int q=0; q<commSize; ++q )
+        {
+            if( q == root )
+                std::copy_n( &sbuf[q*Int(sc)], Int(rc), rbuf );
+            else
+                Send( &sbuf[q*Int(sc)], Int(sc), q, comm );
+        }
+    }
+    else
+        Recv( rbuf, Int(rc), root, comm );
+}
+
+// AllToAll
+// --------
+template<typename T,typename Count,typename=EnableIf<IsLargeCount<Count>>>
+void AllToAll
+( const T* sbuf, Count sc,
+        T* rbuf, Count rc, Comm comm )
+{
+    EL_DEBUG_CSE
+    const int commSize = Size( comm );
+    if( large_count::Fits(Int(sc)*commSize) &&
+        large_count::Fits(Int(rc)*commSize) )
+    {
+        AllToAll( sbuf, int(sc), rbuf, int(rc), comm );
+        return;
+    }
+    vector<Int> sendCounts(commSize,sc), sendOffs(commSize),
+                recvCounts(commSize,rc), recvOffs(commSize);
+    for( int q=0; q<commSize; ++q )
+    {
+        sendOffs[q] = q*Int(sc);
+        recvOffs[q] = q*Int(rc);
+    }
+    large_count::PairwiseExchange
+    ( sbuf, sendCounts.data(), sendOffs.data(),
+      rbuf, recvCounts.data(), recvOffs.data(), comm );
+}
+
+template<typename T,typename Count,typename=EnableIf<IsLargeCount<Count>>>
+void AllToAll
+( const T* sbuf, const Count* scs, const Count* sds,
+        T* rbuf, const Count* rcs, const Count* rds, Comm comm )
+{
+    EL_DEBUG_CSE
+    const int commSize = Size( comm );
+    // Every process must agree upon whether to use the fallback
+    const bool localFits =
+      large_count::Fits(scs,commSize) && large_count::Fits(sds,commSize) &&
+      large_count::Fits(rcs,commSize) && large_count::Fits(rds,commSize);
+    if( large_count::AllFit<Count>( localFits, comm ) )
+    {
+        auto intSendCounts = large_count::ToInt( scs, commSize );
+        auto intSendDispls = large_count::ToInt( sds, commSize );
+        auto intRecvCounts = large_count::ToInt( rcs, commSize );
+        auto intRecvDispls = large_count::ToInt( rds, commSize );
+        AllToAll
+        ( sbuf, intSendCounts.data(), intSendDispls.data(),
+          rbuf, intRecvCounts.data(), intRecvDispls.data(), comm );
+        return;
+    }
+    vector<Int> sendCounts(scs,scs+commSize), sendOffs(sds,sds+commSize),
+                recvCounts(rcs,rcs+commSize), recvOffs(rds,rds+commSize);
+    large_count::PairwiseExchange
+    ( sbuf, sendCounts.data(), sendOffs.data(),
+      rbuf, recvCounts.data(), recvOffs.data(), comm );
+}
+
+template<typename T,typename Count,typename=EnableIf<IsLargeCount<Count>>>
+vector<T> AllToAll
+( const vector<T>& sendBuf,
+  const vector<Count>& sendCounts,
+  const vector<Count>& sendOffs,
+  Comm comm )
+{
+    EL_DEBUG_CSE
+    const int commSize = Size( comm );
+    vector<Count> recvCounts(commSize);
+    AllToAll( sendCounts.data(), 1, recvCounts.data(), 1, comm );
+    vector<Count> recvOffs;
+    const Count totalRecv = El::Scan( recvCounts, recvOffs );
+    vector<T> recvBuf(totalRecv);
+    AllToAll
+    ( sendBuf.data(), sendCounts.data(), sendOffs.data(),
+      recvBuf.data(), recvCounts.data(), recvOffs.data(), comm );
+    return recvBuf;
+}
+
+} // namespace mpi
+} // namespace El
+
+#endif // ifndef EL_IMPORTS_MPI_LARGE_COUNT_HPP
@@ -86,6 +86,57 @@ void ApplyP
   const AbstractDistMatrix<Field>& householderScalars,
         AbstractDistMatrix<Field>& B );
 
+// Two-stage reduction
+// -------------------
+// Reduce a matrix which is at least as tall as it is wide to an upper band
+// matrix, B = Q1^H A P1, using Gemm-rich updates. The upper band of A is
+// overwritten with B and Q1 and P1 are stored implicitly outside of it.
+template<typename Field>
+void ReduceToBand
+( AbstractDistMatrix<Field>& A,
+  AbstractDistMatrix<Field>& householderScalarsQ,
+  AbstractDistMatrix<Base<Field>>& signatureQ,
+  AbstractDistMatrix<Field>& householderScalarsP,
+  AbstractDistMatrix<Base<Field>>& signatureP,
+  Int bandwidth );
+
+// Overwrite B with Q1 B
+template<typename Field>
+void ApplyBandQ
+( const AbstractDistMatrix<Field>& A,
+  const AbstractDistMatrix<Field>& householderScalarsQ,
+  const AbstractDistMatrix<Base<Field>>& signatureQ,
+  Int bandwidth,
+        AbstractDistMatrix<Field>& B );
+
+// Overwrite B with P1 B
+template<typename Field>
+void ApplyBandP
+( const AbstractDistMatrix<Field>& A,
+  const AbstractDistMatrix<Field>& householderScalarsP,
+  const AbstractDistMatrix<Base<Field>>& signatureP,
+  Int bandwidth,
+        AbstractDistMatrix<Field>& B );
+
+// Reduce the upper band matrix B, stored such that band(j-i,i) = B(i,j)
+// for 0 <= j-i <= bandwidth, to real upper bidiagonal form,
+// Q2^H B P2, by bulge chasing. The second version overwrites (subsets of the
+// rows of) U and V with U Q2 and V P2.
+template<typename Field>
+void BandToBidiag
+( Int bandwidth,
+  const Matrix<Field>& band,
+        Matrix<Base<Field>>& d,
+        Matrix<Base<Field>>& e );
+template<typename Field>
+void BandToBidiag
+( Int bandwidth,
+  const Matrix<Field>& band,
+        Matrix<Base<Field>>& d,
+        Matrix<Base<Field>>& e,
+        Matrix<Field>& U,
+        Matrix<Field>& V );
+
 } // namespace bidiag
 
 // HermitianTridiag
@@ -141,6 +192,46 @@ void ApplyQ
   const AbstractDistMatrix<Field>& householderScalars,
         AbstractDistMatrix<Field>& B );
 
+// Two-stage reduction
+// -------------------
+// Reduce A to a Hermitian band matrix, B = Q1^H A Q1, using Gemm-rich
+// updates. The lower band of A is overwritten with B and Q1 is stored
+// implicitly below the band.
+template<typename Field>
+void ReduceToBand
+( UpperOrLower uplo,
+  AbstractDistMatrix<Field>& A,
+  AbstractDistMatrix<Field>& householderScalars,
+  AbstractDistMatrix<Base<Field>>& signature,
+  Int bandwidth );
+
+// Overwrite B with Q1 B
+template<typename Field>
+void ApplyBandQ
+( const AbstractDistMatrix<Field>& A,
+  const AbstractDistMatrix<Field>& householderScalars,
+  const AbstractDistMatrix<Base<Field>>& signature,
+  Int bandwidth,
+        AbstractDistMatrix<Field>& B );
+
+// Reduce the Hermitian band matrix B, stored such that band(i-j,j) = B(i,j)
+// for 0 <= i-j <= bandwidth, to real symmetric tridiagonal form, T = Q2^H B Q2,
+// by bulge chasing. The second version overwrites (a subset of the rows of)
+// Q with Q Q2.
+template<typename Field>
+void BandToTridiag
+( Int bandwidth,
+  const Matrix<Field>& band,
+        Matrix<Base<Field>>& d,
+        Matrix<Base<Field>>& e );
+template<typename Field>
+void BandToTridiag
+( Int bandwidth,
+  const Matrix<Field>& band,
+        Matrix<Base<Field>>& d,
+        Matrix<Base<Field>>& e,
+        Matrix<Field>& Q );
+
 } // namespace herm_tridiag
 
 // Hessenberg
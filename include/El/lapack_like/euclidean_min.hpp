@@ -23,6 +23,9 @@ namespace El {
 //
 //    min_X || X ||_F s.t. op(A) X = B.
 //
+// The distributed variant forwards 'qrCtrl' to the QR factorization (e.g., to
+// select communication-avoiding panels); it is not used when A is wide.
+//
 template<typename Field>
 void LeastSquares
 ( Orientation orientation,
@@ -34,7 +37,8 @@ void LeastSquares
 ( Orientation orientation,
   const AbstractDistMatrix<Field>& A,
   const AbstractDistMatrix<Field>& B,
-        AbstractDistMatrix<Field>& X );
+        AbstractDistMatrix<Field>& X,
+  const QRCtrl<Base<Field>>& qrCtrl=QRCtrl<Base<Field>>() );
 
 template<typename Real>
 struct SQSDCtrl
@@ -120,7 +124,8 @@ void Overwrite
 ( Orientation orientation,
         AbstractDistMatrix<Field>& A,
   const AbstractDistMatrix<Field>& B,
-        AbstractDistMatrix<Field>& X );
+        AbstractDistMatrix<Field>& X,
+  const QRCtrl<Base<Field>>& qrCtrl=QRCtrl<Base<Field>>() );
 
 } // namespace ls
 
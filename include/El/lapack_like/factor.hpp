@@ -18,12 +18,26 @@ namespace El {
 
 // Cholesky
 // ========
+struct CholeskyCtrl
+{
+    bool scalapack=false;
+
+    // The number of panels beyond the current one whose columns receive the
+    // trailing update first, so that the next panel can be factored and its
+    // redistribution overlapped with the remainder of the update. Zero
+    // disables the lookahead.
+    Int lookahead=0;
+};
+
 template<typename Field>
 void Cholesky( UpperOrLower uplo, Matrix<Field>& A );
 template<typename Field>
 void Cholesky
 ( UpperOrLower uplo, AbstractDistMatrix<Field>& A, bool scalapack=false );
 template<typename Field>
+void Cholesky
+( UpperOrLower uplo, AbstractDistMatrix<Field>& A, const CholeskyCtrl& ctrl );
+template<typename Field>
 void Cholesky( UpperOrLower uplo, DistMatrix<Field,STAR,STAR>& A );
 
 template<typename Field>
@@ -57,6 +71,15 @@ void HPSDCholesky( UpperOrLower uplo, Matrix<Field>& A );
 template<typename Field>
 void HPSDCholesky( UpperOrLower uplo, AbstractDistMatrix<Field>& A );
 
+// Factor each of a batch of independent (typically small) HPD matrices; see
+// BatchedGemm for the treatment of the batch. The entire batch is processed
+// before a NonHPDMatrixException is thrown for any matrices which were not HPD.
+template<typename Field>
+void BatchedCholesky( UpperOrLower uplo, vector<Matrix<Field>>& A );
+// The batchSize matrices are stored side by side in the columns of A
+template<typename Field>
+void BatchedCholesky( UpperOrLower uplo, Matrix<Field>& A, Int batchSize );
+
 namespace cholesky {
 
 template<typename Field>
@@ -361,6 +384,29 @@ enum LUPivotType
 }
 using namespace LUPivotTypeNS;
 
+// The pivoting strategy for the panels of a distributed partially-pivoted LU
+namespace LUPanelPivotNS {
+enum LUPanelPivot
+{
+    // Classical partial pivoting, with one reduction per column of the panel
+    LU_PANEL_PARTIAL,
+    // Communication-avoiding tournament pivoting (CALU), which selects the
+    // pivots for an entire panel via a reduction tree over the process column
+    LU_PANEL_TOURNAMENT
+};
+}
+using namespace LUPanelPivotNS;
+
+struct LUCtrl
+{
+    LUPanelPivot panelPivot=LU_PANEL_PARTIAL;
+
+    // The number of panels beyond the current one whose columns receive the
+    // trailing update first, so that the AllGather of the next panel can
+    // overlap with the remainder of the update. Zero disables the lookahead.
+    Int lookahead=0;
+};
+
 // LU without pivoting
 // -------------------
 template<typename Field>
@@ -375,7 +421,20 @@ void LU( DistMatrix<Field,STAR,STAR>& A );
 template<typename Field>
 void LU( Matrix<Field>& A, Permutation& P );
 template<typename Field>
-void LU( AbstractDistMatrix<Field>& A, DistPermutation& P );
+void LU
+( AbstractDistMatrix<Field>& A,
+  DistPermutation& P,
+  const LUCtrl& ctrl=LUCtrl() );
+
+// Batched LU with partial pivoting
+// --------------------------------
+// The entire batch is processed before a SingularMatrixException is thrown for
+// any matrices with a zero pivot
+template<typename Field>
+void BatchedLU( vector<Matrix<Field>>& A, vector<Permutation>& P );
+// The batchSize matrices are stored side by side in the columns of A
+template<typename Field>
+void BatchedLU( Matrix<Field>& A, vector<Permutation>& P, Int batchSize );
 
 // LU with full pivoting
 // ---------------------
@@ -542,9 +601,26 @@ void Explicit( AbstractDistMatrix<Field>& L, AbstractDistMatrix<Field>& A );
 // QR factorization
 // ================
 
+// The algorithm for the panels of a distributed Householder QR
+namespace QRPanelNS {
+enum QRPanel
+{
+    // Classical Householder, with one reduction per column of the panel
+    QR_PANEL_HOUSEHOLDER,
+    // Communication-avoiding QR (CAQR), which factors each panel with TSQR
+    // over the process column and then reconstructs Householder vectors from
+    // the explicit orthogonal factor
+    QR_PANEL_TSQR
+};
+}
+using namespace QRPanelNS;
+
 template<typename Real>
 struct QRCtrl
 {
+    // Only used by the unpivoted distributed QR
+    QRPanel panel=QR_PANEL_HOUSEHOLDER;
+
     bool colPiv=false;
 
     bool boundRank=false;
@@ -576,6 +652,12 @@ void QR
 ( AbstractDistMatrix<Field>& A,
   AbstractDistMatrix<Field>& householderScalars,
   AbstractDistMatrix<Base<Field>>& signature );
+template<typename Field>
+void QR
+( AbstractDistMatrix<Field>& A,
+  AbstractDistMatrix<Field>& householderScalars,
+  AbstractDistMatrix<Base<Field>>& signature,
+  const QRCtrl<Base<Field>>& ctrl );
 
 // Return an implicit representation of (Q,R,Omega) such that A Omega^T ~= Q R
 // ---------------------------------------------------------------------------
@@ -50,6 +50,24 @@ LDLFrontType InitialFactorType( LDLFrontType type );
 
 namespace ldl {
 
+// Controls for the shared-memory traversal of the sequential portion of the
+// elimination tree (which is only multithreaded in builds with OpenMP)
+struct TraversalCtrl
+{
+    // Whether independent subtrees should be factored concurrently
+    bool parallel=true;
+
+    // The number of independent subtrees per thread which the tree should be
+    // split into; the subtrees are factored using single-threaded BLAS,
+    // whereas the fronts above them are processed one at a time using
+    // threaded BLAS
+    Int subtreesPerThread=4;
+
+    // A bound on the number of bytes of update-matrix workspace held by the
+    // concurrently-factored subtrees (zero corresponds to no bound)
+    double maxWorkspaceBytes=0;
+};
+
 template<typename T>
 struct DistMatrixNode;
 template<typename T>
@@ -247,6 +265,50 @@ struct DistMatrixNode
 // (with the bottom-right piece stored in workspace) since only the left side
 // needs to be kept after the factorization is complete.
 
+// A memory-mapped scratch file which backs the dense factors of the fronts
+// of a sequential tree so that the kernel may page them out to disk. The
+// fronts are laid out in post-order, which is the order of both the
+// factorization and the forward solve.
+class OutOfCoreFile
+{
+public:
+    // Create (and immediately unlink) a scratch file of the given size
+    // within the directory
+    OutOfCoreFile( const string& directory, size_t numBytes );
+    ~OutOfCoreFile();
+
+    size_t NumBytes() const;
+    void* Buffer( size_t offset ) const;
+
+    // The number of bytes reserved for a (height x width) front
+    static size_t SlotBytes( Int height, Int width, size_t entrySize );
+    // The number of bytes required by the fronts of the tree
+    static size_t FrontBytes( const NodeInfo& info, size_t entrySize );
+
+    // Release the given range from memory after beginning to write it back
+    void Evict( const void* buffer, size_t numBytes ) const;
+    // Begin reading the given range back in from the file
+    void Prefetch( const void* buffer, size_t numBytes ) const;
+
+    template<typename Field>
+    void Evict( const Matrix<Field>& A ) const
+    { Evict( A.LockedBuffer(), size_t(A.LDim())*A.Width()*sizeof(Field) ); }
+    template<typename Field>
+    void Prefetch( const Matrix<Field>& A ) const
+    { Prefetch( A.LockedBuffer(), size_t(A.LDim())*A.Width()*sizeof(Field) ); }
+
+private:
+    int fd_=-1;
+    char* data_=nullptr;
+    size_t numBytes_=0;
+};
+
+// An estimate of the peak number of bytes required by the sequential
+// factorization of the tree with the given entry size, with the dense
+// factors of the fronts either held in memory or backed by a scratch file
+double PeakFactorMemory
+( const NodeInfo& info, size_t entrySize, bool outOfCore );
+
 template<typename Field>
 struct DistFront;
 
@@ -274,6 +336,10 @@ struct Front
     // (should it exist).
     DistFront<Field>* duplicate=nullptr;
 
+    // An observing pointer for the scratch file backing LDense
+    // (should it exist).
+    OutOfCoreFile* storage=nullptr;
+
     // Unique pointers to the child fronts (should they exist).
     vector<unique_ptr<Front<Field>>> children;
 
@@ -294,6 +360,13 @@ struct Front
       const vector<Int>& reordering,
       const NodeInfo& rootInfo,
       bool hermitian=true );
+    // Overwrite this front (but not its children) with the corresponding
+    // entries of 'A', given both the reordering and its inverse
+    void PullNode
+    ( const SparseMatrix<Field>& A,
+      const vector<Int>& reordering,
+      const vector<Int>& invReorder,
+      const NodeInfo& info );
     void PullUpdate
     ( const SparseMatrix<Field>& A,
       const vector<Int>& reordering,
@@ -469,8 +542,32 @@ public:
     // with a different matrix (e.g., within an Interior Point Method).
     void ChangeNonzeroValues( const SparseMatrix<Field>& ANew );
 
+    // Refactor after changing the values of the nonzeros of the factored
+    // matrix, where every changed entry (i,j) has both i and j listed within
+    // 'changedInds' (so that a change to the diagonal of a block only
+    // requires listing the indices of the block). Only the fronts whose
+    // subtrees contain a changed index are refactored. The update matrices
+    // of their unchanged children are rebuilt from the existing factors
+    // (or, for pivoted and block factorizations, by refactoring the child
+    // subtrees) and retained so that subsequent refactorizations involving
+    // the same indices may reuse them.
+    void Refactor
+    ( const SparseMatrix<Field>& ANew, const vector<Int>& changedInds );
+
+    // Back the dense factors of the fronts with a memory-mapped scratch file
+    // within the given directory so that they may be paged out to disk
+    // (this takes effect at the next initialization).
+    void EnableOutOfCore( const string& scratchDirectory );
+    void DisableOutOfCore();
+
+    // An estimate of the peak number of bytes required by the factorization
+    // of the initialized tree, either in or out of core.
+    double PeakFactorMemory( bool outOfCore ) const;
+
     // Factor the initialized multifrontal tree.
-    void Factor( LDLFrontType frontType=LDL_2D );
+    void Factor
+    ( LDLFrontType frontType=LDL_2D,
+      const ldl::TraversalCtrl& traversalCtrl=ldl::TraversalCtrl() );
 
     // Change the storage format of the multifrontal tree. This can be called
     // either before or after factorization.
@@ -543,7 +640,12 @@ private:
     unique_ptr<ldl::NodeInfo> info_;
     unique_ptr<ldl::Separator> separator_;
 
+    string scratchDirectory_;
+    unique_ptr<ldl::OutOfCoreFile> outOfCoreFile_;
+
     vector<Int> map_, inverseMap_;
+
+    void InitializeFronts( const SparseMatrix<Field>& A, bool hermitian );
 };
 
 template<typename Field>
@@ -583,7 +685,9 @@ public:
     void ChangeNonzeroValues( const DistSparseMatrix<Field>& ANew );
 
     // Factor the initialized multifrontal tree.
-    void Factor( LDLFrontType frontType=LDL_2D );
+    void Factor
+    ( LDLFrontType frontType=LDL_2D,
+      const ldl::TraversalCtrl& traversalCtrl=ldl::TraversalCtrl() );
 
     // Change the storage format of the multifrontal tree. This can be called
     // either before or after factorization.
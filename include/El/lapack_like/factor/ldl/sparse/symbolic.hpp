@@ -30,6 +30,23 @@ namespace ldl {
 Int Analysis( NodeInfo& rootInfo, Int myOff=0 );
 void Analysis( DistNodeInfo& rootInfo, bool storeFactRecvInds=true );
 
+// The number of merged fronts along with the estimated (real) flop counts
+// and numbers of front entries before and after amalgamation
+struct AmalgamationInfo
+{
+    Int numMerges=0;
+    double flopsBefore=0, flopsAfter=0;
+    double entriesBefore=0, entriesAfter=0;
+};
+
+// Relaxed amalgamation of an analyzed separator tree (the tree is
+// reanalyzed afterwards). Only the sequential subtrees of a distributed tree
+// are amalgamated.
+AmalgamationInfo Amalgamate
+( Separator& rootSep, NodeInfo& rootInfo, const BisectCtrl& ctrl );
+AmalgamationInfo Amalgamate
+( DistSeparator& rootSep, DistNodeInfo& rootInfo, const BisectCtrl& ctrl );
+
 void AMDOrder
 ( const vector<Int>& subOffsets,
   const vector<Int>& subTargets,
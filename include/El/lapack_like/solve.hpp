@@ -14,6 +14,53 @@
 
 namespace El {
 
+// Control structure for dense linear and HPD solves which, if
+// 'mixedPrecision' is true, factor a copy of the matrix in the next-lower
+// precision (e.g., 'float' for 'double') and then recover working-precision
+// accuracy either via classical iterative refinement or, if 'gmres' is true,
+// via GMRES-based iterative refinement (GMRES-IR) preconditioned with the
+// low-precision factorization. If the low-precision factorization breaks down
+// or the refinement fails to converge (or stalls), the solve is transparently
+// repeated with a working-precision factorization.
+//
+// Each column of the solution is considered converged once
+//
+//   || b - A x ||_max <= relTol sqrt(n) || A ||_oo || x ||_max,
+//
+// which, for the default of relTol = eps, mirrors LAPACK's [d,z]sgesv.
+template<typename Real>
+struct LinearSolveCtrl
+{
+    bool mixedPrecision=false;
+    bool gmres=false;
+    Real relTol;
+    Int maxRefineIts=30;
+
+    // The maximum number of (flexible) GMRES iterations per refinement step
+    Int maxGMRESIts=20;
+
+    // A refinement step is deemed to have stalled if it fails to reduce the
+    // residual norm of an unconverged column by at least this factor
+    Real stallRatio=Real(1)/Real(2);
+
+    bool progress=false;
+
+    LinearSolveCtrl() { relTol = limits::Epsilon<Real>(); }
+};
+
+struct LinearSolveInfo
+{
+    // Whether the returned solution was refined from a low-precision
+    // factorization (rather than computed from a working-precision one)
+    bool mixedPrecision=false;
+    // Whether a requested mixed-precision solve broke down, stalled, or did
+    // not converge, so that a working-precision factorization was used
+    bool fellBack=false;
+    // The number of refinement steps taken by the mixed-precision solve
+    // (including any before it fell back)
+    Int numRefineIts=0;
+};
+
 // Linear
 // ======
 template<typename Field>
@@ -26,6 +73,31 @@ void LinearSolve
         AbstractDistMatrix<Field>& B,
   bool scalapack=false );
 
+template<typename Field>
+LinearSolveInfo LinearSolve
+( const Matrix<Field>& A,
+        Matrix<Field>& B,
+  const LinearSolveCtrl<Base<Field>>& ctrl );
+template<typename Field>
+LinearSolveInfo LinearSolve
+( const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& B,
+  const LinearSolveCtrl<Base<Field>>& ctrl );
+
+// Solve each of a batch of independent (typically small) linear systems; see
+// BatchedGemm for the treatment of the batch. The entire batch is processed
+// before a SingularMatrixException is thrown for any singular systems.
+template<typename Field>
+void BatchedLinearSolve
+( const vector<Matrix<Field>>& A,
+        vector<Matrix<Field>>& B );
+// The batchSize systems are stored side by side in the columns of A and B
+template<typename Field>
+void BatchedLinearSolve
+( const Matrix<Field>& A,
+        Matrix<Field>& B,
+  Int batchSize );
+
 template<typename Field>
 void LinearSolve
 ( const SparseMatrix<Field>& A,
@@ -199,6 +271,38 @@ void HPDSolve
   const AbstractDistMatrix<Field>& A,
         AbstractDistMatrix<Field>& B );
 
+template<typename Field>
+LinearSolveInfo HPDSolve
+( UpperOrLower uplo,
+  Orientation orientation,
+  const Matrix<Field>& A,
+        Matrix<Field>& B,
+  const LinearSolveCtrl<Base<Field>>& ctrl );
+template<typename Field>
+LinearSolveInfo HPDSolve
+( UpperOrLower uplo,
+  Orientation orientation,
+  const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& B,
+  const LinearSolveCtrl<Base<Field>>& ctrl );
+
+// The entire batch is processed before a NonHPDMatrixException is thrown for
+// any matrices which were not HPD
+template<typename Field>
+void BatchedHPDSolve
+( UpperOrLower uplo,
+  Orientation orientation,
+  const vector<Matrix<Field>>& A,
+        vector<Matrix<Field>>& B );
+// The batchSize systems are stored side by side in the columns of A and B
+template<typename Field>
+void BatchedHPDSolve
+( UpperOrLower uplo,
+  Orientation orientation,
+  const Matrix<Field>& A,
+        Matrix<Field>& B,
+  Int batchSize );
+
 template<typename Field>
 void HPDSolve
 ( const SparseMatrix<Field>& A,
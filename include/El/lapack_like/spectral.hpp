@@ -416,6 +416,11 @@ struct HermitianEigCtrl
     bool useScaLAPACK=false;
     bool useSDC=false;
     bool timeStages=false;
+
+    // Reduce distributed matrices to tridiagonal form in two stages, first
+    // to a band matrix (with a bandwidth of Blocksize() if zero is given)
+    bool twoStage=false;
+    Int twoStageBandwidth=0;
 };
 
 struct HermitianEigInfo
@@ -1218,7 +1223,7 @@ template<typename Real>
 struct SVDCtrl
 {
     bool overwrite=false; // Allow 'A' to be overwritten computing A = U S V^H
-    bool time=false;
+    bool time=false; // Print a summary of the region timers of each call
 
     // Use LAPACK within sequential SVD?
     bool useLAPACK=false;
@@ -1237,6 +1242,12 @@ struct SVDCtrl
     // decomposition when computing a full SVD
     double fullChanRatio=1.5;
 
+    // Reduce distributed matrices to bidiagonal form in two stages, first
+    // to an upper band matrix (with a bandwidth of Blocksize() if zero is
+    // given) and then to bidiagonal form via bulge chasing
+    bool twoStage=false;
+    Int twoStageBandwidth=0;
+
     BidiagSVDCtrl<Real> bidiagSVDCtrl;
 };
 
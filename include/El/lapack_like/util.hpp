@@ -21,9 +21,19 @@ struct BisectCtrl
     Int cutoff;
     bool storeFactRecvInds;
 
+    // Relaxed amalgamation of the resulting separator tree: each front is
+    // merged with the child preceding it as long as the explicit zeros
+    // introduced into the merged front make up at most the given fraction
+    // of its entries
+    bool amalgamate;
+    double maxAmalgamationFill;
+    // Print the effect of the amalgamation?
+    bool printAmalgamation;
+
     BisectCtrl()
     : sequential(true), numDistSeps(1), numSeqSeps(1), cutoff(1024),
-      storeFactRecvInds(false)
+      storeFactRecvInds(false), amalgamate(false), maxAmalgamationFill(0.1),
+      printAmalgamation(false)
     { }
 };
 
@@ -146,6 +156,43 @@ void MergeSortingPermutation
 ( Int n0, Int n1, const Matrix<Real>& x, Permutation& sortPerm,
   SortType sort=ASCENDING );
 
+// Autotuning
+// ==========
+struct AutotuneCtrl
+{
+    // The (square) problem size used to time each kernel
+    Int size=1000;
+
+    // The candidate algorithmic blocksizes of the distributed kernels
+    vector<Int> blocksizes={32,48,64,96,128,192,256};
+
+    // The candidate blocksizes of LocalTrrk (within Cholesky) and of the
+    // local Symv (within HermitianTridiag)
+    vector<Int> localBlocksizes={16,32,64,128,256};
+
+    // The candidate blocksizes of the dot-product variant of Gemm
+    vector<Int> dotBlocksizes={250,500,1000,2000,4000};
+
+    // The ratios of the inner dimension of Gemm to its outer dimensions at
+    // which the crossovers between the SUMMA variants are searched for
+    vector<double> gemmAspectRatios={1,2,4,8,16,32};
+
+    // The fastest of this many runs is used for each timing
+    Int numReps=1;
+
+    bool progress=false;
+
+    // If nonempty, the root process saves the complete tuning profile to this
+    // file so that it can be loaded by later runs via EL_TUNING_PROFILE
+    string filename="";
+};
+
+// Sweep the algorithmic parameters of the main distributed kernels (Gemm,
+// Trsm, LU, Cholesky, and HermitianTridiag) for the given datatype and grid
+// shape and record the fastest choices via SetTunedParameter
+template<typename Field>
+void Autotune( const Grid& grid, const AutotuneCtrl& ctrl=AutotuneCtrl() );
+
 } // namespace El
 
 #endif // ifndef EL_UTIL_HPP
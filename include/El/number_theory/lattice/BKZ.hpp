@@ -202,8 +202,6 @@ BKZInfo<Base<F>> BKZWithQ
 
 namespace bkz {
 
-static Timer enumTimer, bkzTimer;
-
 template<typename F>
 bool TrivialCoordinates( const Matrix<F>& v )
 {
@@ -473,11 +471,8 @@ BKZInfo<Base<F>> BKZWithQ
         Output("Warning: Computation of U not yet supported for recursive BKZ");
     }
 
-    if( ctrl.time )
-    {
-        bkz::enumTimer.Reset();
-        bkz::bkzTimer.Reset();
-    }
+    ScopedRegionTimers timers( ctrl.time, mpi::COMM_SELF );
+    RegionTimer bkzRegion("BKZ");
 
     // TODO: Add optional logging
 
@@ -491,11 +486,11 @@ BKZInfo<Base<F>> BKZWithQ
             lllCtrl.jumpstart = true;
             lllCtrl.startCol = 0;
         }
-        if( ctrl.time )
-            bkz::bkzTimer.Start();
-        auto lllInfo = LLLWithQ( B, U, QR, t, d, lllCtrl );
-        if( ctrl.time )
-            Output("Initial LLL time: ",bkz::bkzTimer.Stop()," seconds");
+        LLLInfo<Real> lllInfo;
+        {
+            RegionTimer region("InitialLLL");
+            lllInfo = LLLWithQ( B, U, QR, t, d, lllCtrl );
+        }
         BKZInfo<Real> info;
         info.delta = lllInfo.delta;
         info.eta = lllInfo.eta;
@@ -526,13 +521,12 @@ BKZInfo<Base<F>> BKZWithQ
             lllCtrl.jumpstart = true;
             lllCtrl.startCol = 0;
         }
-        if( ctrl.time )
-            bkz::bkzTimer.Start();
-        lllInfo = LLLWithQ( B, U, QR, t, d, lllCtrl );
-        if( ctrl.progress )
-            Output("Initial LLL applied ",lllInfo.numSwaps," swaps");
-        if( ctrl.time )
-            Output("Initial LLL time: ",bkz::bkzTimer.Stop()," seconds");
+        {
+            RegionTimer region("InitialLLL");
+            lllInfo = LLLWithQ( B, U, QR, t, d, lllCtrl );
+            if( ctrl.progress )
+                Output("Initial LLL applied ",lllInfo.numSwaps," swaps");
+        }
         numSwaps = lllInfo.numSwaps;
     }
     // The zero columns should be at the end of B
@@ -593,18 +587,19 @@ BKZInfo<Base<F>> BKZWithQ
         auto BEnum = B( ALL, IR(j,k+1) );
         auto UEnum = U( ALL, IR(j,k+1) );
         auto QREnum = QR( IR(j,k+1), IR(j,k+1) );
-        if( ctrl.time )
-            bkz::enumTimer.Start();
-        if( ctrl.variableEnumType )
-            enumCtrl.enumType = ctrl.enumTypeFunc(j);
-        const Range<Int> windowInd = IR(j,Min(j+ctrl.multiEnumWindow,k+1));
-        auto normUpperBounds = GetRealPartOfDiagonal(QR(windowInd,windowInd));
-        Scale( Min(Sqrt(ctrl.lllCtrl.delta),Real(1)), normUpperBounds );
-        const auto minPair = 
-          MultiShortestVectorEnrichment
-          ( BEnum, UEnum, QREnum, normUpperBounds, v, enumCtrl );
-        if( ctrl.time )
-            Output("Enum/enrich time: ",bkz::enumTimer.Stop()," seconds");
+        std::pair<Real,Int> minPair;
+        {
+            RegionTimer region("Enum");
+            if( ctrl.variableEnumType )
+                enumCtrl.enumType = ctrl.enumTypeFunc(j);
+            const Range<Int> windowInd = IR(j,Min(j+ctrl.multiEnumWindow,k+1));
+            auto normUpperBounds =
+              GetRealPartOfDiagonal(QR(windowInd,windowInd));
+            Scale( Min(Sqrt(ctrl.lllCtrl.delta),Real(1)), normUpperBounds );
+            minPair =
+              MultiShortestVectorEnrichment
+              ( BEnum, UEnum, QREnum, normUpperBounds, v, enumCtrl );
+        }
         ++numEnums;
 
         const Real minProjNorm = minPair.first;
@@ -654,60 +649,59 @@ BKZInfo<Base<F>> BKZWithQ
         auto QRSub = QR( ALL, subInd );
         auto tSub = t( subInd, ALL );
         auto dSub = d( subInd, ALL );
-        if( ctrl.time )
-            bkz::bkzTimer.Start();
-        if( ctrl.subBKZ )
         {
-            BKZCtrl<Real> subCtrl( ctrl );
-            subCtrl.time = false;
-            subCtrl.progress = false;
-            subCtrl.jumpstart = true;
-            // Only if we insist on only one level of recursion
-            subCtrl.subBKZ = false;
-            subCtrl.blocksize = ctrl.subBlocksizeFunc(ctrl.blocksize);
-            subCtrl.earlyAbort = ctrl.subEarlyAbort;
-            subCtrl.numEnumsBeforeAbort = ctrl.subNumEnumsBeforeAbort;
-            subCtrl.variableBlocksize = false;
-            subCtrl.variableEnumType = false;
-            subCtrl.recursive = false;
-            subCtrl.logFailedEnums = false;
-            subCtrl.logStreakSizes = false;
-            subCtrl.logNontrivialCoords = false;
-            subCtrl.logNorms = false;
-            subCtrl.logProjNorms = false;
-            subCtrl.checkpoint = false;
-            subCtrl.enumCtrl.disablePrecDrop = true;
-            subCtrl.enumCtrl.time = false;
-            subCtrl.enumCtrl.progress = false;
-            subCtrl.lllCtrl.jumpstart = false;
-            subCtrl.lllCtrl.recursive = false;
-            if( ctrl.progress )
-              Output("Running sub-BKZ with blocksize=",subCtrl.blocksize);
-            auto bkzInfo = BKZWithQ( BSub, W, QRSub, tSub, dSub, subCtrl );
-            if( ctrl.progress )
-              Output
-              ("  ",bkzInfo.numSwaps," swaps and ",
-               bkzInfo.numEnumFailures," failed enums");
-            if( bkzInfo.numSwaps != 0 || bkzInfo.numEnumFailures != 0 )
-                changed = true;
-            numSwaps += bkzInfo.numSwaps;
-        }
-        else
-        {
-            LLLCtrl<Real> subLLLCtrl( ctrl.lllCtrl );
-            subLLLCtrl.jumpstart = true;
-            subLLLCtrl.startCol = ( keptMin ? j : h-1 );
-            subLLLCtrl.recursive = false;
-            lllInfo = LLLWithQ( BSub, W, QRSub, tSub, dSub, subLLLCtrl );
-            if( lllInfo.numSwaps != 0 )
-                changed = true;
-            numSwaps += lllInfo.numSwaps;
+            RegionTimer region("SubBKZ");
+            if( ctrl.subBKZ )
+            {
+                BKZCtrl<Real> subCtrl( ctrl );
+                subCtrl.time = false;
+                subCtrl.progress = false;
+                subCtrl.jumpstart = true;
+                // Only if we insist on only one level of recursion
+                subCtrl.subBKZ = false;
+                subCtrl.blocksize = ctrl.subBlocksizeFunc(ctrl.blocksize);
+                subCtrl.earlyAbort = ctrl.subEarlyAbort;
+                subCtrl.numEnumsBeforeAbort = ctrl.subNumEnumsBeforeAbort;
+                subCtrl.variableBlocksize = false;
+                subCtrl.variableEnumType = false;
+                subCtrl.recursive = false;
+                subCtrl.logFailedEnums = false;
+                subCtrl.logStreakSizes = false;
+                subCtrl.logNontrivialCoords = false;
+                subCtrl.logNorms = false;
+                subCtrl.logProjNorms = false;
+                subCtrl.checkpoint = false;
+                subCtrl.enumCtrl.disablePrecDrop = true;
+                subCtrl.enumCtrl.time = false;
+                subCtrl.enumCtrl.progress = false;
+                subCtrl.lllCtrl.jumpstart = false;
+                subCtrl.lllCtrl.recursive = false;
+                if( ctrl.progress )
+                  Output("Running sub-BKZ with blocksize=",subCtrl.blocksize);
+                auto bkzInfo = BKZWithQ( BSub, W, QRSub, tSub, dSub, subCtrl );
+                if( ctrl.progress )
+                  Output
+                  ("  ",bkzInfo.numSwaps," swaps and ",
+                   bkzInfo.numEnumFailures," failed enums");
+                if( bkzInfo.numSwaps != 0 || bkzInfo.numEnumFailures != 0 )
+                    changed = true;
+                numSwaps += bkzInfo.numSwaps;
+            }
+            else
+            {
+                LLLCtrl<Real> subLLLCtrl( ctrl.lllCtrl );
+                subLLLCtrl.jumpstart = true;
+                subLLLCtrl.startCol = ( keptMin ? j : h-1 );
+                subLLLCtrl.recursive = false;
+                lllInfo = LLLWithQ( BSub, W, QRSub, tSub, dSub, subLLLCtrl );
+                if( lllInfo.numSwaps != 0 )
+                    changed = true;
+                numSwaps += lllInfo.numSwaps;
+            }
+            auto USub = U( ALL, subInd );
+            auto USubCopy( USub );
+            Gemm( NORMAL, NORMAL, F(1), USubCopy, W, USub );
         }
-        auto USub = U( ALL, subInd );
-        auto USubCopy( USub );
-        Gemm( NORMAL, NORMAL, F(1), USubCopy, W, USub );
-        if( ctrl.time )
-            Output("BKZ time: ",bkz::bkzTimer.Stop()," seconds");
         if( !keptMin )
         {
             if( changed )
@@ -750,12 +744,6 @@ BKZInfo<Base<F>> BKZWithQ
     if( ctrl.logNontrivialCoords )
         nontrivialCoordsFile.close();
 
-    if( ctrl.time )
-    {
-        Output("Total enumeration time: ",bkz::enumTimer.Total()," seconds");
-        Output("Total sub-BKZ time:     ",bkz::bkzTimer.Total()," seconds");
-    }
-
     BKZInfo<Real> info;
     info.delta = lllInfo.delta;
     info.eta = lllInfo.eta;
@@ -836,11 +824,8 @@ BKZInfo<Base<F>> BKZWithQ
         !ctrl.jumpstart )
         return RecursiveBKZWithQ( B, QR, t, d, ctrl );
 
-    if( ctrl.time )
-    {
-        bkz::enumTimer.Reset();
-        bkz::bkzTimer.Reset();
-    }
+    ScopedRegionTimers timers( ctrl.time, mpi::COMM_SELF );
+    RegionTimer bkzRegion("BKZ");
 
     // TODO: Add optional logging
 
@@ -854,11 +839,11 @@ BKZInfo<Base<F>> BKZWithQ
             lllCtrl.jumpstart = true;
             lllCtrl.startCol = 0;
         }
-        if( ctrl.time )
-            bkz::bkzTimer.Start();
-        auto lllInfo = LLLWithQ( B, QR, t, d, lllCtrl );
-        if( ctrl.time )
-            Output("Initial LLL time: ",bkz::bkzTimer.Stop()," seconds");
+        LLLInfo<Real> lllInfo;
+        {
+            RegionTimer region("InitialLLL");
+            lllInfo = LLLWithQ( B, QR, t, d, lllCtrl );
+        }
         BKZInfo<Real> info;
         info.delta = lllInfo.delta;
         info.eta = lllInfo.eta;
@@ -888,11 +873,10 @@ BKZInfo<Base<F>> BKZWithQ
             lllCtrl.jumpstart = true;
             lllCtrl.startCol = 0;
         }
-        if( ctrl.time )
-            bkz::bkzTimer.Start();
-        lllInfo = LLLWithQ( B, QR, t, d, lllCtrl );
-        if( ctrl.time )
-            Output("Initial LLL time: ",bkz::bkzTimer.Stop()," seconds");
+        {
+            RegionTimer region("InitialLLL");
+            lllInfo = LLLWithQ( B, QR, t, d, lllCtrl );
+        }
         if( ctrl.progress )
             Output("Initial LLL applied ",lllInfo.numSwaps," swaps");
         numSwaps = lllInfo.numSwaps;
@@ -954,18 +938,19 @@ BKZInfo<Base<F>> BKZWithQ
         Matrix<F> v;
         auto BEnum = B( ALL, IR(j,k+1) );
         auto QREnum = QR( IR(j,k+1), IR(j,k+1) );
-        if( ctrl.time )
-            bkz::enumTimer.Start();
-        if( ctrl.variableEnumType )
-            enumCtrl.enumType = ctrl.enumTypeFunc(j);
-        const Range<Int> windowInd = IR(j,Min(j+ctrl.multiEnumWindow,k+1));
-        auto normUpperBounds = GetRealPartOfDiagonal(QR(windowInd,windowInd));
-        Scale( Min(Sqrt(ctrl.lllCtrl.delta),Real(1)), normUpperBounds );
-        const auto minPair =
-          MultiShortestVectorEnrichment
-          ( BEnum, QREnum, normUpperBounds, v, enumCtrl );
-        if( ctrl.time )
-            Output("Enum/enrich time: ",bkz::enumTimer.Stop()," seconds");
+        std::pair<Real,Int> minPair;
+        {
+            RegionTimer region("Enum");
+            if( ctrl.variableEnumType )
+                enumCtrl.enumType = ctrl.enumTypeFunc(j);
+            const Range<Int> windowInd = IR(j,Min(j+ctrl.multiEnumWindow,k+1));
+            auto normUpperBounds =
+              GetRealPartOfDiagonal(QR(windowInd,windowInd));
+            Scale( Min(Sqrt(ctrl.lllCtrl.delta),Real(1)), normUpperBounds );
+            minPair =
+              MultiShortestVectorEnrichment
+              ( BEnum, QREnum, normUpperBounds, v, enumCtrl );
+        }
         ++numEnums;
 
         const Real minProjNorm = minPair.first;
@@ -1012,57 +997,56 @@ BKZInfo<Base<F>> BKZWithQ
         auto QRSub = QR( ALL, subInd );
         auto tSub = t( subInd, ALL );
         auto dSub = d( subInd, ALL );
-        if( ctrl.time )
-            bkz::bkzTimer.Start();
-        if( ctrl.subBKZ )
         {
-            BKZCtrl<Real> subCtrl( ctrl );
-            subCtrl.time = false;
-            subCtrl.progress = false;
-            subCtrl.jumpstart = true;
-            // Only if we insist on only one level of recursion
-            subCtrl.subBKZ = false;
-            subCtrl.blocksize = ctrl.subBlocksizeFunc(ctrl.blocksize);
-            subCtrl.earlyAbort = ctrl.subEarlyAbort;
-            subCtrl.numEnumsBeforeAbort = ctrl.subNumEnumsBeforeAbort;
-            subCtrl.variableBlocksize = false;
-            subCtrl.variableEnumType = false;
-            subCtrl.recursive = false;
-            subCtrl.logFailedEnums = false;
-            subCtrl.logStreakSizes = false;
-            subCtrl.logNontrivialCoords = false;
-            subCtrl.logNorms = false;
-            subCtrl.logProjNorms = false;
-            subCtrl.checkpoint = false;
-            subCtrl.enumCtrl.disablePrecDrop = true;
-            subCtrl.enumCtrl.time = false;
-            subCtrl.enumCtrl.progress = false;
-            subCtrl.lllCtrl.jumpstart = false;
-            subCtrl.lllCtrl.recursive = false;
-            if( ctrl.progress )
-              Output("Running sub-BKZ with blocksize=",subCtrl.blocksize);
-            auto bkzInfo = BKZWithQ( BSub, QRSub, tSub, dSub, subCtrl );
-            if( ctrl.progress )
-              Output
-              ("  ",bkzInfo.numSwaps," swaps and ",
-               bkzInfo.numEnumFailures," failed enums");
-            if( bkzInfo.numSwaps != 0 || bkzInfo.numEnumFailures != 0 )
-                changed = true;
-            numSwaps += bkzInfo.numSwaps;
-        }
-        else
-        {
-            LLLCtrl<Real> subLLLCtrl( ctrl.lllCtrl );
-            subLLLCtrl.jumpstart = true;
-            subLLLCtrl.startCol = ( keptMin ? j : h-1 );
-            subLLLCtrl.recursive = false;
-            lllInfo = LLLWithQ( BSub, QRSub, tSub, dSub, subLLLCtrl );
-            if( lllInfo.numSwaps != 0 )
-                changed = true;
-            numSwaps += lllInfo.numSwaps;
+            RegionTimer region("SubBKZ");
+            if( ctrl.subBKZ )
+            {
+                BKZCtrl<Real> subCtrl( ctrl );
+                subCtrl.time = false;
+                subCtrl.progress = false;
+                subCtrl.jumpstart = true;
+                // Only if we insist on only one level of recursion
+                subCtrl.subBKZ = false;
+                subCtrl.blocksize = ctrl.subBlocksizeFunc(ctrl.blocksize);
+                subCtrl.earlyAbort = ctrl.subEarlyAbort;
+                subCtrl.numEnumsBeforeAbort = ctrl.subNumEnumsBeforeAbort;
+                subCtrl.variableBlocksize = false;
+                subCtrl.variableEnumType = false;
+                subCtrl.recursive = false;
+                subCtrl.logFailedEnums = false;
+                subCtrl.logStreakSizes = false;
+                subCtrl.logNontrivialCoords = false;
+                subCtrl.logNorms = false;
+                subCtrl.logProjNorms = false;
+                subCtrl.checkpoint = false;
+                subCtrl.enumCtrl.disablePrecDrop = true;
+                subCtrl.enumCtrl.time = false;
+                subCtrl.enumCtrl.progress = false;
+                subCtrl.lllCtrl.jumpstart = false;
+                subCtrl.lllCtrl.recursive = false;
+                if( ctrl.progress )
+                  Output("Running sub-BKZ with blocksize=",subCtrl.blocksize);
+                auto bkzInfo = BKZWithQ( BSub, QRSub, tSub, dSub, subCtrl );
+                if( ctrl.progress )
+                  Output
+                  ("  ",bkzInfo.numSwaps," swaps and ",
+                   bkzInfo.numEnumFailures," failed enums");
+                if( bkzInfo.numSwaps != 0 || bkzInfo.numEnumFailures != 0 )
+                    changed = true;
+                numSwaps += bkzInfo.numSwaps;
+            }
+            else
+            {
+                LLLCtrl<Real> subLLLCtrl( ctrl.lllCtrl );
+                subLLLCtrl.jumpstart = true;
+                subLLLCtrl.startCol = ( keptMin ? j : h-1 );
+                subLLLCtrl.recursive = false;
+                lllInfo = LLLWithQ( BSub, QRSub, tSub, dSub, subLLLCtrl );
+                if( lllInfo.numSwaps != 0 )
+                    changed = true;
+                numSwaps += lllInfo.numSwaps;
+            }
         }
-        if( ctrl.time )
-            Output("BKZ time: ",bkz::bkzTimer.Stop()," seconds");
         if( !keptMin )
         {
             if( changed )
@@ -1106,12 +1090,6 @@ BKZInfo<Base<F>> BKZWithQ
     if( ctrl.logProjNorms )
         projNormsFile.close();
 
-    if( ctrl.time )
-    {
-        Output("Total enumeration time: ",bkz::enumTimer.Total()," seconds");
-        Output("Total sub-BKZ time:     ",bkz::bkzTimer.Total()," seconds");
-    }
-
     BKZInfo<Real> info;
     info.delta = lllInfo.delta;
     info.eta = lllInfo.eta;
@@ -8,7 +8,13 @@
 */
 #include <El-lite.hpp>
 #include <El/blas_like.hpp>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <sstream>
 #include <stack>
+#include <tuple>
 
 namespace {
 using namespace El;
@@ -30,6 +36,61 @@ struct LocalTrr2kBlocksizeHelper { static Int value; };
 template<typename T>
 Int LocalTrr2kBlocksizeHelper<T>::value = 64;
 
+Int gemm25DLayers = 0;
+double gemm25DMemoryLimit = 0;
+
+// (kernel, parameter, datatype, grid height, grid width)
+typedef std::tuple<string,string,string,Int,Int> TuningKey;
+std::map<TuningKey,double> tunedParameters;
+
+// The (kernel, datatype) local blocksizes which were overridden by tuned
+// parameters, along with their values beforehand
+std::map<std::pair<string,string>,Int> overriddenLocalBlocksizes;
+
+// Return a pointer to the local blocksize of the given kernel if the
+// datatype matches (and a null pointer otherwise)
+template<typename T>
+Int* LocalBlocksizeIfType( const string& kernel, const string& typeName )
+{
+    if( typeName != TypeName<T>() )
+        return nullptr;
+    if( kernel == "LocalSymv" )
+        return &LocalSymvBlocksizeHelper<T>::value;
+    else if( kernel == "LocalTrrk" )
+        return &LocalTrrkBlocksizeHelper<T>::value;
+    else if( kernel == "LocalTrr2k" )
+        return &LocalTrr2kBlocksizeHelper<T>::value;
+    return nullptr;
+}
+
+// The local blocksizes are stored per datatype (rather than looked up from
+// the tuning profile on each use) and so must be dispatched by type name
+Int* LocalBlocksize( const string& kernel, const string& typeName )
+{
+    Int* blocksize = nullptr;
+    auto check =
+      [&]( Int* candidate ) { if( candidate ) blocksize = candidate; };
+    check( LocalBlocksizeIfType<float>( kernel, typeName ) );
+    check( LocalBlocksizeIfType<double>( kernel, typeName ) );
+    check( LocalBlocksizeIfType<Complex<float>>( kernel, typeName ) );
+    check( LocalBlocksizeIfType<Complex<double>>( kernel, typeName ) );
+#ifdef EL_HAVE_QD
+    check( LocalBlocksizeIfType<DoubleDouble>( kernel, typeName ) );
+    check( LocalBlocksizeIfType<QuadDouble>( kernel, typeName ) );
+    check( LocalBlocksizeIfType<Complex<DoubleDouble>>( kernel, typeName ) );
+    check( LocalBlocksizeIfType<Complex<QuadDouble>>( kernel, typeName ) );
+#endif
+#ifdef EL_HAVE_QUAD
+    check( LocalBlocksizeIfType<Quad>( kernel, typeName ) );
+    check( LocalBlocksizeIfType<Complex<Quad>>( kernel, typeName ) );
+#endif
+#ifdef EL_HAVE_MPC
+    check( LocalBlocksizeIfType<BigFloat>( kernel, typeName ) );
+    check( LocalBlocksizeIfType<Complex<BigFloat>>( kernel, typeName ) );
+#endif
+    return blocksize;
+}
+
 }
 
 namespace El {
@@ -94,6 +155,125 @@ template<typename T>
 Int LocalTrr2kBlocksize()
 { return LocalTrr2kBlocksizeHelper<T>::value; }
 
+void SetGemm25DLayers( Int numLayers )
+{
+    EL_DEBUG_CSE
+    if( numLayers < 0 )
+        LogicError("Number of 2.5D Gemm layers must be non-negative");
+    ::gemm25DLayers = numLayers;
+}
+
+Int Gemm25DLayers()
+{ return ::gemm25DLayers; }
+
+void SetGemm25DMemoryLimit( double numBytes )
+{ ::gemm25DMemoryLimit = numBytes; }
+
+double Gemm25DMemoryLimit()
+{ return ::gemm25DMemoryLimit; }
+
+void SetTunedParameter
+( const string& kernel, const string& param, const string& typeName,
+  Int gridHeight, Int gridWidth, double value )
+{
+    EL_DEBUG_CSE
+    ::tunedParameters[TuningKey(kernel,param,typeName,gridHeight,gridWidth)] =
+      value;
+    if( param == "blocksize" && gridHeight == 0 && gridWidth == 0 )
+    {
+        Int* localBlocksize = ::LocalBlocksize( kernel, typeName );
+        if( localBlocksize != nullptr )
+        {
+            // Only the value from before the first override is kept
+            ::overriddenLocalBlocksizes.emplace
+            ( std::make_pair(kernel,typeName), *localBlocksize );
+            *localBlocksize = Int(value);
+        }
+    }
+}
+
+double TunedParameter
+( const string& kernel, const string& param, const string& typeName,
+  Int gridHeight, Int gridWidth, double defaultValue )
+{
+    auto it = ::tunedParameters.find
+      ( TuningKey(kernel,param,typeName,gridHeight,gridWidth) );
+    return ( it == ::tunedParameters.end() ? defaultValue : it->second );
+}
+
+bool HaveTunedParameters()
+{ return !::tunedParameters.empty(); }
+
+void ClearTunedParameters()
+{
+    for( const auto& entry : ::overriddenLocalBlocksizes )
+        *::LocalBlocksize( entry.first.first, entry.first.second ) =
+          entry.second;
+    ::overriddenLocalBlocksizes.clear();
+    ::tunedParameters.clear();
+}
+
+Int TunedBlocksize
+( const string& kernel, const string& typeName,
+  Int gridHeight, Int gridWidth )
+{
+    if( ::tunedParameters.empty() )
+        return Blocksize();
+    return Int(TunedParameter
+      (kernel,"blocksize",typeName,gridHeight,gridWidth,double(Blocksize())));
+}
+
+// Each (non-comment) line of a profile has the form
+//
+//   kernel parameter datatype gridHeight gridWidth value
+//
+void LoadTuningProfile( const string& filename )
+{
+    EL_DEBUG_CSE
+    std::ifstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open tuning profile ",filename);
+    string line;
+    Int lineNumber = 0;
+    while( std::getline( file, line ) )
+    {
+        ++lineNumber;
+        const auto first = line.find_first_not_of(" \t");
+        if( first == string::npos || line[first] == '#' )
+            continue;
+        std::istringstream lineStream( line );
+        string kernel, param, typeName;
+        Int gridHeight, gridWidth;
+        double value;
+        if( !(lineStream >> kernel >> param >> typeName >>
+              gridHeight >> gridWidth >> value) )
+            RuntimeError
+            ("Could not parse line ",lineNumber," of tuning profile ",
+             filename);
+        SetTunedParameter
+        ( kernel, param, typeName, gridHeight, gridWidth, value );
+    }
+}
+
+void SaveTuningProfile( const string& filename )
+{
+    EL_DEBUG_CSE
+    std::ofstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename," for writing");
+    file << "# Elemental tuning profile\n"
+         << "# kernel parameter datatype gridHeight gridWidth value\n";
+    // Reloading the profile must reproduce the tuned values exactly
+    file << std::setprecision( std::numeric_limits<double>::max_digits10 );
+    for( const auto& entry : ::tunedParameters )
+    {
+        const auto& key = entry.first;
+        file << std::get<0>(key) << " " << std::get<1>(key) << " "
+             << std::get<2>(key) << " " << std::get<3>(key) << " "
+             << std::get<4>(key) << " " << entry.second << "\n";
+    }
+}
+
 #define PROTO(T) \
   template void SetLocalSymvBlocksize<T>( Int blocksize ); \
   template Int LocalSymvBlocksize<T>(); \
@@ -0,0 +1,180 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BATCHED_UTIL_HPP
+#define EL_BATCHED_UTIL_HPP
+
+// Utilities shared by the batched kernels. Small problems are processed in
+// groups of INTERLEAVE_WIDTH whose entries are interleaved, i.e., entry (i,j)
+// of the l'th problem of a group is stored at buf[(i+j*height)*width+l], so
+// that the innermost loops of the unblocked kernels run across the batch
+// (and vectorize). Groups are distributed over OpenMP threads.
+
+namespace El {
+namespace batched {
+
+constexpr Int INTERLEAVE_WIDTH = 8;
+
+// Problems with a dimension larger than this are handled one at a time by the
+// standard (blocked) sequential routines
+constexpr Int INTERLEAVE_CUTOFF = 32;
+
+// Views of the batchSize equally-sized problems stored side by side in the
+// columns of A
+template<typename T>
+vector<Matrix<T>> StridedViews( Matrix<T>& A, Int batchSize )
+{
+    EL_DEBUG_CSE
+    if( batchSize < 0 || (batchSize == 0 && A.Width() != 0) ||
+        (batchSize > 0 && A.Width() % batchSize != 0) )
+        LogicError
+        ("Width of ",A.Width()," is not a multiple of the batch size ",
+         batchSize);
+    const Int width = ( batchSize == 0 ? 0 : A.Width()/batchSize );
+    vector<Matrix<T>> views( batchSize );
+    for( Int b=0; b<batchSize; ++b )
+        View( views[b], A, ALL, IR(b*width,(b+1)*width) );
+    return views;
+}
+
+template<typename T>
+vector<Matrix<T>> LockedStridedViews( const Matrix<T>& A, Int batchSize )
+{
+    EL_DEBUG_CSE
+    if( batchSize < 0 || (batchSize == 0 && A.Width() != 0) ||
+        (batchSize > 0 && A.Width() % batchSize != 0) )
+        LogicError
+        ("Width of ",A.Width()," is not a multiple of the batch size ",
+         batchSize);
+    const Int width = ( batchSize == 0 ? 0 : A.Width()/batchSize );
+    vector<Matrix<T>> views( batchSize );
+    for( Int b=0; b<batchSize; ++b )
+        LockedView( views[b], A, ALL, IR(b*width,(b+1)*width) );
+    return views;
+}
+
+// Whether the problems [offset,offset+numLanes) all have the same dimensions
+template<typename T>
+bool SameSizes
+( const vector<Matrix<T>>& A, Int offset, Int numLanes )
+{
+    const Int m = A[offset].Height();
+    const Int n = A[offset].Width();
+    for( Int l=1; l<numLanes; ++l )
+        if( A[offset+l].Height() != m || A[offset+l].Width() != n )
+            return false;
+    return true;
+}
+
+// Whether the problems [offset,offset+numLanes) all have the same dimensions
+// and are small enough to be interleaved
+template<typename T>
+bool Interleavable
+( const vector<Matrix<T>>& A, Int offset, Int numLanes )
+{
+    return A[offset].Height() <= INTERLEAVE_CUTOFF &&
+           A[offset].Width() <= INTERLEAVE_CUTOFF &&
+           SameSizes( A, offset, numLanes );
+}
+
+// Interleave op(A[offset+l]) for l in [0,numLanes), where the remaining
+// lanes are padded with 'diagPad' times the identity (so that the padding
+// of square factorizations is trivially well-posed)
+template<typename T>
+void Interleave
+(       Orientation orientation,
+  const vector<Matrix<T>>& A,
+        Int offset,
+        Int numLanes,
+        vector<T>& buf,
+        T diagPad=T(0) )
+{
+    const Int W = INTERLEAVE_WIDTH;
+    const bool normal = ( orientation == NORMAL );
+    const bool conjugate = ( orientation == ADJOINT );
+    const Matrix<T>& A0 = A[offset];
+    const Int m = ( normal ? A0.Height() : A0.Width() );
+    const Int n = ( normal ? A0.Width() : A0.Height() );
+    buf.resize( m*n*W );
+    for( Int l=0; l<numLanes; ++l )
+    {
+        const Matrix<T>& AL = A[offset+l];
+        const T* ABuf = AL.LockedBuffer();
+        const Int ALDim = AL.LDim();
+        for( Int j=0; j<n; ++j )
+            for( Int i=0; i<m; ++i )
+            {
+                const T alpha = ( normal ? ABuf[i+j*ALDim] : ABuf[j+i*ALDim] );
+                buf[(i+j*m)*W+l] = ( conjugate ? Conj(alpha) : alpha );
+            }
+    }
+    for( Int l=numLanes; l<W; ++l )
+        for( Int j=0; j<n; ++j )
+            for( Int i=0; i<m; ++i )
+                buf[(i+j*m)*W+l] = ( i == j ? diagPad : T(0) );
+}
+
+// The inverse of Interleave (with padded lanes discarded)
+template<typename T>
+void Deinterleave
+(       Orientation orientation,
+  const vector<T>& buf,
+        vector<Matrix<T>>& A,
+        Int offset,
+        Int numLanes )
+{
+    const Int W = INTERLEAVE_WIDTH;
+    const bool normal = ( orientation == NORMAL );
+    const bool conjugate = ( orientation == ADJOINT );
+    const Matrix<T>& A0 = A[offset];
+    const Int m = ( normal ? A0.Height() : A0.Width() );
+    const Int n = ( normal ? A0.Width() : A0.Height() );
+    for( Int l=0; l<numLanes; ++l )
+    {
+        Matrix<T>& AL = A[offset+l];
+        T* ABuf = AL.Buffer();
+        const Int ALDim = AL.LDim();
+        for( Int j=0; j<n; ++j )
+            for( Int i=0; i<m; ++i )
+            {
+                const T alpha = buf[(i+j*m)*W+l];
+                T& target = ( normal ? ABuf[i+j*ALDim] : ABuf[j+i*ALDim] );
+                target = ( conjugate ? Conj(alpha) : alpha );
+            }
+    }
+}
+
+// Exceptions cannot propagate out of the (OpenMP) loop over the groups, so
+// any exception other than the failure of an individual problem is stored
+// and the first is rethrown once the entire batch has been processed
+inline void RethrowErrors( const vector<std::exception_ptr>& errors )
+{
+    for( const auto& error : errors )
+        if( error )
+            std::rethrow_exception( error );
+}
+
+// Throw an exception of the given type if any of the problems failed
+template<class ExceptionType>
+void ReportFailures( const vector<Int>& failed, const string& description )
+{
+    const Int numFailed = std::count( failed.begin(), failed.end(), Int(1) );
+    if( numFailed == 0 )
+        return;
+    ostringstream msg;
+    msg << numFailed << " of the " << failed.size() << " problems "
+        << description << " (the first was problem "
+        << (std::find(failed.begin(),failed.end(),Int(1))-failed.begin())
+        << ")";
+    throw ExceptionType( msg.str().c_str() );
+}
+
+} // namespace batched
+} // namespace El
+
+#endif // ifndef EL_BATCHED_UTIL_HPP
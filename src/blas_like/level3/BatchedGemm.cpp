@@ -0,0 +1,146 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level3.hpp>
+
+#include "./Batched/Util.hpp"
+
+namespace El {
+
+namespace batched {
+
+// C := alpha A B + beta C for interleaved m x k A, k x n B, and m x n C
+template<typename T>
+void InterleavedGemm
+( Int m, Int n, Int k,
+  T alpha, const vector<T>& A, const vector<T>& B,
+  T beta,        vector<T>& C )
+{
+    const Int W = INTERLEAVE_WIDTH;
+    T acc[INTERLEAVE_WIDTH];
+    for( Int j=0; j<n; ++j )
+    {
+        for( Int i=0; i<m; ++i )
+        {
+            for( Int l=0; l<W; ++l )
+                acc[l] = T(0);
+            for( Int p=0; p<k; ++p )
+            {
+                const T* a = &A[(i+p*m)*W];
+                const T* b = &B[(p+j*k)*W];
+                EL_SIMD
+                for( Int l=0; l<W; ++l )
+                    acc[l] += a[l]*b[l];
+            }
+            T* c = &C[(i+j*m)*W];
+            if( beta == T(0) )
+            {
+                EL_SIMD
+                for( Int l=0; l<W; ++l )
+                    c[l] = alpha*acc[l];
+            }
+            else
+            {
+                EL_SIMD
+                for( Int l=0; l<W; ++l )
+                    c[l] = alpha*acc[l] + beta*c[l];
+            }
+        }
+    }
+}
+
+} // namespace batched
+
+template<typename T>
+void BatchedGemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const vector<Matrix<T>>& A, const vector<Matrix<T>>& B,
+  T beta,        vector<Matrix<T>>& C )
+{
+    EL_DEBUG_CSE
+    const Int batchSize = C.size();
+    if( Int(A.size()) != batchSize || Int(B.size()) != batchSize )
+        LogicError("A, B, and C must have the same batch size");
+    // Check conformality up front since the problems are processed within an
+    // OpenMP parallel region
+    for( Int b=0; b<batchSize; ++b )
+    {
+        const Int mA = ( orientA == NORMAL ? A[b].Height() : A[b].Width() );
+        const Int kA = ( orientA == NORMAL ? A[b].Width() : A[b].Height() );
+        const Int kB = ( orientB == NORMAL ? B[b].Height() : B[b].Width() );
+        const Int nB = ( orientB == NORMAL ? B[b].Width() : B[b].Height() );
+        if( mA != C[b].Height() || nB != C[b].Width() || kA != kB )
+            LogicError("Nonconformal BatchedGemm for problem ",b);
+    }
+
+    const Int W = batched::INTERLEAVE_WIDTH;
+    const Int numGroups = (batchSize+W-1)/W;
+    EL_PARALLEL_FOR
+    for( Int group=0; group<numGroups; ++group )
+    {
+        const Int offset = group*W;
+        const Int numLanes = Min(W,batchSize-offset);
+        const Int m = C[offset].Height();
+        const Int n = C[offset].Width();
+        const Int k =
+          ( orientA == NORMAL ? A[offset].Width() : A[offset].Height() );
+        const bool interleave =
+          batched::Interleavable( A, offset, numLanes ) &&
+          batched::Interleavable( B, offset, numLanes ) &&
+          batched::Interleavable( C, offset, numLanes );
+        if( interleave )
+        {
+            vector<T> ABuf, BBuf, CBuf;
+            batched::Interleave( orientA, A, offset, numLanes, ABuf );
+            batched::Interleave( orientB, B, offset, numLanes, BBuf );
+            batched::Interleave( NORMAL, C, offset, numLanes, CBuf );
+            batched::InterleavedGemm( m, n, k, alpha, ABuf, BBuf, beta, CBuf );
+            batched::Deinterleave( NORMAL, CBuf, C, offset, numLanes );
+        }
+        else
+        {
+            for( Int b=offset; b<offset+numLanes; ++b )
+                Gemm( orientA, orientB, alpha, A[b], B[b], beta, C[b] );
+        }
+    }
+}
+
+template<typename T>
+void BatchedGemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const Matrix<T>& A, const Matrix<T>& B,
+  T beta,        Matrix<T>& C,
+  Int batchSize )
+{
+    EL_DEBUG_CSE
+    auto AViews = batched::LockedStridedViews( A, batchSize );
+    auto BViews = batched::LockedStridedViews( B, batchSize );
+    auto CViews = batched::StridedViews( C, batchSize );
+    BatchedGemm( orientA, orientB, alpha, AViews, BViews, beta, CViews );
+}
+
+#define PROTO(T) \
+  template void BatchedGemm \
+  ( Orientation orientA, Orientation orientB, \
+    T alpha, const vector<Matrix<T>>& A, const vector<Matrix<T>>& B, \
+    T beta,        vector<Matrix<T>>& C ); \
+  template void BatchedGemm \
+  ( Orientation orientA, Orientation orientB, \
+    T alpha, const Matrix<T>& A, const Matrix<T>& B, \
+    T beta,        Matrix<T>& C, \
+    Int batchSize );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
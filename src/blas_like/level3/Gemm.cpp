@@ -7,8 +7,15 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El-lite.hpp>
+#include <El/blas_like/level1/Copy/util.hpp>
 #include <El/blas_like/level3.hpp>
 
+#ifndef _WIN32
+# include <unistd.h>
+#endif
+
+#include "./Gemm/Pipelined.hpp"
+#include "./Gemm/25D.hpp"
 #include "./Gemm/NN.hpp"
 #include "./Gemm/NT.hpp"
 #include "./Gemm/TN.hpp"
@@ -95,8 +102,13 @@ void Gemm
   GemmAlgorithm alg )
 {
     EL_DEBUG_CSE
+    BlocksizeScope blocksizeScope( TunedBlocksize<T>( "Gemm", C.Grid() ) );
     C *= beta;
-    if( orientA == NORMAL && orientB == NORMAL )
+    if( alg == GEMM_25D )
+    {
+        gemm::SUMMA25D( orientA, orientB, alpha, A, B, C );
+    }
+    else if( orientA == NORMAL && orientB == NORMAL )
     {
         if( alg == GEMM_CANNON )
             gemm::Cannon_NN( alpha, A, B, C );
@@ -0,0 +1,207 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace gemm {
+
+// The number of bytes each process may devote to the layered copies of a
+// 2.5D Gemm. Unless a limit was explicitly set, this is the free physical
+// memory of each node divided evenly among the processes sharing it.
+inline double MemoryPerProcess25D( const Grid& g )
+{
+    EL_DEBUG_CSE
+    double numBytes = Gemm25DMemoryLimit();
+    if( numBytes <= 0 )
+    {
+        numBytes = 1024.*1024.*1024.;
+#if defined(_SC_AVPHYS_PAGES) && defined(_SC_PAGESIZE)
+        const long numPages = sysconf( _SC_AVPHYS_PAGES );
+        const long pageSize = sysconf( _SC_PAGESIZE );
+        if( numPages > 0 && pageSize > 0 )
+            numBytes = double(numPages)*double(pageSize);
+#endif
+        numBytes /= mpi::Size( g.NodeComm() );
+    }
+    // Every process must agree upon the number of layers
+    return mpi::AllReduce( numBytes, mpi::MIN, g.ViewingComm() );
+}
+
+// Choose the number of layers, c, for a 2.5D Gemm over a grid of p processes.
+// Each layer holds its own partial copy of C, so the memory usage grows
+// linearly with c, while the bandwidth cost of the panel broadcasts shrinks
+// like 1/sqrt(c) until the final reduction of C dominates at c ~ p^{1/3}.
+// We therefore pick the largest divisor of p which is at most p^{1/3} and
+// whose layered copies fit within the per-process memory budget.
+template<typename T>
+Int NumLayers25D( Int m, Int n, Int sumDim, const Grid& g )
+{
+    EL_DEBUG_CSE
+    const Int p = g.Size();
+    const Int requested = Gemm25DLayers();
+    if( requested > 0 )
+    {
+        if( p % requested != 0 )
+            LogicError
+            ("Number of 2.5D layers, ",requested,
+             ", does not evenly divide the grid size, ",p);
+        return requested;
+    }
+
+    Int maxLayers = Int(std::cbrt(double(p))+0.5);
+    while( maxLayers*maxLayers*maxLayers > p )
+        --maxLayers;
+    // Each layer should receive at least one block of the summation dimension
+    maxLayers = Min( maxLayers, Max(sumDim/Blocksize(),Int(1)) );
+    if( maxLayers <= 1 )
+        return 1;
+
+    const double memory = MemoryPerProcess25D( g );
+    const double entrySize = sizeof(T);
+    for( Int numLayers=maxLayers; numLayers>1; --numLayers )
+    {
+        if( p % numLayers != 0 )
+            continue;
+        // The slices of A and B are spread over all p processes, whereas each
+        // layer's partial copy of C is spread over only p/c processes
+        const double required =
+          entrySize*(double(m)*sumDim + double(sumDim)*n +
+                     double(numLayers)*m*n) / p;
+        if( required <= memory )
+            return numLayers;
+    }
+    return 1;
+}
+
+// A 2.5D Gemm in the spirit of Solomonik and Demmel: the p processes of C's
+// grid are split into c layers, each of which is a 2D grid of p/c processes.
+// Layer l receives the l'th slice of the summation dimension of op(A) and
+// op(B) -- which, since A and B start out spread over all p processes, is the
+// only portion of their replicas which it would ever touch -- and runs a
+// standard SUMMA over its own grid. The c partial products are then reduced
+// onto the first layer and redistributed back into C.
+template<typename T>
+void SUMMA25D
+( Orientation orientA,
+  Orientation orientB,
+  T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& BPre,
+        AbstractDistMatrix<T>& CPre )
+{
+    EL_DEBUG_CSE
+    const Int m = CPre.Height();
+    const Int n = CPre.Width();
+    const Int sumDim = ( orientA==NORMAL ? APre.Width() : APre.Height() );
+    const Grid& g = CPre.Grid();
+    const Int numLayers = NumLayers25D<T>( m, n, sumDim, g );
+    // An explicitly requested single layer still runs through the layered
+    // algorithm (which is otherwise only reachable with multiple processes)
+    if( numLayers == 1 && Gemm25DLayers() == 0 )
+    {
+        Gemm( orientA, orientB, alpha, APre, BPre, T(1), CPre, GEMM_DEFAULT );
+        return;
+    }
+
+    DistMatrixReadProxy<T,T,MC,MR> AProx( APre ), BProx( BPre );
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+    auto& C = CProx.Get();
+
+    // Layer l is owned by ranks [l*p/c,(l+1)*p/c) of the owning group of C's
+    // grid. Every viewer of that grid also views each layer so that data can
+    // be translated between them.
+    const int layerSize = g.Size() / numLayers;
+    const auto& layerGrids = g.LayerGrids( numLayers );
+    const Int layer = ( g.InGrid() ? g.OwningRank() / layerSize : -1 );
+    const Grid& layerGrid = *layerGrids[Max(layer,Int(0))];
+
+    // Hand each layer its slice of the summation dimension
+    DistMatrix<T> ALayer(layerGrid), BLayer(layerGrid);
+    DistMatrix<T> ASlice(g), BSlice(g);
+    for( Int l=0; l<numLayers; ++l )
+    {
+        const Range<Int> K( (l*sumDim)/numLayers, ((l+1)*sumDim)/numLayers );
+        if( orientA == NORMAL )
+            LockedView( ASlice, A, IR(0,m), K );
+        else
+            LockedView( ASlice, A, K, IR(0,m) );
+        if( orientB == NORMAL )
+            LockedView( BSlice, B, K, IR(0,n) );
+        else
+            LockedView( BSlice, B, IR(0,n), K );
+        if( l == layer )
+        {
+            ALayer = ASlice;
+            BLayer = BSlice;
+        }
+        else
+        {
+            DistMatrix<T> AOther(*layerGrids[l]), BOther(*layerGrids[l]);
+            AOther = ASlice;
+            BOther = BSlice;
+        }
+    }
+
+    // Form each layer's contribution and sum them onto the first layer.
+    // Since rank r of every layer owns the same portion of its partial
+    // product, the local buffers can be reduced directly.
+    DistMatrix<T> CLayer(layerGrid);
+    CLayer.Resize( m, n );
+    if( layer >= 0 )
+    {
+        Zero( CLayer );
+        Gemm
+        ( orientA, orientB, alpha, ALayer, BLayer, T(0), CLayer,
+          GEMM_DEFAULT );
+        ALayer.Empty();
+        BLayer.Empty();
+
+        const mpi::Comm depthComm = g.LayerDepthComm( numLayers );
+        const Int localHeight = CLayer.LocalHeight();
+        const Int localWidth = CLayer.LocalWidth();
+        if( localHeight == CLayer.LDim() )
+        {
+            mpi::Reduce( CLayer.Buffer(), localHeight*localWidth, 0, depthComm );
+        }
+        else
+        {
+            vector<T> buf;
+            FastResize( buf, localHeight*localWidth );
+            copy::util::InterleaveMatrix
+            ( localHeight, localWidth,
+              CLayer.LockedBuffer(), 1, CLayer.LDim(),
+              buf.data(),            1, localHeight );
+            mpi::Reduce( buf.data(), localHeight*localWidth, 0, depthComm );
+            copy::util::InterleaveMatrix
+            ( localHeight, localWidth,
+              buf.data(),      1, localHeight,
+              CLayer.Buffer(), 1, CLayer.LDim() );
+        }
+    }
+
+    // C += the summed contributions stored on the first layer
+    DistMatrix<T> CSum(g);
+    CSum.AlignWith( C );
+    if( layer == 0 )
+    {
+        CSum = CLayer;
+    }
+    else
+    {
+        DistMatrix<T> CFirst(*layerGrids[0]);
+        CFirst.Resize( m, n );
+        CSum = CFirst;
+    }
+    if( C.Participating() )
+        Axpy( T(1), CSum.LockedMatrix(), C.Matrix() );
+}
+
+} // namespace gemm
+} // namespace El
@@ -293,11 +293,10 @@ void SUMMA_NN
     const Int m = C.Height();
     const Int n = C.Width();
     const Int sumDim = A.Width();
-    const double weightTowardsC = 2.;
-    const double weightAwayFromDot = 10.;
-
-    // TODO(poulson): Make this tunable
-    const Int blockSizeDot = 2000;
+    const GemmHeuristics heuristics = TunedGemmHeuristics<T>( C.Grid() );
+    const double weightTowardsC = heuristics.weightTowardsC;
+    const double weightAwayFromDot = heuristics.weightAwayFromDot;
+    const Int blockSizeDot = heuristics.dotBlocksize;
 
     switch( alg )
     {
@@ -315,6 +314,7 @@ void SUMMA_NN
     case GEMM_SUMMA_B:   SUMMA_NNB( alpha, A, B, C ); break;
     case GEMM_SUMMA_C:   SUMMA_NNC( alpha, A, B, C ); break;
     case GEMM_SUMMA_DOT: SUMMA_NNDot( alpha, A, B, C, blockSizeDot ); break;
+    case GEMM_SUMMA_PIPELINED: SUMMA_NNCPipelined( alpha, A, B, C ); break;
     default: LogicError("Unsupported Gemm option");
     }
 }
@@ -227,11 +227,10 @@ void SUMMA_NT
     const Int m = C.Height();
     const Int n = C.Width();
     const Int sumDim = A.Width();
-    const double weightTowardsC = 2.;
-    const double weightAwayFromDot = 10.;
-
-    // TODO(poulson): Make this tunable
-    const Int blockSizeDot = 2000;
+    const GemmHeuristics heuristics = TunedGemmHeuristics<T>( C.Grid() );
+    const double weightTowardsC = heuristics.weightTowardsC;
+    const double weightAwayFromDot = heuristics.weightAwayFromDot;
+    const Int blockSizeDot = heuristics.dotBlocksize;
 
     switch( alg )
     {
@@ -248,7 +247,12 @@ void SUMMA_NT
     case GEMM_SUMMA_A: SUMMA_NTA( orientB, alpha, A, B, C ); break;
     case GEMM_SUMMA_B: SUMMA_NTB( orientB, alpha, A, B, C ); break;
     case GEMM_SUMMA_C: SUMMA_NTC( orientB, alpha, A, B, C ); break;
-    case GEMM_SUMMA_DOT: SUMMA_NTDot( orientB, alpha, A, B, C ); break;
+    case GEMM_SUMMA_DOT:
+        SUMMA_NTDot( orientB, alpha, A, B, C, blockSizeDot );
+        break;
+    case GEMM_SUMMA_PIPELINED:
+        SUMMA_Pipelined( NORMAL, orientB, alpha, A, B, C );
+        break;
     default: LogicError("Unsupported Gemm option");
     }
 }
@@ -0,0 +1,184 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace gemm {
+
+// The communication buffers for a single panel of a pipelined SUMMA.
+// Two of these are kept live so that the AllGathers for panel k+1 may be
+// posted before the local update for panel k begins.
+template<typename T>
+struct PipelinedPanel
+{
+    Int offset=0, width=0;
+    Int portionSizeA=0, portionSizeB=0;
+    vector<T> bufferA, bufferB;
+    mpi::Request<T> requestA, requestB;
+};
+
+// Pack the local portions of A(:,k:k+nb) and B(k:k+nb,:) and post
+// non-blocking AllGathers over the process rows and columns, respectively
+template<typename T>
+void StartPipelinedPanel
+( const DistMatrix<T>& A,
+  const DistMatrix<T>& B,
+  Int k, Int nb,
+  PipelinedPanel<T>& panel )
+{
+    EL_DEBUG_CSE
+    panel.offset = k;
+    panel.width = nb;
+
+    auto A1 = A( ALL, IR(k,k+nb) );
+    const Int rowStride = A1.RowStride();
+    const Int localHeight = A1.LocalHeight();
+    panel.portionSizeA = mpi::Pad( localHeight*MaxLength(nb,rowStride) );
+    FastResize( panel.bufferA, (rowStride+1)*panel.portionSizeA );
+    T* sendBufA = &panel.bufferA[0];
+    T* recvBufA = &panel.bufferA[panel.portionSizeA];
+    copy::util::InterleaveMatrix
+    ( localHeight, A1.LocalWidth(),
+      A1.LockedBuffer(), 1, A1.LDim(),
+      sendBufA,          1, localHeight );
+    mpi::IAllGather
+    ( sendBufA, panel.portionSizeA, recvBufA, panel.portionSizeA,
+      A1.RowComm(), panel.requestA );
+
+    auto B1 = B( IR(k,k+nb), ALL );
+    const Int colStride = B1.ColStride();
+    const Int localWidth = B1.LocalWidth();
+    panel.portionSizeB = mpi::Pad( MaxLength(nb,colStride)*localWidth );
+    FastResize( panel.bufferB, (colStride+1)*panel.portionSizeB );
+    T* sendBufB = &panel.bufferB[0];
+    T* recvBufB = &panel.bufferB[panel.portionSizeB];
+    const Int localHeightB = B1.LocalHeight();
+    copy::util::InterleaveMatrix
+    ( localHeightB, localWidth,
+      B1.LockedBuffer(), 1, B1.LDim(),
+      sendBufB,          1, localHeightB );
+    mpi::IAllGather
+    ( sendBufB, panel.portionSizeB, recvBufB, panel.portionSizeB,
+      B1.ColComm(), panel.requestB );
+}
+
+// Wait on the AllGathers for a panel and unpack the results into
+// A1[MC,*] and B1[*,MR]
+template<typename T>
+void FinishPipelinedPanel
+( const DistMatrix<T>& A,
+  const DistMatrix<T>& B,
+  PipelinedPanel<T>& panel,
+  Matrix<T>& A1_MC_STAR,
+  Matrix<T>& B1_STAR_MR )
+{
+    EL_DEBUG_CSE
+    const Int k = panel.offset;
+    const Int nb = panel.width;
+
+    auto A1 = A( ALL, IR(k,k+nb) );
+    const Int localHeight = A1.LocalHeight();
+    mpi::Wait( panel.requestA );
+    A1_MC_STAR.Resize( localHeight, nb );
+    copy::util::RowStridedUnpack
+    ( localHeight, nb, A1.RowAlign(), A1.RowStride(),
+      &panel.bufferA[panel.portionSizeA], panel.portionSizeA,
+      A1_MC_STAR.Buffer(), A1_MC_STAR.LDim() );
+
+    auto B1 = B( IR(k,k+nb), ALL );
+    const Int localWidth = B1.LocalWidth();
+    mpi::Wait( panel.requestB );
+    B1_STAR_MR.Resize( nb, localWidth );
+    copy::util::ColStridedUnpack
+    ( nb, localWidth, B1.ColAlign(), B1.ColStride(),
+      &panel.bufferB[panel.portionSizeB], panel.portionSizeB,
+      B1_STAR_MR.Buffer(), B1_STAR_MR.LDim() );
+}
+
+// Normal Normal Gemm that avoids communicating the matrix C and overlaps
+// the AllGathers of each pair of panels of A and B with the local update
+// from the previous pair
+template<typename T>
+void SUMMA_NNCPipelined
+( T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& BPre,
+        AbstractDistMatrix<T>& CPre )
+{
+    EL_DEBUG_CSE
+    const Int sumDim = APre.Width();
+    const Int bsize = Blocksize();
+
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
+    auto& C = CProx.Get();
+
+    // Force A's rows and B's columns to be aligned with those of C so that
+    // the gathered panels can be used directly in the local update
+    ElementalProxyCtrl ctrlA, ctrlB;
+    ctrlA.colConstrain = true; ctrlA.colAlign = C.ColAlign();
+    ctrlB.rowConstrain = true; ctrlB.rowAlign = C.RowAlign();
+
+    DistMatrixReadProxy<T,T,MC,MR> AProx( APre, ctrlA );
+    DistMatrixReadProxy<T,T,MC,MR> BProx( BPre, ctrlB );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+
+    if( !C.Participating() || sumDim == 0 )
+        return;
+
+    // Double-buffered panel storage
+    PipelinedPanel<T> panels[2];
+    Matrix<T> A1_MC_STAR, B1_STAR_MR;
+
+    Int stage = 0;
+    StartPipelinedPanel( A, B, 0, Min(bsize,sumDim), panels[0] );
+    for( Int k=0; k<sumDim; k+=bsize )
+    {
+        const Int nb = Min(bsize,sumDim-k);
+        if( k+nb < sumDim )
+        {
+            const Int nbNext = Min(bsize,sumDim-(k+nb));
+            StartPipelinedPanel( A, B, k+nb, nbNext, panels[1-stage] );
+        }
+
+        // C[MC,MR] += alpha A1[MC,*] B1[*,MR]
+        FinishPipelinedPanel( A, B, panels[stage], A1_MC_STAR, B1_STAR_MR );
+        Gemm
+        ( NORMAL, NORMAL,
+          alpha, A1_MC_STAR, B1_STAR_MR, T(1), C.Matrix() );
+
+        stage = 1-stage;
+    }
+}
+
+// Form op(A) and/or op(B) explicitly as [MC,MR] matrices and then run the
+// pipelined Normal Normal algorithm. The single (conjugate-)transposition
+// costs no more than a single panel sweep of the Normal Normal algorithm.
+template<typename T>
+void SUMMA_Pipelined
+( Orientation orientA,
+  Orientation orientB,
+  T alpha,
+  const AbstractDistMatrix<T>& A,
+  const AbstractDistMatrix<T>& B,
+        AbstractDistMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    const Grid& g = A.Grid();
+    DistMatrix<T> AOp(g), BOp(g);
+    if( orientA != NORMAL )
+        Transpose( A, AOp, orientA==ADJOINT );
+    if( orientB != NORMAL )
+        Transpose( B, BOp, orientB==ADJOINT );
+    const AbstractDistMatrix<T>& AEff = ( orientA==NORMAL ? A : AOp );
+    const AbstractDistMatrix<T>& BEff = ( orientB==NORMAL ? B : BOp );
+    SUMMA_NNCPipelined( alpha, AEff, BEff, C );
+}
+
+} // namespace gemm
+} // namespace El
@@ -222,11 +222,10 @@ void SUMMA_TN
     const Int m = C.Height();
     const Int n = C.Width();
     const Int sumDim = A.Height();
-    const double weightTowardsC = 2.;
-    const double weightAwayFromDot = 10.;
-
-    // TODO(poulson): Make this tunable
-    const Int blockSizeDot = 2000;
+    const GemmHeuristics heuristics = TunedGemmHeuristics<T>( C.Grid() );
+    const double weightTowardsC = heuristics.weightTowardsC;
+    const double weightAwayFromDot = heuristics.weightAwayFromDot;
+    const Int blockSizeDot = heuristics.dotBlocksize;
 
     switch( alg )
     {
@@ -243,7 +242,12 @@ void SUMMA_TN
     case GEMM_SUMMA_A: SUMMA_TNA( orientA, alpha, A, B, C ); break;
     case GEMM_SUMMA_B: SUMMA_TNB( orientA, alpha, A, B, C ); break;
     case GEMM_SUMMA_C: SUMMA_TNC( orientA, alpha, A, B, C ); break;
-    case GEMM_SUMMA_DOT: SUMMA_TNDot( orientA, alpha, A, B, C ); break;
+    case GEMM_SUMMA_DOT:
+        SUMMA_TNDot( orientA, alpha, A, B, C, blockSizeDot );
+        break;
+    case GEMM_SUMMA_PIPELINED:
+        SUMMA_Pipelined( orientA, NORMAL, alpha, A, B, C );
+        break;
     default: LogicError("Unsupported Gemm option");
     }
 }
@@ -239,11 +239,10 @@ void SUMMA_TT
     const Int m = C.Height();
     const Int n = C.Width();
     const Int sumDim = A.Height();
-    const double weightTowardsC = 2.;
-    const double weightAwayFromDot = 10.;
-
-    // TODO(poulson): Make this tunable
-    const Int blockSizeDot = 2000;
+    const GemmHeuristics heuristics = TunedGemmHeuristics<T>( C.Grid() );
+    const double weightTowardsC = heuristics.weightTowardsC;
+    const double weightAwayFromDot = heuristics.weightAwayFromDot;
+    const Int blockSizeDot = heuristics.dotBlocksize;
 
     switch( alg )
     {
@@ -267,7 +266,10 @@ void SUMMA_TT
         SUMMA_TTC( orientA, orientB, alpha, A, B, C );
         break;
     case GEMM_SUMMA_DOT:
-        SUMMA_TTDot( orientA, orientB, alpha, A, B, C );
+        SUMMA_TTDot( orientA, orientB, alpha, A, B, C, blockSizeDot );
+        break;
+    case GEMM_SUMMA_PIPELINED:
+        SUMMA_Pipelined( orientA, orientB, alpha, A, B, C );
         break;
     default: LogicError("Unsupported Gemm option");
     }
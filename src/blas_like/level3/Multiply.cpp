@@ -14,50 +14,181 @@
 namespace El {
 
 namespace {
-/**
- * MultiplyCSR specialization where the CSR matrix happens to have all nonzeros = 1.
- */
+
+// The kernels below are templated over an accessor for the nonzero values so
+// that pattern-only matrices (Graph), whose nonzeros are implicitly one, can
+// share them with SparseMatrix
 template<typename T>
-void MultiplyCSR
+struct ExplicitValues
+{
+    const T* values;
+    bool conjugate;
+
+    T operator()( Int e ) const
+    { return conjugate ? Conj(values[e]) : values[e]; }
+};
+
+template<typename T>
+struct UnitValues
+{
+    T operator()( Int e ) const { return T(1); }
+};
+
+// The number of right-hand sides which each row of A is applied to at once
+const Int rhsBlocksize = 8;
+
+// The largest supported SELL-C-sigma chunk size
+const Int maxSellChunkSize = 32;
+
+// Run scatter(itemBeg,itemEnd,Z,zRowStride,zColStride), which accumulates the
+// contributions of the items [itemBeg,itemEnd) into the height x numRHS
+// matrix Z, over all of the items. Since different items may update the same
+// entries of Y, each thread accumulates into a private, zero-initialized
+// copy of Y, and the copies are then summed into Y in parallel over its rows.
+// The private copies are only used when there is enough work to amortize them.
+template<typename T,class Scatter>
+void ParallelScatter
+( Int numItems, Int numNonzeros, Int height, Int numRHS,
+  T* Y, Int yRowStride, Int yColStride,
+  const Scatter& scatter )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HYBRID
+    const Int maxThreads = omp_get_max_threads();
+    if( maxThreads > 1 && !omp_in_parallel() && height > 0 && numRHS > 0 &&
+        numNonzeros >= maxThreads*height )
+    {
+        const Int partialSize = height*numRHS;
+        Matrix<T> partials( partialSize, maxThreads );
+        T* partialBuf = partials.Buffer();
+        const Int partialLDim = partials.LDim();
+        Int numThreads = maxThreads;
+        #pragma omp parallel num_threads(maxThreads)
+        {
+            const Int thread = omp_get_thread_num();
+            const Int teamSize = omp_get_num_threads();
+            if( thread == 0 )
+                numThreads = teamSize;
+            T* Z = &partialBuf[thread*partialLDim];
+            for( Int s=0; s<partialSize; ++s )
+                Z[s] = 0;
+            const Int itemsPerThread = (numItems+teamSize-1) / teamSize;
+            const Int itemBeg = Min(thread*itemsPerThread,numItems);
+            const Int itemEnd = Min(itemBeg+itemsPerThread,numItems);
+            scatter( itemBeg, itemEnd, Z, 1, height );
+        }
+        EL_PARALLEL_FOR
+        for( Int i=0; i<height; ++i )
+            for( Int k=0; k<numRHS; ++k )
+                for( Int t=0; t<numThreads; ++t )
+                    Y[i*yRowStride+k*yColStride] +=
+                      partialBuf[i+k*height+t*partialLDim];
+        return;
+    }
+#endif
+    scatter( 0, numItems, Y, yRowStride, yColStride );
+}
+
+// Y += alpha op(A) X, where the rows of A are restricted to the entries
+// [entryBeg[i],entryEnd[i]) and i runs over the given rows (or over
+// [0,numRows) if 'rows' is null). X and Y are accessed through general row
+// and column strides so that they may either be column-major matrices or
+// packed buffers of ghost values; 'yHeight' is the number of rows of Y.
+//
+// For op(A) = A, the rows of A are distributed over the threads and each row
+// is applied to up to 'rhsBlocksize' right-hand sides at once so that its
+// (column index, value) pairs are only loaded once per block. Otherwise,
+// the scattered updates are formed via ParallelScatter.
+template<typename T,class Values>
+void MultiplyCSRRanges
 ( Orientation orientation,
-  Int m, Int n,
+  Int numRows, const Int* rows,
+  const Int* entryBeg, const Int* entryEnd,
+  Int yHeight, Int numRHS,
   T alpha,
-  const Int* rowOffsets,
-  const Int* colIndices,
-  const T*   x,
-  T beta,
-        T*   y )
+  const Int*    colIndices,
+  const Values& values,
+  const T* X, Int xRowStride, Int xColStride,
+        T* Y, Int yRowStride, Int yColStride )
 {
     EL_DEBUG_CSE
     if( orientation == NORMAL )
     {
-        for( Int i=0; i<m; ++i )
+        EL_PARALLEL_FOR
+        for( Int r=0; r<numRows; ++r )
         {
-            T sum = 0;
-            const Int eStart = rowOffsets[i];
-            const Int eStop = rowOffsets[i+1];
-            for( Int e=eStart; e<eStop; ++e )
-                sum += x[colIndices[e]];
-            y[i] = alpha*sum + beta*y[i];
+            const Int i = ( rows == nullptr ? r : rows[r] );
+            const Int eStart = entryBeg[i];
+            const Int eStop = entryEnd[i];
+            if( eStart == eStop )
+                continue;
+            T sums[rhsBlocksize];
+            for( Int kOff=0; kOff<numRHS; kOff+=rhsBlocksize )
+            {
+                const Int nb = Min(rhsBlocksize,numRHS-kOff);
+                for( Int k=0; k<nb; ++k )
+                    sums[k] = 0;
+                for( Int e=eStart; e<eStop; ++e )
+                {
+                    const T value = values(e);
+                    const T* XRow =
+                      &X[colIndices[e]*xRowStride+kOff*xColStride];
+                    EL_SIMD
+                    for( Int k=0; k<nb; ++k )
+                        sums[k] += value*XRow[k*xColStride];
+                }
+                T* YRow = &Y[i*yRowStride+kOff*yColStride];
+                for( Int k=0; k<nb; ++k )
+                    YRow[k*yColStride] += alpha*sums[k];
+            }
         }
     }
     else
     {
-        for( Int j=0; j<n; ++j ){
-            y[j] *= beta;
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*x[i];
-            }
-	}
+        Int numNonzeros = 0;
+        for( Int r=0; r<numRows; ++r )
+        {
+            const Int i = ( rows == nullptr ? r : rows[r] );
+            numNonzeros += entryEnd[i] - entryBeg[i];
+        }
+        auto scatter =
+          [&]( Int rBeg, Int rEnd, T* Z, Int zRowStride, Int zColStride )
+          {
+              for( Int r=rBeg; r<rEnd; ++r )
+              {
+                  const Int i = ( rows == nullptr ? r : rows[r] );
+                  const T* XRow = &X[i*xRowStride];
+                  const Int eStop = entryEnd[i];
+                  for( Int e=entryBeg[i]; e<eStop; ++e )
+                  {
+                      const T prod = alpha*values(e);
+                      T* ZRow = &Z[colIndices[e]*zRowStride];
+                      for( Int k=0; k<numRHS; ++k )
+                          ZRow[k*zColStride] += prod*XRow[k*xColStride];
+                  }
+              }
+          };
+        ParallelScatter
+        ( numRows, numNonzeros*numRHS, yHeight, numRHS,
+          Y, yRowStride, yColStride, scatter );
+    }
+}
+
+// Y := beta Y for the leading height x numRHS portion of Y
+template<typename T>
+void ScaleRHS( Int height, Int numRHS, T beta, T* Y, Int ldY )
+{
+    for( Int k=0; k<numRHS; ++k )
+    {
+        T* YCol = &Y[k*ldY];
+        EL_PARALLEL_FOR
+        for( Int i=0; i<height; ++i )
+            YCol[i] *= beta;
     }
 }
 
 template<typename T,typename=DisableIf<IsBlasScalar<T>>>
-void MultiplyCSR
+bool VendorMultiplyCSR
 ( Orientation orientation,
   Int m, Int n,
   T alpha,
@@ -67,50 +198,10 @@ void MultiplyCSR
   const T*   x,
   T beta,
         T*   y )
-{
-    EL_DEBUG_CSE
-    if( orientation == NORMAL )
-    {
-        for( Int i=0; i<m; ++i )
-        {
-            T sum = 0;
-            const Int eStart = rowOffsets[i];
-            const Int eStop = rowOffsets[i+1];
-            for( Int e=eStart; e<eStop; ++e )
-                sum += values[e]*x[colIndices[e]];
-            y[i] = alpha*sum + beta*y[i];
-        }
-    }
-    else
-    {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int j=0; j<n; ++j )
-            y[j] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*Conj(values[e])*x[i];
-            }
-        }
-        else
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*values[e]*x[i];
-            }
-        }
-    }
-}
+{ return false; }
 
 template<typename T,typename=EnableIf<IsBlasScalar<T>>,typename=void>
-void MultiplyCSR
+bool VendorMultiplyCSR
 ( Orientation orientation,
   Int m, Int n,
   T alpha,
@@ -121,7 +212,6 @@ void MultiplyCSR
   T beta,
         T*   y )
 {
-    EL_DEBUG_CSE
 #if defined(EL_HAVE_MKL) && !defined(EL_DISABLE_MKL_CSRMV)
     char matDescrA[6];
     matDescrA[0] = 'G';
@@ -129,45 +219,9 @@ void MultiplyCSR
     mkl::csrmv
     ( orientation, m, n, alpha, matDescrA,
       values, colIndices, rowOffsets, rowOffsets+1, x, beta, y );
+    return true;
 #else
-    if( orientation == NORMAL )
-    {
-        for( Int i=0; i<m; ++i )
-        {
-            T sum = 0;
-            const Int eStart = rowOffsets[i];
-            const Int eStop = rowOffsets[i+1];
-            for( Int e=eStart; e<eStop; ++e )
-                sum += values[e]*x[colIndices[e]];
-            y[i] = alpha*sum + beta*y[i];
-        }
-    }
-    else
-    {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int j=0; j<n; ++j )
-            y[j] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*Conj(values[e])*x[i];
-            }
-        }
-        else
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*values[e]*x[i];
-            }
-        }
-    }
+    return false;
 #endif
 }
 
@@ -184,66 +238,21 @@ void MultiplyCSR
         T*   Y, Int ldY )
 {
     EL_DEBUG_CSE
-    if( numRHS == 1 )
-    {
-        MultiplyCSR
+    if( numRHS == 1 &&
+        VendorMultiplyCSR
         ( orientation, m, n, alpha,
-          rowOffsets, colIndices, values, X, beta, Y );
+          rowOffsets, colIndices, values, X, beta, Y ) )
         return;
-    }
 
-    if( orientation == NORMAL )
-    {
-        for( Int i=0; i<m; ++i )
-        {
-            for( Int k=0; k<numRHS; ++k )
-            {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]+k*ldX];
-                Y[i+k*ldY] = alpha*sum + beta*Y[i+k*ldY];
-            }
-        }
-    }
-    else
-    {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int k=0; k<numRHS; ++k )
-            for( Int j=0; j<n; ++j )
-                Y[j+k*ldY] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*Conj(values[e]);
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]+k*ldY] += prod*X[i+k*ldX];
-                }
-            }
-        }
-        else
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*values[e];
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]+k*ldY] += prod*X[i+k*ldX];
-                }
-            }
-        }
-    }
+    const Int height = ( orientation==NORMAL ? m : n );
+    ScaleRHS( height, numRHS, beta, Y, ldY );
+    const ExplicitValues<T> valueAccessor{ values, orientation==ADJOINT };
+    MultiplyCSRRanges
+    ( orientation, m, nullptr, rowOffsets, &rowOffsets[1], height, numRHS,
+      alpha, colIndices, valueAccessor, X, 1, ldX, Y, 1, ldY );
 }
 
+// MultiplyCSR specialization where the CSR matrix has all nonzeros equal to 1
 template<typename T>
 void MultiplyCSR
 ( Orientation orientation,
@@ -256,265 +265,175 @@ void MultiplyCSR
         T*   Y, Int ldY )
 {
     EL_DEBUG_CSE
-    if( numRHS == 1 )
-    {
-        MultiplyCSR
-        ( orientation, m, n, alpha,
-          rowOffsets, colIndices, X, beta, Y );
-        return;
-    }
-
-    if( orientation == NORMAL )
-    {
-        for( Int i=0; i<m; ++i )
-        {
-            for( Int k=0; k<numRHS; ++k )
-            {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += X[colIndices[e]+k*ldX];
-                Y[i+k*ldY] = alpha*sum + beta*Y[i+k*ldY];
-            }
-        }
-    }
-    else
-    {
-        for( Int k=0; k<numRHS; ++k )
-	{
-            for( Int j=0; j<n; ++j )
-	    {
-                Y[j+k*ldY] *= beta;
-            	for( Int i=0; i<m; ++i )
-            	{
-            	    const Int eStart = rowOffsets[i];
-            	    const Int eStop = rowOffsets[i+1];
-            	    for( Int e=eStart; e<eStop; ++e )
-            	        for( Int k=0; k<numRHS; ++k )
-            	            Y[colIndices[e]+k*ldY] += alpha*X[i+k*ldX];
-            	}
-            }
-        }
-    }
+    const Int height = ( orientation==NORMAL ? m : n );
+    ScaleRHS( height, numRHS, beta, Y, ldY );
+    MultiplyCSRRanges
+    ( orientation, m, nullptr, rowOffsets, &rowOffsets[1], height, numRHS,
+      alpha, colIndices, UnitValues<T>(), X, 1, ldX, Y, 1, ldY );
 }
 
+// Convert the rows [0,numRows) of a CSR-like matrix, whose r'th row consists
+// of the entries [entryBeg[r],entryEnd[r]), into SELL-C-sigma format. The
+// r'th row is labeled as row rows[r] of the product (or r if 'rows' is null).
 template<typename T>
-void MultiplyCSRInterX
-( Orientation orientation,
-  Int m, Int n, Int numRHS,
-  T alpha,
-  const Int* rowOffsets,
-  const Int* colIndices,
-  const T*   values,
-  const T*   X,
-  T beta,
-        T*   Y, Int ldY )
+void RangesToSell
+( Int numRows, const Int* rows,
+  const Int* entryBeg, const Int* entryEnd,
+  const Int* colIndices, const T* values,
+  Int width, Int chunkSize, Int sigma,
+  SellCSigmaMatrix<T>& ASell )
 {
     EL_DEBUG_CSE
-    if( numRHS == 1 )
+    if( chunkSize < 1 || chunkSize > maxSellChunkSize )
+        LogicError
+        ("SELL-C-sigma chunk size must be in [1,",maxSellChunkSize,"]");
+    if( sigma < 1 )
+        LogicError("SELL-C-sigma sorting window must be positive");
+    ASell.height = numRows;
+    ASell.width = width;
+    ASell.chunkSize = chunkSize;
+    ASell.sigma = sigma;
+
+    // Sort the rows by decreasing length within each window of sigma rows
+    vector<Int> perm(numRows);
+    for( Int r=0; r<numRows; ++r )
+        perm[r] = r;
+    auto longer =
+      [&]( const Int& r0, const Int& r1 )
+      { return entryEnd[r0]-entryBeg[r0] > entryEnd[r1]-entryBeg[r1]; };
+    for( Int windowBeg=0; windowBeg<numRows; windowBeg+=sigma )
+        std::stable_sort
+        ( perm.begin()+windowBeg,
+          perm.begin()+Min(windowBeg+sigma,numRows), longer );
+
+    // Pad each chunk to the length of its longest row
+    const Int numChunks = (numRows+chunkSize-1) / chunkSize;
+    ASell.chunkOffsets.resize( numChunks+1 );
+    ASell.chunkOffsets[0] = 0;
+    for( Int c=0; c<numChunks; ++c )
     {
-        MultiplyCSR
-        ( orientation, m, n, alpha,
-          rowOffsets, colIndices, values, X, beta, Y );
-        return;
+        // Since the rows are sorted by length within each window, and the
+        // windows need not be aligned with the chunks, take a maximum
+        Int chunkWidth = 0;
+        const Int rowEnd = Min((c+1)*chunkSize,numRows);
+        for( Int s=c*chunkSize; s<rowEnd; ++s )
+            chunkWidth = Max( chunkWidth, entryEnd[perm[s]]-entryBeg[perm[s]] );
+        ASell.chunkOffsets[c+1] = ASell.chunkOffsets[c] + chunkWidth*chunkSize;
     }
-
-    if( orientation == NORMAL )
+    const Int numEntries = ASell.chunkOffsets[numChunks];
+    ASell.colIndices.assign( numEntries, 0 );
+    ASell.values.assign( numEntries, T(0) );
+
+    // Store each chunk column-major
+    ASell.rowPerm.resize( numRows );
+    EL_PARALLEL_FOR
+    for( Int c=0; c<numChunks; ++c )
     {
-        for( Int i=0; i<m; ++i )
+        const Int offset = ASell.chunkOffsets[c];
+        const Int rowEnd = Min((c+1)*chunkSize,numRows);
+        for( Int s=c*chunkSize; s<rowEnd; ++s )
         {
-            for( Int k=0; k<numRHS; ++k )
+            const Int r = perm[s];
+            const Int slot = s - c*chunkSize;
+            const Int eStart = entryBeg[r];
+            const Int length = entryEnd[r] - eStart;
+            for( Int l=0; l<length; ++l )
             {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]*numRHS+k];
-                Y[i+k*ldY] = alpha*sum + beta*Y[i+k*ldY];
-            }
-        }
-    }
-    else
-    {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int k=0; k<numRHS; ++k )
-            for( Int j=0; j<n; ++j )
-                Y[j+k*ldY] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*Conj(values[e]);
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]+k*ldY] += prod*X[i*numRHS+k];
-                }
-            }
-        }
-        else
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*values[e];
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]+k*ldY] += prod*X[i*numRHS+k];
-                }
+                ASell.colIndices[offset+l*chunkSize+slot] =
+                  colIndices[eStart+l];
+                ASell.values[offset+l*chunkSize+slot] = values[eStart+l];
             }
+            ASell.rowPerm[s] = ( rows == nullptr ? r : rows[r] );
         }
     }
 }
 
+// Y += alpha op(A) X for a SELL-C-sigma matrix A, where X and Y are accessed
+// through general row and column strides (as in MultiplyCSRRanges). For
+// op(A) = A, each chunk's rows are traversed in lockstep with unit-stride
+// (and hence vectorizable) accesses to its column indices and values.
 template<typename T>
-void MultiplyCSRInterY
+void MultiplySell
 ( Orientation orientation,
-  Int m, Int n, Int numRHS,
   T alpha,
-  const Int* rowOffsets,
-  const Int* colIndices,
-  const T*   values,
-  const T*   X, Int ldX,
-  T beta,
-        T*   Y )
+  const SellCSigmaMatrix<T>& A,
+  Int numRHS,
+  const T* X, Int xRowStride, Int xColStride,
+        T* Y, Int yRowStride, Int yColStride )
 {
     EL_DEBUG_CSE
-    if( numRHS == 1 )
-    {
-        MultiplyCSR
-        ( orientation, m, n, alpha,
-          rowOffsets, colIndices, values, X, beta, Y );
+    const Int chunkSize = A.chunkSize;
+    const Int numChunks = Int(A.chunkOffsets.size()) - 1;
+    if( numChunks <= 0 )
         return;
-    }
+    const Int* chunkOffsets = A.chunkOffsets.data();
+    const Int* rowPerm = A.rowPerm.data();
+    const Int* colIndexBuf = A.colIndices.data();
+    const T* valueBuf = A.values.data();
 
     if( orientation == NORMAL )
     {
-        for( Int i=0; i<m; ++i )
+        EL_PARALLEL_FOR
+        for( Int c=0; c<numChunks; ++c )
         {
+            const Int offset = chunkOffsets[c];
+            const Int chunkWidth = (chunkOffsets[c+1]-offset) / chunkSize;
+            if( chunkWidth == 0 )
+                continue;
+            const Int numChunkRows = Min(chunkSize,A.height-c*chunkSize);
+            const Int* chunkRows = &rowPerm[c*chunkSize];
+            T sums[maxSellChunkSize];
             for( Int k=0; k<numRHS; ++k )
             {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]+k*ldX];
-                Y[i*numRHS+k] = alpha*sum + beta*Y[i*numRHS+k];
-            }
-        }
-    }
-    else
-    {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int k=0; k<numRHS; ++k )
-            for( Int j=0; j<n; ++j )
-                Y[j*numRHS+k] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*Conj(values[e]);
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]*numRHS+k] += prod*X[i+k*ldX];
-                }
-            }
-        }
-        else
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
+                const T* XCol = &X[k*xColStride];
+                for( Int s=0; s<numChunkRows; ++s )
+                    sums[s] = 0;
+                for( Int l=0; l<chunkWidth; ++l )
                 {
-                    T prod = alpha*values[e];
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]*numRHS+k] += prod*X[i+k*ldX];
+                    const Int* cols = &colIndexBuf[offset+l*chunkSize];
+                    const T* vals = &valueBuf[offset+l*chunkSize];
+                    EL_SIMD
+                    for( Int s=0; s<numChunkRows; ++s )
+                        sums[s] += vals[s]*XCol[cols[s]*xRowStride];
                 }
-            }
-        }
-    }
-}
-
-template<typename T>
-void MultiplyCSRInter
-( Orientation orientation,
-  Int m, Int n, Int numRHS,
-  T alpha,
-  const Int* rowOffsets,
-  const Int* colIndices,
-  const T*   values,
-  const T*   X,
-  T beta,
-        T*   Y )
-{
-    EL_DEBUG_CSE
-    if( numRHS == 1 )
-    {
-        MultiplyCSR
-        ( orientation, m, n, alpha,
-          rowOffsets, colIndices, values, X, beta, Y );
-        return;
-    }
-
-    if( orientation == NORMAL )
-    {
-        for( Int i=0; i<m; ++i )
-        {
-            for( Int k=0; k<numRHS; ++k )
-            {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]*numRHS+k];
-                Y[i*numRHS+k] = alpha*sum + beta*Y[i*numRHS+k];
+                for( Int s=0; s<numChunkRows; ++s )
+                    Y[chunkRows[s]*yRowStride+k*yColStride] += alpha*sums[s];
             }
         }
     }
     else
     {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int j=0; j<n; ++j )
-            for( Int k=0; k<numRHS; ++k )
-                Y[j*numRHS+k] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*Conj(values[e]);
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]*numRHS+k] += prod*X[i*numRHS+k];
-                }
-            }
-        }
-        else
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*values[e];
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]*numRHS+k] += prod*X[i*numRHS+k];
-                }
-            }
-        }
+        const bool conjugate = ( orientation == ADJOINT );
+        auto scatter =
+          [&]( Int cBeg, Int cEnd, T* Z, Int zRowStride, Int zColStride )
+          {
+              for( Int c=cBeg; c<cEnd; ++c )
+              {
+                  const Int offset = chunkOffsets[c];
+                  const Int chunkWidth =
+                    (chunkOffsets[c+1]-offset) / chunkSize;
+                  const Int numChunkRows =
+                    Min(chunkSize,A.height-c*chunkSize);
+                  const Int* chunkRows = &rowPerm[c*chunkSize];
+                  for( Int l=0; l<chunkWidth; ++l )
+                  {
+                      const Int* cols = &colIndexBuf[offset+l*chunkSize];
+                      const T* vals = &valueBuf[offset+l*chunkSize];
+                      for( Int s=0; s<numChunkRows; ++s )
+                      {
+                          const T prod =
+                            alpha*( conjugate ? Conj(vals[s]) : vals[s] );
+                          const T* XRow = &X[chunkRows[s]*xRowStride];
+                          T* ZRow = &Z[cols[s]*zRowStride];
+                          for( Int k=0; k<numRHS; ++k )
+                              ZRow[k*zColStride] += prod*XRow[k*xColStride];
+                      }
+                  }
+              }
+          };
+        ParallelScatter
+        ( numChunks, Int(A.values.size())*numRHS, A.width, numRHS,
+          Y, yRowStride, yColStride, scatter );
     }
 }
 
@@ -560,14 +479,115 @@ void Multiply
 }
 
 
+template<typename T>
+void SparseToSell
+( const SparseMatrix<T>& A, SellCSigmaMatrix<T>& ASell,
+  Int chunkSize, Int sigma )
+{
+    EL_DEBUG_CSE
+    const Int* offsetBuf = A.LockedOffsetBuffer();
+    RangesToSell
+    ( A.Height(), nullptr, offsetBuf, &offsetBuf[1],
+      A.LockedTargetBuffer(), A.LockedValueBuffer(),
+      A.Width(), chunkSize, sigma, ASell );
+}
+
 template<typename T>
 void Multiply
 ( Orientation orientation,
-        T alpha,
+  T alpha, const SellCSigmaMatrix<T>& A, const Matrix<T>& X,
+  T beta,                                      Matrix<T>& Y )
+{
+    EL_DEBUG_CSE
+    const Int m = ( orientation==NORMAL ? A.height : A.width );
+    const Int n = ( orientation==NORMAL ? A.width : A.height );
+    if( X.Width() != Y.Width() )
+        LogicError("X and Y must have the same width");
+    if( X.Height() != n || Y.Height() != m )
+        LogicError
+        ("Nonconformal SELL-C-sigma product: ",m," x ",n," matrix times ",
+         X.Height()," x ",X.Width()," into ",Y.Height()," x ",Y.Width());
+    ScaleRHS( m, Y.Width(), beta, Y.Buffer(), Y.LDim() );
+    MultiplySell
+    ( orientation, alpha, A, X.Width(),
+      X.LockedBuffer(), 1, X.LDim(),
+      Y.Buffer(),       1, Y.LDim() );
+}
+
+namespace {
+
+// Post the non-blocking sends of the b values associated with each of our
+// send indices to the processes which requested them, as well as the
+// receives for each of our receive indices. Only the neighbors recorded in
+// the multiplication metadata are contacted, so the latency is proportional
+// to the number of neighbors rather than the size of the communicator. The
+// portion destined for this process is left to CopySelfPortion.
+template<typename T>
+void StartNeighborExchange
+( const T* sendBuf,
+  const vector<Int>& sendSizes,
+  const vector<Int>& sendOffs,
+  const vector<int>& sendNeighbors,
+        T* recvBuf,
+  const vector<Int>& recvSizes,
+  const vector<Int>& recvOffs,
+  const vector<int>& recvNeighbors,
+  Int b, mpi::Comm comm,
+  vector<mpi::Request<T>>& requests )
+{
+    EL_DEBUG_CSE
+    const int commRank = mpi::Rank( comm );
+    requests.resize( recvNeighbors.size()+sendNeighbors.size() );
+    Int numRequests = 0;
+    for( const int q : recvNeighbors )
+        if( q != commRank )
+            mpi::IRecv
+            ( &recvBuf[recvOffs[q]*b], recvSizes[q]*b, q, comm,
+              requests[numRequests++] );
+    for( const int q : sendNeighbors )
+        if( q != commRank )
+            mpi::ISend
+            ( &sendBuf[sendOffs[q]*b], sendSizes[q]*b, q, comm,
+              requests[numRequests++] );
+    requests.resize( numRequests );
+}
+
+template<typename T>
+void CopySelfPortion
+( const T* sendBuf,
+  const vector<Int>& sendSizes,
+  const vector<Int>& sendOffs,
+        T* recvBuf,
+  const vector<Int>& recvOffs,
+  Int b, mpi::Comm comm )
+{
+    const int commRank = mpi::Rank( comm );
+    MemCopy
+    ( &recvBuf[recvOffs[commRank]*b], &sendBuf[sendOffs[commRank]*b],
+      sendSizes[commRank]*b );
+}
+
+// The shared driver for distributed sparse products, which overlaps the
+// contributions from the entries referencing locally-owned columns (the
+// interior) with the exchange of the ghost values, and only finishes the
+// boundary rows after the exchange completes. The functors
+//
+//   interior( X, xRowStride, xColStride, Y, yRowStride, yColStride ),
+//   boundary( X, xRowStride, xColStride, Y, yRowStride, yColStride )
+//
+// should perform Y += alpha op(A_part) X for the corresponding portions of
+// the local rows of A, where, for op(A) = A, X is the packed buffer of ghost
+// values and Y is the local portion of Y, and, otherwise, X is the local
+// portion of X and Y is the packed buffer of ghost updates.
+template<typename T,class InteriorUpdate,class BoundaryUpdate>
+void OverlappedMultiply
+( Orientation orientation,
   const DistSparseMatrix<T>& A,
   const DistMultiVec<T>& X,
         T beta,
-        DistMultiVec<T>& Y )
+        DistMultiVec<T>& Y,
+  const InteriorUpdate& interior,
+  const BoundaryUpdate& boundary )
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
@@ -578,36 +598,22 @@ void Multiply
           LogicError("Communicators did not match");
     )
 
-    const bool time = false;
-
     const Grid& grid = A.Grid();
-    const int commSize = grid.Size();
-    const int commRank = grid.Rank();
+    mpi::Comm comm = grid.Comm();
     // TODO(poulson): Use sequential implementation if commSize = 1?
 
-    Timer totalTimer, timer;
-    if( time && commRank == 0 )
-        totalTimer.Start();
+    RegionTimer multiplyRegion("DistSparseMultiply");
 
     // Y := beta Y
     Y *= beta;
 
-    A.InitializeMultMeta();
     const auto& meta = A.LockedDistGraph().multMeta;
-    // Convert the sizes and offsets to be compatible with the current width
     const Int b = X.Width();
-    vector<int> recvSizes=meta.recvSizes,
-                recvOffs=meta.recvOffs,
-                sendSizes=meta.sendSizes,
-                sendOffs=meta.sendOffs;
-    for( int q=0; q<commSize; ++q )
-    {
-        recvSizes[q] *= b;
-        recvOffs[q] *= b;
-        sendSizes[q] *= b;
-        sendOffs[q] *= b;
-    }
+    vector<mpi::Request<T>> requests;
 
+    // The packed values are stored as the columns of b x numInds matrices
+    // so that their storage is recycled by the pooled allocator between
+    // repeated multiplications
     if( orientation == NORMAL )
     {
         if( A.Height() != Y.Height() )
@@ -618,8 +624,8 @@ void Multiply
         // Pack the send values
         const Int numSendInds = meta.sendInds.size();
         const Int firstLocalRow = X.FirstLocalRow();
-        vector<T> sendVals;
-        FastResize( sendVals, numSendInds*b );
+        Matrix<T> sendVals( b, numSendInds );
+        T* sendBuf = sendVals.Buffer();
         const T* XBuffer = X.LockedMatrix().LockedBuffer();
         const Int ldX = X.LockedMatrix().LDim();
         for( Int s=0; s<numSendInds; ++s )
@@ -627,27 +633,36 @@ void Multiply
             const Int i = meta.sendInds[s];
             const Int iLoc = i - firstLocalRow;
             for( Int t=0; t<b; ++t )
-                sendVals[s*b+t] = XBuffer[iLoc+t*ldX];
+                sendBuf[s*b+t] = XBuffer[iLoc+t*ldX];
         }
 
-        // Now send them
-        vector<T> recvVals( meta.numRecvInds*b );
-        mpi::AllToAll
-        ( sendVals.data(), sendSizes.data(), sendOffs.data(),
-          recvVals.data(), recvSizes.data(), recvOffs.data(), grid.Comm() );
-
-        // Perform the local multiply-accumulate, y := alpha A x + y
-        if( time && commRank == 0 )
-            timer.Start();
-        MultiplyCSRInterX
-        ( NORMAL, A.LocalHeight(), meta.numRecvInds, b,
-          alpha, A.LockedOffsetBuffer(),
-                 meta.colOffs.data(),
-                 A.LockedValueBuffer(),
-                 recvVals.data(),
-          T(1),  Y.Matrix().Buffer(), Y.Matrix().LDim() );
-        if( time && commRank == 0 )
-            Output("  MultiplyCSRInterX time: ",timer.Stop());
+        // Start sending them
+        Matrix<T> recvVals( b, meta.numRecvInds );
+        T* recvBuf = recvVals.Buffer();
+        StartNeighborExchange
+        ( sendBuf, meta.sendSizes, meta.sendOffs, meta.sendNeighbors,
+          recvBuf, meta.recvSizes, meta.recvOffs, meta.recvNeighbors,
+          b, comm, requests );
+        CopySelfPortion
+        ( sendBuf, meta.sendSizes, meta.sendOffs, recvBuf, meta.recvOffs,
+          b, comm );
+
+        // Overlap the interior update, y := alpha A_I x_I + y, with the
+        // exchange and then finish with the boundary rows
+        T* YBuffer = Y.Matrix().Buffer();
+        const Int ldY = Y.Matrix().LDim();
+        {
+            RegionTimer region("Interior");
+            interior( recvBuf, b, 1, YBuffer, 1, ldY );
+        }
+        {
+            RegionTimer region("Wait");
+            mpi::WaitAll( requests.size(), requests.data() );
+        }
+        {
+            RegionTimer region("Boundary");
+            boundary( recvBuf, b, 1, YBuffer, 1, ldY );
+        }
     }
     else
     {
@@ -656,27 +671,50 @@ void Multiply
         if( A.Height() != X.Height() )
             LogicError("The height of A must match the height of X");
 
-        // Form and pack the updates to Y
-        if( time && commRank == 0 )
-            timer.Start();
-        vector<T> sendVals( meta.numRecvInds*b, 0 );
-        MultiplyCSRInterY
-        ( orientation, A.LocalHeight(), meta.numRecvInds, b,
-          alpha, A.LockedOffsetBuffer(),
-                 meta.colOffs.data(),
-                 A.LockedValueBuffer(),
-                 X.LockedMatrix().LockedBuffer(), X.LockedMatrix().LDim(),
-          T(1),  sendVals.data() );
-        if( time && commRank == 0 )
-            Output("  MultiplyCSRInterY time: ",timer.Stop());
-
-        // Inject the updates to Y into the network
+        // Form and pack the boundary updates to Y
+        Matrix<T> sendVals( b, meta.numRecvInds );
+        Zero( sendVals );
+        T* sendBuf = sendVals.Buffer();
+        const T* XBuffer = X.LockedMatrix().LockedBuffer();
+        const Int ldX = X.LockedMatrix().LDim();
+        {
+            RegionTimer region("Boundary");
+            boundary( XBuffer, 1, ldX, sendBuf, b, 1 );
+        }
+
+        // Inject the updates to Y into the network while forming the
+        // interior updates. Since the send buffer may not be modified until
+        // the sends complete, the interior updates are formed separately
+        // and, as they only touch the indices which we own, folded into our
+        // own portion of the received updates.
         const Int numRecvInds = meta.sendInds.size();
-        vector<T> recvVals;
-        FastResize( recvVals, numRecvInds*b );
-        mpi::AllToAll
-        ( sendVals.data(), recvSizes.data(), recvOffs.data(),
-          recvVals.data(), sendSizes.data(), sendOffs.data(), grid.Comm() );
+        Matrix<T> recvVals( b, numRecvInds );
+        T* recvBuf = recvVals.Buffer();
+        StartNeighborExchange
+        ( sendBuf, meta.recvSizes, meta.recvOffs, meta.recvNeighbors,
+          recvBuf, meta.sendSizes, meta.sendOffs, meta.sendNeighbors,
+          b, comm, requests );
+        CopySelfPortion
+        ( sendBuf, meta.recvSizes, meta.recvOffs, recvBuf, meta.sendOffs,
+          b, comm );
+        {
+            RegionTimer region("Interior");
+            Matrix<T> interiorVals( b, meta.numRecvInds );
+            Zero( interiorVals );
+            T* interiorBuf = interiorVals.Buffer();
+            interior( XBuffer, 1, ldX, interiorBuf, b, 1 );
+
+            const int commRank = mpi::Rank( comm );
+            const T* selfInterior = &interiorBuf[meta.recvOffs[commRank]*b];
+            T* selfRecv = &recvBuf[meta.sendOffs[commRank]*b];
+            const Int selfSize = meta.recvSizes[commRank]*b;
+            for( Int k=0; k<selfSize; ++k )
+                selfRecv[k] += selfInterior[k];
+        }
+        {
+            RegionTimer region("Wait");
+            mpi::WaitAll( requests.size(), requests.data() );
+        }
 
         // Accumulate the received indices onto Y
         const Int firstLocalRow = Y.FirstLocalRow();
@@ -687,11 +725,148 @@ void Multiply
             const Int i = meta.sendInds[s];
             const Int iLoc = i - firstLocalRow;
             for( Int t=0; t<b; ++t )
-                YBuffer[iLoc+t*ldY] += recvVals[s*b+t];
+                YBuffer[iLoc+t*ldY] += recvBuf[s*b+t];
+        }
+    }
+}
+
+} // anonymous namespace
+
+template<typename T>
+void Multiply
+( Orientation orientation,
+        T alpha,
+  const DistSparseMatrix<T>& A,
+  const DistMultiVec<T>& X,
+        T beta,
+        DistMultiVec<T>& Y )
+{
+    EL_DEBUG_CSE
+    A.InitializeMultMeta();
+    const auto& meta = A.LockedDistGraph().multMeta;
+    const Int b = X.Width();
+    const Int localHeight = A.LocalHeight();
+    const Int numBoundaryRows = meta.boundaryRows.size();
+    const Int* boundaryRows = meta.boundaryRows.data();
+    const Int* offsetBuf = A.LockedOffsetBuffer();
+    const Int* interiorBeg = meta.interiorBeg.data();
+    const Int* interiorEnd = meta.interiorEnd.data();
+    const Int* colOffs = meta.colOffs.data();
+    // The ghost buffer has one row per received index for op(A) = A and,
+    // otherwise, one row per index whose updates we send
+    const Int ghostHeight = meta.numRecvInds;
+    const Int yHeight =
+      ( orientation==NORMAL ? Y.LocalHeight() : ghostHeight );
+    const T* valueBuf = A.LockedValueBuffer();
+
+    auto interior =
+      [&]( const T* XBuf, Int xRowStride, Int xColStride,
+                 T* YBuf, Int yRowStride, Int yColStride )
+      {
+          const ExplicitValues<T> values{ valueBuf, orientation==ADJOINT };
+          MultiplyCSRRanges
+          ( orientation, localHeight, nullptr, interiorBeg, interiorEnd,
+            yHeight, b, alpha, colOffs, values,
+            XBuf, xRowStride, xColStride, YBuf, yRowStride, yColStride );
+      };
+    auto boundary =
+      [&]( const T* XBuf, Int xRowStride, Int xColStride,
+                 T* YBuf, Int yRowStride, Int yColStride )
+      {
+          const ExplicitValues<T> values{ valueBuf, orientation==ADJOINT };
+          MultiplyCSRRanges
+          ( orientation, numBoundaryRows, boundaryRows,
+            offsetBuf, interiorBeg,
+            yHeight, b, alpha, colOffs, values,
+            XBuf, xRowStride, xColStride, YBuf, yRowStride, yColStride );
+          MultiplyCSRRanges
+          ( orientation, numBoundaryRows, boundaryRows,
+            interiorEnd, &offsetBuf[1],
+            yHeight, b, alpha, colOffs, values,
+            XBuf, xRowStride, xColStride, YBuf, yRowStride, yColStride );
+      };
+    OverlappedMultiply( orientation, A, X, beta, Y, interior, boundary );
+}
+
+template<typename T>
+void SparseToSell
+( const DistSparseMatrix<T>& A, DistSellCSigmaMatrix<T>& ASell,
+  Int chunkSize, Int sigma )
+{
+    EL_DEBUG_CSE
+    A.InitializeMultMeta();
+    const auto& meta = A.LockedDistGraph().multMeta;
+    const Int localHeight = A.LocalHeight();
+    const Int* offsetBuf = A.LockedOffsetBuffer();
+    const Int* colOffs = meta.colOffs.data();
+    const T* valueBuf = A.LockedValueBuffer();
+    RangesToSell
+    ( localHeight, nullptr, meta.interiorBeg.data(), meta.interiorEnd.data(),
+      colOffs, valueBuf, meta.numRecvInds, chunkSize, sigma, ASell.interior );
+
+    // Gather the (noncontiguous) boundary entries of the boundary rows
+    const Int numBoundaryRows = meta.boundaryRows.size();
+    vector<Int> boundaryOffs(numBoundaryRows+1), boundaryCols;
+    vector<T> boundaryVals;
+    boundaryOffs[0] = 0;
+    for( Int r=0; r<numBoundaryRows; ++r )
+    {
+        const Int i = meta.boundaryRows[r];
+        for( Int e=offsetBuf[i]; e<meta.interiorBeg[i]; ++e )
+        {
+            boundaryCols.push_back( colOffs[e] );
+            boundaryVals.push_back( valueBuf[e] );
         }
+        for( Int e=meta.interiorEnd[i]; e<offsetBuf[i+1]; ++e )
+        {
+            boundaryCols.push_back( colOffs[e] );
+            boundaryVals.push_back( valueBuf[e] );
+        }
+        boundaryOffs[r+1] = boundaryCols.size();
     }
-    if( time && commRank == 0 )
-        Output("Multiply total time: ",totalTimer.Stop());
+    RangesToSell
+    ( numBoundaryRows, meta.boundaryRows.data(),
+      boundaryOffs.data(), &boundaryOffs[1],
+      boundaryCols.data(), boundaryVals.data(),
+      meta.numRecvInds, chunkSize, sigma, ASell.boundary );
+}
+
+template<typename T>
+void Multiply
+( Orientation orientation,
+        T alpha,
+  const DistSparseMatrix<T>& A,
+  const DistSellCSigmaMatrix<T>& ASell,
+  const DistMultiVec<T>& X,
+        T beta,
+        DistMultiVec<T>& Y )
+{
+    EL_DEBUG_CSE
+    A.InitializeMultMeta();
+    const auto& meta = A.LockedDistGraph().multMeta;
+    if( ASell.interior.height != A.LocalHeight() ||
+        ASell.interior.width != meta.numRecvInds ||
+        ASell.boundary.height != Int(meta.boundaryRows.size()) )
+        LogicError("SELL-C-sigma copy does not match the sparse matrix");
+    const Int b = X.Width();
+
+    auto interior =
+      [&]( const T* XBuf, Int xRowStride, Int xColStride,
+                 T* YBuf, Int yRowStride, Int yColStride )
+      {
+          MultiplySell
+          ( orientation, alpha, ASell.interior, b,
+            XBuf, xRowStride, xColStride, YBuf, yRowStride, yColStride );
+      };
+    auto boundary =
+      [&]( const T* XBuf, Int xRowStride, Int xColStride,
+                 T* YBuf, Int yRowStride, Int yColStride )
+      {
+          MultiplySell
+          ( orientation, alpha, ASell.boundary, b,
+            XBuf, xRowStride, xColStride, YBuf, yRowStride, yColStride );
+      };
+    OverlappedMultiply( orientation, A, X, beta, Y, interior, boundary );
 }
 
 #define PROTO(T) \
@@ -713,6 +888,27 @@ void Multiply
     ( Orientation orientation, \
             T alpha, \
       const DistSparseMatrix<T>& A, \
+      const DistMultiVec<T>& X, \
+            T beta, \
+            DistMultiVec<T>& Y ); \
+    template void SparseToSell \
+    ( const SparseMatrix<T>& A, SellCSigmaMatrix<T>& ASell, \
+      Int chunkSize, Int sigma ); \
+    template void Multiply \
+    ( Orientation orientation, \
+            T alpha, \
+      const SellCSigmaMatrix<T>& A, \
+      const Matrix<T>& X, \
+            T beta, \
+            Matrix<T>& Y ); \
+    template void SparseToSell \
+    ( const DistSparseMatrix<T>& A, DistSellCSigmaMatrix<T>& ASell, \
+      Int chunkSize, Int sigma ); \
+    template void Multiply \
+    ( Orientation orientation, \
+            T alpha, \
+      const DistSparseMatrix<T>& A, \
+      const DistSellCSigmaMatrix<T>& ASell, \
       const DistMultiVec<T>& X, \
             T beta, \
             DistMultiVec<T>& Y );
@@ -149,9 +149,9 @@ void LN
     const Int n = A.Height();
     const Int r = A.Width();
 
-    const double weightAwayFromDot = 10.;
-
-    const Int blockSizeDot = 2000;
+    const GemmHeuristics heuristics = TunedGemmHeuristics<T>( C.Grid() );
+    const double weightAwayFromDot = heuristics.weightAwayFromDot;
+    const Int blockSizeDot = heuristics.dotBlocksize;
 
     if( r > weightAwayFromDot*n ) 
         LN_Dot( alpha, A, C, conjugate, blockSizeDot );
@@ -116,9 +116,9 @@ void LT
     const Int r = A.Height();
     const Int n = A.Width();
 
-    const double weightAwayFromDot = 10.;
-
-    const Int blockSizeDot = 2000;
+    const GemmHeuristics heuristics = TunedGemmHeuristics<T>( C.Grid() );
+    const double weightAwayFromDot = heuristics.weightAwayFromDot;
+    const Int blockSizeDot = heuristics.dotBlocksize;
 
     if( r > weightAwayFromDot*n )
         LT_Dot( alpha, A, C, conjugate, blockSizeDot );
@@ -91,6 +91,7 @@ void Trsm
               LogicError("Nonconformal Trsm");
       }
     )
+    BlocksizeScope blocksizeScope( TunedBlocksize<F>( "Trsm", B.Grid() ) );
     B *= alpha;
 
     // Call the single right-hand side algorithm if appropriate
@@ -363,13 +363,13 @@ void DistGraph::ProcessQueues()
     {
         // Compute the send counts
         // -----------------------
-        vector<int> sendCounts(gridSize,0);
+        vector<Int> sendCounts(gridSize,0);
         for( auto s : remoteSources_ )
             ++sendCounts[SourceOwner(s)];
         // Pack the send data
         // ------------------
-        vector<int> sendOffs;
-        const int totalSend = Scan( sendCounts, sendOffs );
+        vector<Int> sendOffs;
+        const Int totalSend = Scan( sendCounts, sendOffs );
         auto offs = sendOffs;
         vector<Int> sendSources(totalSend), sendTargets(totalSend);
         for( Int i=0; i<totalSend; ++i )
@@ -399,14 +399,14 @@ void DistGraph::ProcessQueues()
     {
         // Compute the send counts
         // -----------------------
-        vector<int> sendCounts(gridSize,0);
+        vector<Int> sendCounts(gridSize,0);
         const Int numRemoteRemovals = remoteRemovals_.size();
         for( Int i=0; i<numRemoteRemovals; ++i )
             ++sendCounts[SourceOwner(remoteRemovals_[i].first)];
         // Pack the send data
         // ------------------
-        vector<int> sendOffs;
-        const int totalSend = Scan( sendCounts, sendOffs );
+        vector<Int> sendOffs;
+        const Int totalSend = Scan( sendCounts, sendOffs );
         auto offs = sendOffs;
         vector<Int> sendSources(totalSend), sendTargets(totalSend);
         for( Int i=0; i<totalSend; ++i )
@@ -734,6 +734,48 @@ DistGraphMultMeta DistGraph::InitializeMultMeta() const
       meta.sendInds.data(), meta.sendSizes.data(), meta.sendOffs.data(),
       comm );
 
+    meta.sendNeighbors.clear();
+    meta.recvNeighbors.clear();
+    for( int q=0; q<commSize; ++q )
+    {
+        if( meta.sendSizes[q] != 0 )
+            meta.sendNeighbors.push_back( q );
+        if( meta.recvSizes[q] != 0 )
+            meta.recvNeighbors.push_back( q );
+    }
+
+    // Since the entries of each row are sorted by column, and the unique
+    // columns are sorted (and therefore grouped by owner), the entries
+    // referencing our own portion of the receive buffer are contiguous
+    const int commRank = grid_->Rank();
+    const Int selfBeg = meta.recvOffs[commRank];
+    const Int selfEnd = selfBeg + meta.recvSizes[commRank];
+    const Int numLocalSources = NumLocalSources();
+    const Int* offsetBuf = LockedOffsetBuffer();
+    meta.interiorBeg.resize( numLocalSources );
+    meta.interiorEnd.resize( numLocalSources );
+    meta.boundaryRows.clear();
+    for( Int iLoc=0; iLoc<numLocalSources; ++iLoc )
+    {
+        const Int eStart = offsetBuf[iLoc];
+        const Int eStop = offsetBuf[iLoc+1];
+        Int e = eStart;
+        while( e < eStop && meta.colOffs[e] < selfBeg )
+            ++e;
+        meta.interiorBeg[iLoc] = e;
+        while( e < eStop && meta.colOffs[e] < selfEnd )
+            ++e;
+        meta.interiorEnd[iLoc] = e;
+        EL_DEBUG_ONLY(
+          for( ; e<eStop; ++e )
+              if( meta.colOffs[e] < selfEnd )
+                  LogicError("Entries were not sorted by column");
+        )
+        if( meta.interiorBeg[iLoc] != eStart ||
+            meta.interiorEnd[iLoc] != eStop )
+            meta.boundaryRows.push_back( iLoc );
+    }
+
     meta.numRecvInds = numRecvInds;
     meta.ready = true;
 
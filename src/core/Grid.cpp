@@ -264,6 +264,11 @@ Grid::~Grid()
             mpi::Free( cartComm_ );
             mpi::Free( owningComm_ );
         }
+        for( auto& entry : layerings_ )
+            if( entry.second.depthComm != mpi::COMM_NULL )
+                mpi::Free( entry.second.depthComm );
+        if( nodeComm_ != mpi::COMM_NULL )
+            mpi::Free( nodeComm_ );
         mpi::Free( viewingComm_ );
         if( HaveViewers() )
             mpi::Free( owningGroup_ );
@@ -457,6 +462,54 @@ int Grid::BlacsVRHandle() const { return blacsVRHandle_; }
 int Grid::BlacsMCMRContext() const { return blacsMCMRContext_; }
 #endif
 
+const vector<unique_ptr<Grid>>& Grid::LayerGrids( int numLayers ) const
+{
+    EL_DEBUG_CSE
+    if( numLayers < 1 || size_ % numLayers != 0 )
+        LogicError
+        ("Number of layers, ",numLayers,", does not evenly divide the grid ",
+         "size, ",size_);
+    auto it = layerings_.find( numLayers );
+    if( it != layerings_.end() )
+        return it->second.grids;
+
+    Layering& layering = layerings_[numLayers];
+    const int layerSize = size_ / numLayers;
+    const int layerHeight = DefaultHeight( layerSize );
+    vector<int> ranks(layerSize);
+    layering.grids.resize( numLayers );
+    for( int l=0; l<numLayers; ++l )
+    {
+        for( int r=0; r<layerSize; ++r )
+            ranks[r] = l*layerSize + r;
+        mpi::Group layerGroup;
+        mpi::Incl( owningGroup_, layerSize, ranks.data(), layerGroup );
+        layering.grids[l].reset
+        ( new Grid( viewingComm_, layerGroup, layerHeight ) );
+        mpi::Free( layerGroup );
+    }
+    if( InGrid() )
+        mpi::Split
+        ( owningComm_, owningRank_ % layerSize, owningRank_ / layerSize,
+          layering.depthComm );
+    return layering.grids;
+}
+
+mpi::Comm Grid::LayerDepthComm( int numLayers ) const
+{
+    EL_DEBUG_CSE
+    LayerGrids( numLayers );
+    return layerings_[numLayers].depthComm;
+}
+
+mpi::Comm Grid::NodeComm() const
+{
+    EL_DEBUG_CSE
+    if( nodeComm_ == mpi::COMM_NULL )
+        mpi::SplitShared( viewingComm_, viewingRank_, nodeComm_ );
+    return nodeComm_;
+}
+
 // Comparison functions
 // ====================
 
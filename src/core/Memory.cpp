@@ -0,0 +1,281 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
+#if defined(_WIN32)
+# include <malloc.h>
+#else
+# include <stdlib.h>
+#endif
+#if defined(__linux__)
+# include <sys/mman.h>
+#endif
+
+namespace {
+
+std::atomic<size_t> liveBytes(0);
+std::atomic<size_t> peakBytes(0);
+std::atomic<size_t> numAllocations(0);
+std::atomic<size_t> numFrees(0);
+
+// The current allocator is only accessed through std::atomic_load and
+// std::atomic_store so that Memory<G>::Require does not serialize on a lock
+El::shared_ptr<El::Allocator>& CurrentAllocator()
+{
+    static El::shared_ptr<El::Allocator> allocator =
+      El::make_shared<El::PoolAllocator>();
+    return allocator;
+}
+
+void* AlignedAllocate( size_t numBytes, size_t alignment )
+{
+    if( numBytes == 0 )
+        numBytes = 1;
+#if defined(_WIN32)
+    void* ptr = _aligned_malloc( numBytes, alignment );
+    if( ptr == nullptr )
+        throw std::bad_alloc();
+#else
+    void* ptr = nullptr;
+    if( posix_memalign( &ptr, alignment, numBytes ) != 0 )
+        throw std::bad_alloc();
+#endif
+    return ptr;
+}
+
+void AlignedFree( void* ptr )
+{
+#if defined(_WIN32)
+    _aligned_free( ptr );
+#else
+    free( ptr );
+#endif
+}
+
+// Round up to the nearest quarter-step within the enclosing power of two
+size_t SizeClass( size_t numBytes )
+{
+    const size_t minClass = 256;
+    if( numBytes <= minClass )
+        return minClass;
+    size_t power = minClass;
+    while( power < numBytes/2+(numBytes%2) )
+        power *= 2;
+    // Now power < numBytes <= 2*power
+    const size_t step = power / 4;
+    return power + ((numBytes-power+step-1)/step)*step;
+}
+
+} // anonymous namespace
+
+namespace El {
+
+struct PoolAllocator::Impl
+{
+    AllocatorCtrl ctrl;
+    std::mutex mutex;
+    std::unordered_map<size_t,vector<void*>> pools;
+    size_t cachedBytes=0;
+    size_t numPoolHits=0;
+
+    size_t Alignment( size_t numBytes ) const
+    {
+        size_t alignment = Max(ctrl.alignment,sizeof(void*));
+        if( ctrl.hugePages && numBytes >= ctrl.hugePageBytes )
+            alignment = Max(alignment,ctrl.hugePageBytes);
+        return alignment;
+    }
+
+    void* Fresh( size_t numBytes )
+    {
+        void* ptr = AlignedAllocate( numBytes, Alignment(numBytes) );
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+        if( ctrl.hugePages && numBytes >= ctrl.hugePageBytes )
+            madvise( ptr, numBytes, MADV_HUGEPAGE );
+#endif
+        if( ctrl.firstTouch && numBytes >= ctrl.pageBytes )
+        {
+            // Touch each page from the thread that will (most likely) use it
+            // so that the operating system places it on the local NUMA node
+            byte* bytePtr = static_cast<byte*>(ptr);
+            const Int pageBytes = ctrl.pageBytes;
+            const Int numPages = (numBytes+pageBytes-1) / pageBytes;
+            EL_PARALLEL_FOR
+            for( Int page=0; page<numPages; ++page )
+                bytePtr[page*pageBytes] = 0;
+        }
+        return ptr;
+    }
+};
+
+PoolAllocator::PoolAllocator( const AllocatorCtrl& ctrl )
+: impl_(new Impl)
+{
+    EL_DEBUG_CSE
+    const size_t alignment = ctrl.alignment;
+    if( alignment == 0 || (alignment & (alignment-1)) != 0 )
+        LogicError("Allocator alignment must be a power of two");
+    if( ctrl.hugePages &&
+        (ctrl.hugePageBytes == 0 ||
+         (ctrl.hugePageBytes & (ctrl.hugePageBytes-1)) != 0) )
+        LogicError("Huge page size must be a power of two");
+    impl_->ctrl = ctrl;
+}
+
+PoolAllocator::~PoolAllocator()
+{ Trim(); }
+
+void* PoolAllocator::Allocate( size_t numBytes )
+{
+    const AllocatorCtrl& ctrl = impl_->ctrl;
+    if( !ctrl.pool || numBytes > ctrl.maxPooledBytes )
+        return impl_->Fresh( numBytes );
+
+    const size_t classBytes = SizeClass( numBytes );
+    {
+        std::lock_guard<std::mutex> guard( impl_->mutex );
+        auto it = impl_->pools.find( classBytes );
+        if( it != impl_->pools.end() && !it->second.empty() )
+        {
+            void* ptr = it->second.back();
+            it->second.pop_back();
+            impl_->cachedBytes -= classBytes;
+            ++impl_->numPoolHits;
+            return ptr;
+        }
+    }
+    return impl_->Fresh( classBytes );
+}
+
+void PoolAllocator::Free( void* buffer, size_t numBytes ) EL_NO_EXCEPT
+{
+    if( buffer == nullptr )
+        return;
+    const AllocatorCtrl& ctrl = impl_->ctrl;
+    if( !ctrl.pool || numBytes > ctrl.maxPooledBytes )
+    {
+        AlignedFree( buffer );
+        return;
+    }
+
+    const size_t classBytes = SizeClass( numBytes );
+    {
+        std::lock_guard<std::mutex> guard( impl_->mutex );
+        if( impl_->cachedBytes + classBytes <= ctrl.maxCachedBytes )
+        {
+            try
+            {
+                impl_->pools[classBytes].push_back( buffer );
+                impl_->cachedBytes += classBytes;
+                return;
+            }
+            catch( ... ) { }
+        }
+    }
+    AlignedFree( buffer );
+}
+
+void PoolAllocator::Trim()
+{
+    std::lock_guard<std::mutex> guard( impl_->mutex );
+    for( auto& entry : impl_->pools )
+    {
+        for( void* ptr : entry.second )
+            AlignedFree( ptr );
+        SwapClear( entry.second );
+    }
+    impl_->pools.clear();
+    impl_->cachedBytes = 0;
+}
+
+const AllocatorCtrl& PoolAllocator::Ctrl() const EL_NO_EXCEPT
+{ return impl_->ctrl; }
+
+size_t PoolAllocator::CachedBytes() const
+{
+    std::lock_guard<std::mutex> guard( impl_->mutex );
+    return impl_->cachedBytes;
+}
+
+size_t PoolAllocator::NumPoolHits() const
+{
+    std::lock_guard<std::mutex> guard( impl_->mutex );
+    return impl_->numPoolHits;
+}
+
+shared_ptr<Allocator> GetAllocator()
+{ return std::atomic_load( &::CurrentAllocator() ); }
+
+void SetAllocator( shared_ptr<Allocator> allocator )
+{
+    EL_DEBUG_CSE
+    if( !allocator )
+        LogicError("Cannot set a null allocator");
+    std::atomic_store( &::CurrentAllocator(), allocator );
+}
+
+void SetAllocatorCtrl( const AllocatorCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    SetAllocator( make_shared<PoolAllocator>( ctrl ) );
+}
+
+void TrimAllocator()
+{
+    EL_DEBUG_CSE
+    GetAllocator()->Trim();
+}
+
+MemoryStats GetMemoryStats()
+{
+    MemoryStats stats;
+    stats.liveBytes = ::liveBytes.load();
+    stats.peakBytes = ::peakBytes.load();
+    stats.numAllocations = ::numAllocations.load();
+    stats.numFrees = ::numFrees.load();
+    return stats;
+}
+
+void ResetPeakMemory()
+{ ::peakBytes.store( ::liveBytes.load() ); }
+
+void PrintMemoryStats( ostream& os )
+{
+    const MemoryStats stats = GetMemoryStats();
+    os << "Memory statistics:\n"
+       << "  Live bytes:       " << stats.liveBytes << "\n"
+       << "  Peak bytes:       " << stats.peakBytes << "\n"
+       << "  # of allocations: " << stats.numAllocations << "\n"
+       << "  # of frees:       " << stats.numFrees << "\n";
+    auto pool = std::dynamic_pointer_cast<PoolAllocator>( GetAllocator() );
+    if( pool )
+        os << "  Cached bytes:     " << pool->CachedBytes() << "\n"
+           << "  # of pool hits:   " << pool->NumPoolHits() << "\n";
+    os << endl;
+}
+
+void RecordAllocation( size_t numBytes ) EL_NO_EXCEPT
+{
+    ++::numAllocations;
+    const size_t live = (::liveBytes += numBytes);
+    size_t peak = ::peakBytes.load();
+    while( live > peak && !::peakBytes.compare_exchange_weak( peak, live ) );
+}
+
+void RecordFree( size_t numBytes ) EL_NO_EXCEPT
+{
+    ++::numFrees;
+    ::liveBytes -= numBytes;
+}
+
+} // namespace El
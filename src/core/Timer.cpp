@@ -7,6 +7,83 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El-lite.hpp>
+#include <algorithm>
+#include <iomanip>
+#include <map>
+
+namespace {
+
+struct ActiveRegion
+{
+    std::string path;
+    double startTime;
+};
+
+struct RegionStats
+{
+    El::Int numCalls=0;
+    double time=0;
+};
+
+struct RegionEvent
+{
+    std::string path;
+    double startTime, duration;
+};
+
+bool regionTimersEnabled = false;
+bool regionTraceEnabled = false;
+std::string regionTraceFile;
+
+// Measures the time since the region timers were first enabled, which is
+// used as the origin of the trace events
+El::Timer regionClock;
+std::vector<ActiveRegion> regionStack;
+std::map<std::string,RegionStats> regionStats;
+std::vector<RegionEvent> regionEvents;
+
+// Gathers the strings of each process in 'comm' onto its root
+std::vector<std::string>
+GatherStrings( const std::string& localString, El::mpi::Comm comm )
+{
+    using namespace El;
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+    const int localSize = localString.size();
+    vector<int> sizes( commSize );
+    mpi::Gather( &localSize, 1, sizes.data(), 1, 0, comm );
+    vector<int> offsets;
+    const int totalSize = Scan( sizes, offsets );
+
+    vector<byte> allBytes( Max(totalSize,1) );
+    mpi::Gather
+    ( reinterpret_cast<const byte*>(localString.data()), localSize,
+      allBytes.data(), sizes.data(), offsets.data(), 0, comm );
+
+    vector<std::string> strings;
+    if( commRank == 0 )
+    {
+        strings.resize( commSize );
+        for( int q=0; q<commSize; ++q )
+            strings[q].assign
+            ( reinterpret_cast<const char*>(&allBytes[offsets[q]]), sizes[q] );
+    }
+    return strings;
+}
+
+std::string JSONEscape( const std::string& str )
+{
+    std::string escaped;
+    for( const char c : str )
+    {
+        if( c == '"' || c == '\\' )
+            escaped += '\\';
+        escaped += c;
+    }
+    return escaped;
+}
+
+} // anonymous namespace
 
 namespace El {
 
@@ -54,6 +131,8 @@ double Timer::Partial() const
         return lastPartialTime_; 
 }
 
+bool Timer::Running() const { return running_; }
+
 double Timer::Total() const
 {
     if( running_ )
@@ -62,4 +141,269 @@ double Timer::Total() const
         return totalTime_;
 }
 
+// Region timers
+// =============
+
+void EnableRegionTimers()
+{
+    if( !::regionClock.Running() )
+        ::regionClock.Start();
+    ::regionTimersEnabled = true;
+}
+void DisableRegionTimers()
+{
+    ::regionTimersEnabled = false;
+    ::regionStack.clear();
+}
+bool RegionTimersEnabled() { return ::regionTimersEnabled; }
+
+void ResetRegionTimers()
+{
+    ::regionStats.clear();
+    ::regionEvents.clear();
+}
+
+void EnableRegionTrace( const string& filename )
+{
+    EnableRegionTimers();
+    ::regionTraceEnabled = true;
+    if( !filename.empty() )
+        ::regionTraceFile = filename;
+}
+void DisableRegionTrace() { ::regionTraceEnabled = false; }
+bool RegionTraceEnabled() { return ::regionTraceEnabled; }
+
+void PushRegion( const string& name )
+{
+    if( !::regionTimersEnabled )
+        return;
+#ifdef EL_HYBRID
+    if( omp_get_thread_num() != 0 )
+        return;
+#endif
+    ActiveRegion region;
+    region.path =
+      ( ::regionStack.empty() ? name : ::regionStack.back().path+"/"+name );
+    region.startTime = ::regionClock.Partial();
+    ::regionStack.push_back( region );
+}
+
+void PopRegion()
+{
+#ifdef EL_HYBRID
+    if( omp_get_thread_num() != 0 )
+        return;
+#endif
+    // The stack is empty if the timers were enabled within the region
+    if( !::regionTimersEnabled || ::regionStack.empty() )
+        return;
+    const ActiveRegion& region = ::regionStack.back();
+    const double duration = ::regionClock.Partial() - region.startTime;
+    auto& stats = ::regionStats[region.path];
+    ++stats.numCalls;
+    stats.time += duration;
+    if( ::regionTraceEnabled )
+    {
+        RegionEvent event;
+        event.path = region.path;
+        event.startTime = region.startTime;
+        event.duration = duration;
+        ::regionEvents.push_back( event );
+    }
+    ::regionStack.pop_back();
+}
+
+Int RegionCalls( const string& path )
+{
+    auto it = ::regionStats.find( path );
+    return ( it == ::regionStats.end() ? 0 : it->second.numCalls );
+}
+
+double RegionTime( const string& path )
+{
+    auto it = ::regionStats.find( path );
+    return ( it == ::regionStats.end() ? 0. : it->second.time );
+}
+
+ScopedRegionTimers::ScopedRegionTimers( bool enable, mpi::Comm comm )
+: owner_(enable && !RegionTimersEnabled()), comm_(comm)
+{
+    if( owner_ )
+    {
+        ResetRegionTimers();
+        EnableRegionTimers();
+    }
+}
+
+ScopedRegionTimers::~ScopedRegionTimers()
+{
+    if( !owner_ )
+        return;
+    // The summary is collective, so it is skipped if an exception is being
+    // propagated (which need not be the case on every process)
+    if( !std::uncaught_exception() )
+    {
+        try { PrintRegionTimers( comm_ ); }
+        catch( std::exception& e ) { ReportException(e); }
+    }
+    DisableRegionTimers();
+    ResetRegionTimers();
+}
+
+void PrintRegionTimers( mpi::Comm comm, ostream& os )
+{
+    EL_DEBUG_CSE
+    std::ostringstream localStream;
+    localStream << std::setprecision(17);
+    for( const auto& pair : ::regionStats )
+        localStream << pair.first << '\t' << pair.second.numCalls << '\t'
+                    << pair.second.time << '\n';
+    const auto strings = GatherStrings( localStream.str(), comm );
+    if( mpi::Rank(comm) != 0 )
+        return;
+
+    struct Aggregate
+    {
+        Int numCalls=0, numProcs=0;
+        double minTime=0, sumTime=0, maxTime=0;
+    };
+    std::map<string,Aggregate> aggregates;
+    for( const auto& procString : strings )
+    {
+        std::istringstream procStream( procString );
+        string line;
+        while( std::getline( procStream, line ) )
+        {
+            std::istringstream lineStream( line );
+            string path;
+            std::getline( lineStream, path, '\t' );
+            RegionStats stats;
+            lineStream >> stats.numCalls >> stats.time;
+
+            auto& aggregate = aggregates[path];
+            aggregate.minTime =
+              ( aggregate.numProcs == 0 ? stats.time
+                                        : Min(aggregate.minTime,stats.time) );
+            aggregate.maxTime = Max( aggregate.maxTime, stats.time );
+            aggregate.sumTime += stats.time;
+            aggregate.numCalls = Max( aggregate.numCalls, stats.numCalls );
+            ++aggregate.numProcs;
+        }
+    }
+
+    // Processes which never entered a region spent no time in it. The paths
+    // are sorted so that each region directly precedes its subregions, which
+    // are indented by their depth.
+    const int commSize = strings.size();
+    size_t nameWidth = 6;
+    for( const auto& pair : aggregates )
+    {
+        const size_t depth =
+          std::count( pair.first.begin(), pair.first.end(), '/' );
+        const size_t nameBeg = pair.first.rfind('/');
+        const size_t nameSize =
+          pair.first.size() - ( nameBeg==string::npos ? 0 : nameBeg+1 );
+        nameWidth = Max( nameWidth, 2*depth+nameSize );
+    }
+    std::ostringstream msg;
+    msg << "Region timers over " << commSize << " processes "
+        << "(times are inclusive and in seconds)\n"
+        << std::left << std::setw(nameWidth) << "region" << std::right
+        << std::setw(10) << "calls" << std::setw(12) << "min time"
+        << std::setw(12) << "avg time" << std::setw(12) << "max time"
+        << std::setw(11) << "imbalance" << "\n";
+    for( const auto& pair : aggregates )
+    {
+        const auto& aggregate = pair.second;
+        const double minTime =
+          ( aggregate.numProcs < commSize ? 0. : aggregate.minTime );
+        const double avgTime = aggregate.sumTime / commSize;
+        const size_t depth =
+          std::count( pair.first.begin(), pair.first.end(), '/' );
+        const size_t nameBeg = pair.first.rfind('/');
+        const string name =
+          ( nameBeg==string::npos ? pair.first : pair.first.substr(nameBeg+1) );
+        msg << std::left << std::setw(nameWidth)
+            << string(2*depth,' ')+name << std::right
+            << std::setw(10) << aggregate.numCalls
+            << std::fixed << std::setprecision(6)
+            << std::setw(12) << minTime
+            << std::setw(12) << avgTime
+            << std::setw(12) << aggregate.maxTime
+            << std::setprecision(2)
+            << std::setw(11)
+            << ( avgTime > 0 ? aggregate.maxTime/avgTime : 1. )
+            << "\n";
+    }
+    os << msg.str();
+    os.flush();
+}
+
+void WriteRegionTrace( const string& filename, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    std::ostringstream localStream;
+    localStream << std::setprecision(17);
+    for( const auto& event : ::regionEvents )
+        localStream << event.path << '\t' << event.startTime << '\t'
+                    << event.duration << '\n';
+    const auto strings = GatherStrings( localStream.str(), comm );
+    if( mpi::Rank(comm) != 0 )
+        return;
+
+    std::ofstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    // Trace event timestamps and durations are in microseconds
+    file << "{\"traceEvents\":[";
+    file << std::fixed << std::setprecision(3);
+    bool first = true;
+    for( size_t q=0; q<strings.size(); ++q )
+    {
+        std::istringstream procStream( strings[q] );
+        string line;
+        while( std::getline( procStream, line ) )
+        {
+            std::istringstream lineStream( line );
+            string path;
+            std::getline( lineStream, path, '\t' );
+            double startTime, duration;
+            lineStream >> startTime >> duration;
+            const size_t nameBeg = path.rfind('/');
+            const string name =
+              ( nameBeg==string::npos ? path : path.substr(nameBeg+1) );
+
+            file << ( first ? "\n" : ",\n" )
+                 << "{\"name\":\"" << JSONEscape(name) << "\","
+                 << "\"cat\":\"El\",\"ph\":\"X\","
+                 << "\"ts\":" << 1e6*startTime << ","
+                 << "\"dur\":" << 1e6*duration << ","
+                 << "\"pid\":" << q << ",\"tid\":0,"
+                 << "\"args\":{\"path\":\"" << JSONEscape(path) << "\"}}";
+            first = false;
+        }
+    }
+    file << "\n]}\n";
+}
+
+void InitializeRegionTimers()
+{
+    const char* timersVar = std::getenv("EL_REGION_TIMERS");
+    if( timersVar != nullptr && string(timersVar) != "0" )
+        EnableRegionTimers();
+    const char* traceVar = std::getenv("EL_REGION_TRACE");
+    if( traceVar != nullptr && string(traceVar) != "" )
+        EnableRegionTrace( traceVar );
+}
+
+void FinalizeRegionTimers()
+{
+    if( ::regionTimersEnabled )
+    {
+        PrintRegionTimers();
+        if( ::regionTraceEnabled && !::regionTraceFile.empty() )
+            WriteRegionTrace( ::regionTraceFile );
+    }
+}
+
 } // namespace El
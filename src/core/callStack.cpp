@@ -7,13 +7,12 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El-lite.hpp>
-#include <stack>
 
 namespace {
 
 // Debugging
 EL_DEBUG_ONLY(
-  std::stack<std::string> callStack;
+  std::vector<std::string> callStack;
   bool tracingEnabled = false;
 )
 
@@ -48,7 +47,7 @@ EL_DEBUG_ONLY(
           DumpCallStack();
           return;
       }
-      ::callStack.push(s); 
+      ::callStack.push_back(s);
       if( ::tracingEnabled )
       {
           const int stackSize = ::callStack.size();
@@ -71,7 +70,7 @@ EL_DEBUG_ONLY(
 #endif
       if( ::callStack.empty() )
           LogicError("Attempted to pop an empty call stack");
-      ::callStack.pop(); 
+      ::callStack.pop_back();
   }
 
   void DumpCallStack( ostream& os )
@@ -79,14 +78,57 @@ EL_DEBUG_ONLY(
       ostringstream msg;
       while( ! ::callStack.empty() )
       {
-          msg << "[" << ::callStack.size() << "]: " << ::callStack.top() 
+          msg << "[" << ::callStack.size() << "]: " << ::callStack.back()
               << "\n";
-          ::callStack.pop();
+          ::callStack.pop_back();
       }
       os << msg.str();
       os.flush();
   }
 
+  string CallStackFunctionName( const string& entry )
+  {
+      string name = entry;
+      const string anonymous = "(anonymous namespace)::";
+      for( auto pos=name.find(anonymous); pos!=string::npos;
+           pos=name.find(anonymous) )
+          name.erase( pos, anonymous.size() );
+      // Drop the parameters (and any template arguments listed after them)
+      const auto argsBeg = name.find('(');
+      if( argsBeg != string::npos )
+          name.erase( argsBeg );
+      // Drop the return type, which ends with the last space outside of any
+      // template argument list
+      Int depth = 0;
+      for( auto k=name.size(); k>0; --k )
+      {
+          const char c = name[k-1];
+          if( c == '>' )
+              ++depth;
+          else if( c == '<' )
+              --depth;
+          else if( c == ' ' && depth == 0 )
+          {
+              name.erase( 0, k );
+              break;
+          }
+      }
+      return name;
+  }
+
+  string InnermostCallStackEntry( const string& exclude )
+  {
+      for( auto it=::callStack.rbegin(); it!=::callStack.rend(); ++it )
+      {
+          if( exclude.empty() )
+              return *it;
+          const string name = CallStackFunctionName( *it );
+          if( name.compare(0,exclude.size(),exclude) != 0 )
+              return *it;
+      }
+      return string();
+  }
+
 ) // EL_DEBUG_ONLY
 
 } // namespace El
@@ -191,6 +191,12 @@ void Initialize( int& argc, char**& argv )
 #endif
 
     InitializeRandom();
+    InitializeRegionTimers();
+
+    // Load the tuned algorithmic parameters (if a profile was specified)
+    const char* profileVar = std::getenv("EL_TUNING_PROFILE");
+    if( profileVar != nullptr && string(profileVar) != "" )
+        LoadTuningProfile( profileVar );
 
     // Create the types and ops.
     // mpfr::SetPrecision within InitializeRandom created the BigFloat types
@@ -211,6 +217,13 @@ void Finalize()
         cerr << "Warning: MPI was finalized before Elemental." << endl;
     if( ::numElemInits == 0 )
     {
+        if( !mpi::Finalized() )
+        {
+            FinalizeRegionTimers();
+            if( mpi::Profiling() )
+                mpi::PrintProfile();
+        }
+
         delete ::args;
         ::args = 0;
 
@@ -234,6 +247,9 @@ void Finalize()
 #endif
 
         FinalizeRandom();
+
+        // Return any pooled buffers to the operating system
+        TrimAllocator();
     }
 
     EL_DEBUG_ONLY( CloseLog() )
@@ -38,3 +38,6 @@ using El::dcomplex;
 #include "./blas/Syr2k.hpp"
 #include "./blas/Trmm.hpp"
 #include "./blas/Trsm.hpp"
+
+// Thread control
+#include "./blas/Threads.hpp"
@@ -44,27 +44,13 @@ void EL_BLAS(zgemm)
 namespace El {
 namespace blas {
 
+namespace gemm {
+
+// NOTE: Temporaries are avoided since constructing a BigInt/BigFloat
+//       involves a memory allocation
 template<typename T>
-void Gemm
-( char transA, char transB,
-  BlasInt m, BlasInt n, BlasInt k,
-  const T& alpha,
-  const T* A, BlasInt ALDim,
-  const T* B, BlasInt BLDim,
-  const T& beta,
-        T* C, BlasInt CLDim )
+void ScaleC( BlasInt m, BlasInt n, const T& beta, T* C, BlasInt CLDim )
 {
-    // NOTE: Temporaries are avoided since constructing a BigInt/BigFloat
-    //       involves a memory allocation
-    if( m > 0 && n > 0 && k == 0 && beta == T(0) )
-    {
-        for( BlasInt j=0; j<n; ++j )
-            for( BlasInt i=0; i<m; ++i )
-                C[i+j*CLDim] = 0;
-        return;
-    }
-
-    // Scale C
     if( beta == T(0) )
     {
         for( BlasInt j=0; j<n; ++j )
@@ -77,6 +63,21 @@ void Gemm
             for( BlasInt i=0; i<m; ++i )
                 C[i+j*CLDim] *= beta;
     }
+}
+
+} // namespace gemm
+
+template<typename T>
+void NaiveGemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+  const T* B, BlasInt BLDim,
+  const T& beta,
+        T* C, BlasInt CLDim )
+{
+    gemm::ScaleC( m, n, beta, C, CLDim );
 
     // Naive implementation
     T gamma, delta;
@@ -260,6 +261,297 @@ void Gemm
         }
     }
 }
+template void NaiveGemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k, 
+  const Int& alpha,
+  const Int* A, BlasInt ALDim,
+  const Int* B, BlasInt BLDim,
+  const Int& beta,
+        Int* C, BlasInt CLDim );
+#ifdef EL_HAVE_QD
+template void NaiveGemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k, 
+  const DoubleDouble& alpha,
+  const DoubleDouble* A, BlasInt ALDim,
+  const DoubleDouble* B, BlasInt BLDim,
+  const DoubleDouble& beta,
+        DoubleDouble* C, BlasInt CLDim );
+template void NaiveGemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k, 
+  const QuadDouble& alpha,
+  const QuadDouble* A, BlasInt ALDim,
+  const QuadDouble* B, BlasInt BLDim,
+  const QuadDouble& beta,
+        QuadDouble* C, BlasInt CLDim );
+template void NaiveGemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k, 
+  const Complex<DoubleDouble>& alpha,
+  const Complex<DoubleDouble>* A, BlasInt ALDim,
+  const Complex<DoubleDouble>* B, BlasInt BLDim,
+  const Complex<DoubleDouble>& beta,
+        Complex<DoubleDouble>* C, BlasInt CLDim );
+template void NaiveGemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k, 
+  const Complex<QuadDouble>& alpha,
+  const Complex<QuadDouble>* A, BlasInt ALDim,
+  const Complex<QuadDouble>* B, BlasInt BLDim,
+  const Complex<QuadDouble>& beta,
+        Complex<QuadDouble>* C, BlasInt CLDim );
+#endif
+#ifdef EL_HAVE_QUAD
+template void NaiveGemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k, 
+  const Quad& alpha,
+  const Quad* A, BlasInt ALDim,
+  const Quad* B, BlasInt BLDim,
+  const Quad& beta,
+        Quad* C, BlasInt CLDim );
+template void NaiveGemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k, 
+  const Complex<Quad>& alpha,
+  const Complex<Quad>* A, BlasInt ALDim, 
+  const Complex<Quad>* B, BlasInt BLDim,
+  const Complex<Quad>& beta,
+        Complex<Quad>* C, BlasInt CLDim );
+#endif
+#ifdef EL_HAVE_MPC
+template void NaiveGemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k, 
+  const BigInt& alpha,
+  const BigInt* A, BlasInt ALDim,
+  const BigInt* B, BlasInt BLDim,
+  const BigInt& beta,
+        BigInt* C, BlasInt CLDim );
+template void NaiveGemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k, 
+  const BigFloat& alpha,
+  const BigFloat* A, BlasInt ALDim,
+  const BigFloat* B, BlasInt BLDim,
+  const BigFloat& beta,
+        BigFloat* C, BlasInt CLDim );
+template void NaiveGemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k, 
+  const Complex<BigFloat>& alpha,
+  const Complex<BigFloat>* A, BlasInt ALDim,
+  const Complex<BigFloat>* B, BlasInt BLDim,
+  const Complex<BigFloat>& beta,
+        Complex<BigFloat>* C, BlasInt CLDim );
+#endif
+
+namespace gemm {
+
+// The register (MR x NR) and cache (MC x KC and KC x NC) blocksizes of the
+// packed generic Gemm. Since the generic path serves extended-precision
+// types, whose arithmetic is far more expensive than their memory traffic,
+// these are modest and independent of the scalar type.
+const BlasInt MR = 4;
+const BlasInt NR = 4;
+const BlasInt MC = 64;
+const BlasInt KC = 256;
+const BlasInt NC = 1024;
+
+// Products requiring fewer multiply-adds than this are not worth packing
+const double packingCutoff = 16.*16.*16.;
+
+// The generic Trsm, Trmm, Herk, and Syrk only perform the work involving
+// diagonal blocks of this size outside of Gemm
+const BlasInt triangularBlocksize = 64;
+
+// Pack op(A), which is mc x kc, into row panels of height MR, with the MR
+// entries of each column of a panel stored contiguously (and zero-padded)
+template<typename T>
+void PackA
+( char transA, BlasInt mc, BlasInt kc,
+  const T* A, BlasInt ALDim, T* APack )
+{
+    const bool normal = ( std::toupper(transA) == 'N' );
+    const bool conjugate = ( std::toupper(transA) == 'C' );
+    for( BlasInt ir=0; ir<mc; ir+=MR )
+    {
+        const BlasInt mr = Min(MR,mc-ir);
+        T* APanel = &APack[ir*kc];
+        for( BlasInt l=0; l<kc; ++l )
+        {
+            for( BlasInt i=0; i<mr; ++i )
+            {
+                if( normal )
+                    APanel[i+l*MR] = A[(ir+i)+l*ALDim];
+                else if( conjugate )
+                    Conj( A[l+(ir+i)*ALDim], APanel[i+l*MR] );
+                else
+                    APanel[i+l*MR] = A[l+(ir+i)*ALDim];
+            }
+            for( BlasInt i=mr; i<MR; ++i )
+                APanel[i+l*MR] = 0;
+        }
+    }
+}
+
+// Pack alpha op(B), which is kc x nc, into column panels of width NR, with
+// the NR entries of each row of a panel stored contiguously (and zero-padded)
+template<typename T>
+void PackB
+( char transB, BlasInt kc, BlasInt nc,
+  const T& alpha, const T* B, BlasInt BLDim, T* BPack )
+{
+    const bool normal = ( std::toupper(transB) == 'N' );
+    const bool conjugate = ( std::toupper(transB) == 'C' );
+    const bool scale = ( alpha != T(1) );
+    for( BlasInt jr=0; jr<nc; jr+=NR )
+    {
+        const BlasInt nr = Min(NR,nc-jr);
+        T* BPanel = &BPack[jr*kc];
+        for( BlasInt l=0; l<kc; ++l )
+        {
+            for( BlasInt j=0; j<nr; ++j )
+            {
+                T& beta = BPanel[j+l*NR];
+                if( normal )
+                    beta = B[l+(jr+j)*BLDim];
+                else if( conjugate )
+                    Conj( B[(jr+j)+l*BLDim], beta );
+                else
+                    beta = B[(jr+j)+l*BLDim];
+                if( scale )
+                    beta *= alpha;
+            }
+            for( BlasInt j=nr; j<NR; ++j )
+                BPanel[j+l*NR] = 0;
+        }
+    }
+}
+
+// C(0:mr,0:nr) += APanel BPanel, where the MR x NR product is first
+// accumulated into AB
+template<typename T>
+void MicroKernel
+( BlasInt mr, BlasInt nr, BlasInt kc,
+  const T* EL_RESTRICT APanel,
+  const T* EL_RESTRICT BPanel,
+        T* EL_RESTRICT C, BlasInt CLDim,
+        T* EL_RESTRICT AB, T& delta )
+{
+    for( BlasInt s=0; s<MR*NR; ++s )
+        AB[s] = 0;
+    for( BlasInt l=0; l<kc; ++l )
+    {
+        const T* a = &APanel[l*MR];
+        const T* b = &BPanel[l*NR];
+        for( BlasInt j=0; j<NR; ++j )
+        {
+            for( BlasInt i=0; i<MR; ++i )
+            {
+                delta = a[i];
+                delta *= b[j];
+                AB[i+j*MR] += delta;
+            }
+        }
+    }
+    for( BlasInt j=0; j<nr; ++j )
+        for( BlasInt i=0; i<mr; ++i )
+            C[i+j*CLDim] += AB[i+j*MR];
+}
+
+// C := alpha op(A) op(B) + C via the Goto/BLIS loop ordering: alpha op(B) is
+// packed in KC x NC blocks shared by all threads, and each thread packs and
+// multiplies its own MC x KC blocks of op(A).
+template<typename T>
+void Packed
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+  const T* B, BlasInt BLDim,
+        T* C, BlasInt CLDim )
+{
+    const bool normalA = ( std::toupper(transA) == 'N' );
+    const bool normalB = ( std::toupper(transB) == 'N' );
+    const BlasInt numRowBlocks = (m+MC-1)/MC;
+    const BlasInt kcMax = Min(KC,k);
+    const BlasInt ncMax = Min(NC,n);
+    std::vector<T> BPack( ((ncMax+NR-1)/NR)*NR*kcMax );
+
+#ifdef EL_HYBRID
+    #pragma omp parallel if( numRowBlocks > 1 && !omp_in_parallel() )
+#endif
+    {
+        std::vector<T> APack( MC*kcMax ), AB( MR*NR );
+        T delta;
+        for( BlasInt jc=0; jc<n; jc+=NC )
+        {
+            const BlasInt nc = Min(NC,n-jc);
+            for( BlasInt pc=0; pc<k; pc+=KC )
+            {
+                const BlasInt kc = Min(KC,k-pc);
+                const T* BBlock =
+                  ( normalB ? &B[pc+jc*BLDim] : &B[jc+pc*BLDim] );
+#ifdef EL_HYBRID
+                #pragma omp single
+#endif
+                PackB( transB, kc, nc, alpha, BBlock, BLDim, BPack.data() );
+
+#ifdef EL_HYBRID
+                #pragma omp for schedule(static)
+#endif
+                for( BlasInt block=0; block<numRowBlocks; ++block )
+                {
+                    const BlasInt ic = block*MC;
+                    const BlasInt mc = Min(MC,m-ic);
+                    const T* ABlock =
+                      ( normalA ? &A[ic+pc*ALDim] : &A[pc+ic*ALDim] );
+                    PackA( transA, mc, kc, ABlock, ALDim, APack.data() );
+                    for( BlasInt jr=0; jr<nc; jr+=NR )
+                    {
+                        const BlasInt nr = Min(NR,nc-jr);
+                        for( BlasInt ir=0; ir<mc; ir+=MR )
+                        {
+                            const BlasInt mr = Min(MR,mc-ir);
+                            MicroKernel
+                            ( mr, nr, kc, &APack[ir*kc], &BPack[jr*kc],
+                              &C[(ic+ir)+(jc+jr)*CLDim], CLDim,
+                              AB.data(), delta );
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+} // namespace gemm
+
+template<typename T>
+void Gemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+  const T* B, BlasInt BLDim,
+  const T& beta,
+        T* C, BlasInt CLDim )
+{
+    if( double(m)*double(n)*double(k) < gemm::packingCutoff )
+    {
+        NaiveGemm
+        ( transA, transB, m, n, k,
+          alpha, A, ALDim, B, BLDim, beta, C, CLDim );
+        return;
+    }
+    gemm::ScaleC( m, n, beta, C, CLDim );
+    gemm::Packed
+    ( transA, transB, m, n, k, alpha, A, ALDim, B, BLDim, C, CLDim );
+}
+
 template void Gemm
 ( char transA, char transB,
   BlasInt m, BlasInt n, BlasInt k, 
@@ -55,7 +55,7 @@ namespace El {
 namespace blas {
 
 template<typename T>
-void Herk
+void NaiveHerk
 ( char uplo, char trans,
   BlasInt n, BlasInt k,
   const Base<T>& alpha,
@@ -163,7 +163,59 @@ void Herk
         }
     }
 }
+
+// Blocked Hermitian rank-k update which only computes the diagonal blocks
+// of C directly and casts the remainder into the packed generic Gemm
+template<typename T>
+void Herk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  const Base<T>& alpha,
+  const T* A, BlasInt ALDim,
+  const Base<T>& beta,
+        T* C, BlasInt CLDim )
+{
+    const BlasInt bsize = gemm::triangularBlocksize;
+    if( n <= bsize )
+    {
+        NaiveHerk( uplo, trans, n, k, alpha, A, ALDim, beta, C, CLDim );
+        return;
+    }
+    gemm::ScaleC( n, n, T(beta), C, CLDim );
+
+    const bool normal = ( std::toupper(trans) == 'N' );
+    const bool lower = ( std::toupper(uplo) == 'L' );
+    const T alphaT( alpha ), one(1);
+    for( BlasInt j=0; j<n; j+=bsize )
+    {
+        const BlasInt nb = Min(bsize,n-j);
+        const T* A1 = ( normal ? &A[j] : &A[j*ALDim] );
+        NaiveHerk
+        ( uplo, trans, nb, k, alpha, A1, ALDim, Base<T>(1),
+          &C[j+j*CLDim], CLDim );
+        if( lower )
+        {
+            const T* A2 = ( normal ? &A[j+nb] : &A[(j+nb)*ALDim] );
+            Gemm
+            ( (normal ? 'N' : 'C'), (normal ? 'C' : 'N'), n-(j+nb), nb, k,
+              alphaT, A2, ALDim, A1, ALDim, one, &C[(j+nb)+j*CLDim], CLDim );
+        }
+        else
+        {
+            Gemm
+            ( (normal ? 'N' : 'C'), (normal ? 'C' : 'N'), j, nb, k,
+              alphaT, A, ALDim, A1, ALDim, one, &C[j*CLDim], CLDim );
+        }
+    }
+}
 template void Herk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  const Int& alpha,
+  const Int* A, BlasInt ALDim,
+  const Int& beta,
+        Int* C, BlasInt CLDim );
+template void NaiveHerk
 ( char uplo, char trans,
   BlasInt n, BlasInt k,
   const Int& alpha,
@@ -172,6 +224,13 @@ template void Herk
         Int* C, BlasInt CLDim );
 #ifdef EL_HAVE_QD
 template void Herk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  const DoubleDouble& alpha,
+  const DoubleDouble* A, BlasInt ALDim,
+  const DoubleDouble& beta,
+        DoubleDouble* C, BlasInt CLDim );
+template void NaiveHerk
 ( char uplo, char trans,
   BlasInt n, BlasInt k,
   const DoubleDouble& alpha,
@@ -179,6 +238,13 @@ template void Herk
   const DoubleDouble& beta,
         DoubleDouble* C, BlasInt CLDim );
 template void Herk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  const QuadDouble& alpha,
+  const QuadDouble* A, BlasInt ALDim,
+  const QuadDouble& beta,
+        QuadDouble* C, BlasInt CLDim );
+template void NaiveHerk
 ( char uplo, char trans,
   BlasInt n, BlasInt k,
   const QuadDouble& alpha,
@@ -186,6 +252,13 @@ template void Herk
   const QuadDouble& beta,
         QuadDouble* C, BlasInt CLDim );
 template void Herk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  const DoubleDouble& alpha,
+  const Complex<DoubleDouble>* A, BlasInt ALDim,
+  const DoubleDouble& beta,
+        Complex<DoubleDouble>* C, BlasInt CLDim );
+template void NaiveHerk
 ( char uplo, char trans,
   BlasInt n, BlasInt k,
   const DoubleDouble& alpha,
@@ -193,6 +266,13 @@ template void Herk
   const DoubleDouble& beta,
         Complex<DoubleDouble>* C, BlasInt CLDim );
 template void Herk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  const QuadDouble& alpha,
+  const Complex<QuadDouble>* A, BlasInt ALDim,
+  const QuadDouble& beta,
+        Complex<QuadDouble>* C, BlasInt CLDim );
+template void NaiveHerk
 ( char uplo, char trans,
   BlasInt n, BlasInt k,
   const QuadDouble& alpha,
@@ -202,6 +282,13 @@ template void Herk
 #endif
 #ifdef EL_HAVE_QUAD
 template void Herk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  const Quad& alpha,
+  const Quad* A, BlasInt ALDim,
+  const Quad& beta,
+        Quad* C, BlasInt CLDim );
+template void NaiveHerk
 ( char uplo, char trans,
   BlasInt n, BlasInt k,
   const Quad& alpha,
@@ -209,6 +296,13 @@ template void Herk
   const Quad& beta,
         Quad* C, BlasInt CLDim );
 template void Herk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  const Quad& alpha,
+  const Complex<Quad>* A, BlasInt ALDim,
+  const Quad& beta,
+        Complex<Quad>* C, BlasInt CLDim );
+template void NaiveHerk
 ( char uplo, char trans,
   BlasInt n, BlasInt k,
   const Quad& alpha,
@@ -218,6 +312,13 @@ template void Herk
 #endif
 #ifdef EL_HAVE_MPC
 template void Herk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  const BigInt& alpha,
+  const BigInt* A, BlasInt ALDim,
+  const BigInt& beta,
+        BigInt* C, BlasInt CLDim );
+template void NaiveHerk
 ( char uplo, char trans,
   BlasInt n, BlasInt k,
   const BigInt& alpha,
@@ -225,6 +326,13 @@ template void Herk
   const BigInt& beta,
         BigInt* C, BlasInt CLDim );
 template void Herk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  const BigFloat& alpha,
+  const BigFloat* A, BlasInt ALDim,
+  const BigFloat& beta,
+        BigFloat* C, BlasInt CLDim );
+template void NaiveHerk
 ( char uplo, char trans,
   BlasInt n, BlasInt k,
   const BigFloat& alpha,
@@ -232,6 +340,13 @@ template void Herk
   const BigFloat& beta,
         BigFloat* C, BlasInt CLDim );
 template void Herk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  const BigFloat& alpha,
+  const Complex<BigFloat>* A, BlasInt ALDim,
+  const BigFloat& beta,
+        Complex<BigFloat>* C, BlasInt CLDim );
+template void NaiveHerk
 ( char uplo, char trans,
   BlasInt n, BlasInt k,
   const BigFloat& alpha,
@@ -291,7 +406,7 @@ void Herk
 }
 
 template<typename T>
-void Syrk
+void NaiveSyrk
 ( char uplo, char trans,
   BlasInt n, BlasInt k, 
   const T& alpha,
@@ -399,7 +514,59 @@ void Syrk
         }
     }
 }
+
+// Blocked symmetric rank-k update which only computes the diagonal blocks
+// of C directly and casts the remainder into the packed generic Gemm
+template<typename T>
+void Syrk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+  const T& beta,
+        T* C, BlasInt CLDim )
+{
+    const BlasInt bsize = gemm::triangularBlocksize;
+    if( n <= bsize )
+    {
+        NaiveSyrk( uplo, trans, n, k, alpha, A, ALDim, beta, C, CLDim );
+        return;
+    }
+    gemm::ScaleC( n, n, beta, C, CLDim );
+
+    const bool normal = ( std::toupper(trans) == 'N' );
+    const bool lower = ( std::toupper(uplo) == 'L' );
+    const T one(1);
+    for( BlasInt j=0; j<n; j+=bsize )
+    {
+        const BlasInt nb = Min(bsize,n-j);
+        const T* A1 = ( normal ? &A[j] : &A[j*ALDim] );
+        NaiveSyrk
+        ( uplo, trans, nb, k, alpha, A1, ALDim, one,
+          &C[j+j*CLDim], CLDim );
+        if( lower )
+        {
+            const T* A2 = ( normal ? &A[j+nb] : &A[(j+nb)*ALDim] );
+            Gemm
+            ( (normal ? 'N' : 'T'), (normal ? 'T' : 'N'), n-(j+nb), nb, k,
+              alpha, A2, ALDim, A1, ALDim, one, &C[(j+nb)+j*CLDim], CLDim );
+        }
+        else
+        {
+            Gemm
+            ( (normal ? 'N' : 'T'), (normal ? 'T' : 'N'), j, nb, k,
+              alpha, A, ALDim, A1, ALDim, one, &C[j*CLDim], CLDim );
+        }
+    }
+}
 template void Syrk
+( char uplo, char trans,
+  BlasInt n, BlasInt k, 
+  const Int& alpha,
+  const Int* A, BlasInt ALDim, 
+  const Int& beta,
+        Int* C, BlasInt CLDim );
+template void NaiveSyrk
 ( char uplo, char trans,
   BlasInt n, BlasInt k, 
   const Int& alpha,
@@ -408,6 +575,13 @@ template void Syrk
         Int* C, BlasInt CLDim );
 #ifdef EL_HAVE_QD
 template void Syrk
+( char uplo, char trans,
+  BlasInt n, BlasInt k, 
+  const DoubleDouble& alpha,
+  const DoubleDouble* A, BlasInt ALDim, 
+  const DoubleDouble& beta,
+        DoubleDouble* C, BlasInt CLDim );
+template void NaiveSyrk
 ( char uplo, char trans,
   BlasInt n, BlasInt k, 
   const DoubleDouble& alpha,
@@ -415,6 +589,13 @@ template void Syrk
   const DoubleDouble& beta,
         DoubleDouble* C, BlasInt CLDim );
 template void Syrk
+( char uplo, char trans,
+  BlasInt n, BlasInt k, 
+  const QuadDouble& alpha,
+  const QuadDouble* A, BlasInt ALDim, 
+  const QuadDouble& beta,
+        QuadDouble* C, BlasInt CLDim );
+template void NaiveSyrk
 ( char uplo, char trans,
   BlasInt n, BlasInt k, 
   const QuadDouble& alpha,
@@ -422,6 +603,13 @@ template void Syrk
   const QuadDouble& beta,
         QuadDouble* C, BlasInt CLDim );
 template void Syrk
+( char uplo, char trans,
+  BlasInt n, BlasInt k, 
+  const Complex<DoubleDouble>& alpha,
+  const Complex<DoubleDouble>* A, BlasInt ALDim, 
+  const Complex<DoubleDouble>& beta,
+        Complex<DoubleDouble>* C, BlasInt CLDim );
+template void NaiveSyrk
 ( char uplo, char trans,
   BlasInt n, BlasInt k, 
   const Complex<DoubleDouble>& alpha,
@@ -429,6 +617,13 @@ template void Syrk
   const Complex<DoubleDouble>& beta,
         Complex<DoubleDouble>* C, BlasInt CLDim );
 template void Syrk
+( char uplo, char trans,
+  BlasInt n, BlasInt k, 
+  const Complex<QuadDouble>& alpha,
+  const Complex<QuadDouble>* A, BlasInt ALDim, 
+  const Complex<QuadDouble>& beta,
+        Complex<QuadDouble>* C, BlasInt CLDim );
+template void NaiveSyrk
 ( char uplo, char trans,
   BlasInt n, BlasInt k, 
   const Complex<QuadDouble>& alpha,
@@ -438,6 +633,13 @@ template void Syrk
 #endif
 #ifdef EL_HAVE_QUAD
 template void Syrk
+( char uplo, char trans,
+  BlasInt n, BlasInt k, 
+  const Quad& alpha,
+  const Quad* A, BlasInt ALDim, 
+  const Quad& beta,
+        Quad* C, BlasInt CLDim );
+template void NaiveSyrk
 ( char uplo, char trans,
   BlasInt n, BlasInt k, 
   const Quad& alpha,
@@ -445,6 +647,13 @@ template void Syrk
   const Quad& beta,
         Quad* C, BlasInt CLDim );
 template void Syrk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  const Complex<Quad>& alpha,
+  const Complex<Quad>* A, BlasInt ALDim, 
+  const Complex<Quad>& beta,
+        Complex<Quad>* C, BlasInt CLDim );
+template void NaiveSyrk
 ( char uplo, char trans,
   BlasInt n, BlasInt k,
   const Complex<Quad>& alpha,
@@ -454,6 +663,13 @@ template void Syrk
 #endif
 #ifdef EL_HAVE_MPC
 template void Syrk
+( char uplo, char trans,
+  BlasInt n, BlasInt k, 
+  const BigInt& alpha,
+  const BigInt* A, BlasInt ALDim, 
+  const BigInt& beta,
+        BigInt* C, BlasInt CLDim );
+template void NaiveSyrk
 ( char uplo, char trans,
   BlasInt n, BlasInt k, 
   const BigInt& alpha,
@@ -461,6 +677,13 @@ template void Syrk
   const BigInt& beta,
         BigInt* C, BlasInt CLDim );
 template void Syrk
+( char uplo, char trans,
+  BlasInt n, BlasInt k, 
+  const BigFloat& alpha,
+  const BigFloat* A, BlasInt ALDim, 
+  const BigFloat& beta,
+        BigFloat* C, BlasInt CLDim );
+template void NaiveSyrk
 ( char uplo, char trans,
   BlasInt n, BlasInt k, 
   const BigFloat& alpha,
@@ -468,6 +691,13 @@ template void Syrk
   const BigFloat& beta,
         BigFloat* C, BlasInt CLDim );
 template void Syrk
+( char uplo, char trans,
+  BlasInt n, BlasInt k, 
+  const Complex<BigFloat>& alpha,
+  const Complex<BigFloat>* A, BlasInt ALDim, 
+  const Complex<BigFloat>& beta,
+        Complex<BigFloat>* C, BlasInt CLDim );
+template void NaiveSyrk
 ( char uplo, char trans,
   BlasInt n, BlasInt k, 
   const Complex<BigFloat>& alpha,
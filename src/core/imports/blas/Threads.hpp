@@ -0,0 +1,50 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+extern "C" {
+
+#if defined(EL_HAVE_MKL)
+int mkl_get_max_threads();
+void mkl_set_num_threads( int numThreads );
+#elif defined(EL_HAVE_OPENBLAS)
+int openblas_get_num_threads();
+void openblas_set_num_threads( int numThreads );
+#endif
+
+} // extern "C"
+
+namespace El {
+namespace blas {
+
+int NumThreads()
+{
+#if defined(EL_HAVE_MKL)
+    return mkl_get_max_threads();
+#elif defined(EL_HAVE_OPENBLAS)
+    return openblas_get_num_threads();
+#elif defined(EL_HYBRID)
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+void SetNumThreads( int numThreads )
+{
+#if defined(EL_HAVE_MKL)
+    mkl_set_num_threads( numThreads );
+#elif defined(EL_HAVE_OPENBLAS)
+    openblas_set_num_threads( numThreads );
+#elif defined(EL_HYBRID)
+    omp_set_num_threads( numThreads );
+#endif
+}
+
+} // namespace blas
+} // namespace El
@@ -38,7 +38,7 @@ namespace El {
 namespace blas {
 
 template<typename T>
-void Trmm
+void NaiveTrmm
 ( char side, char uplo, char trans, char unit,
   BlasInt m, BlasInt n,
   const T& alpha,
@@ -78,7 +78,87 @@ void Trmm
         }
     }
 }
+
+// Blocked triangular multiply which casts all but O(bsize) of the work per
+// row/column of B into the packed generic Gemm
+template<typename T>
+void Trmm
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+        T* B, BlasInt BLDim )
+{
+    const bool onLeft = ( std::toupper(side) == 'L' );
+    const bool lower = ( std::toupper(uplo) == 'L' );
+    const bool normal = ( std::toupper(trans) == 'N' );
+    const BlasInt bsize = gemm::triangularBlocksize;
+    const BlasInt triSize = ( onLeft ? m : n );
+    if( triSize <= bsize )
+    {
+        NaiveTrmm( side, uplo, trans, unit, m, n, alpha, A, ALDim, B, BLDim );
+        return;
+    }
+    gemm::ScaleC( m, n, alpha, B, BLDim );
+
+    // Each block of the product depends upon the original values of the
+    // blocks on one side of it, so we sweep away from those blocks
+    const bool opLower = ( lower == normal );
+    const bool forward = ( onLeft != opLower );
+    const T one(1);
+    const BlasInt numBlocks = (triSize+bsize-1)/bsize;
+    for( BlasInt t=0; t<numBlocks; ++t )
+    {
+        const BlasInt block = ( forward ? t : numBlocks-1-t );
+        const BlasInt k = block*bsize;
+        const BlasInt nb = Min(bsize,triSize-k);
+        const BlasInt rest = triSize-(k+nb);
+        const T* A11 = &A[k+k*ALDim];
+        const T* A21 = &A[(k+nb)+k*ALDim];
+        const T* A12 = &A[k+(k+nb)*ALDim];
+        const T* A10 = &A[k];
+        const T* A01 = &A[k*ALDim];
+        if( onLeft )
+        {
+            T* B1 = &B[k];
+            NaiveTrmm
+            ( side, uplo, trans, unit, nb, n, one, A11, ALDim, B1, BLDim );
+            if( forward )
+                Gemm
+                ( trans, 'N', nb, n, rest,
+                  one, (normal ? A12 : A21), ALDim, &B[k+nb], BLDim,
+                  one, B1, BLDim );
+            else
+                Gemm
+                ( trans, 'N', nb, n, k,
+                  one, (normal ? A10 : A01), ALDim, B, BLDim,
+                  one, B1, BLDim );
+        }
+        else
+        {
+            T* B1 = &B[k*BLDim];
+            NaiveTrmm
+            ( side, uplo, trans, unit, m, nb, one, A11, ALDim, B1, BLDim );
+            if( forward )
+                Gemm
+                ( 'N', trans, m, nb, rest,
+                  one, &B[(k+nb)*BLDim], BLDim, (normal ? A21 : A12), ALDim,
+                  one, B1, BLDim );
+            else
+                Gemm
+                ( 'N', trans, m, nb, k,
+                  one, B, BLDim, (normal ? A01 : A10), ALDim,
+                  one, B1, BLDim );
+        }
+    }
+}
 template void Trmm
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const Int& alpha,
+  const Int* A, BlasInt ALDim,
+        Int* B, BlasInt BLDim );
+template void NaiveTrmm
 ( char side, char uplo, char trans, char unit,
   BlasInt m, BlasInt n,
   const Int& alpha,
@@ -86,24 +166,48 @@ template void Trmm
         Int* B, BlasInt BLDim );
 #ifdef EL_HAVE_QD
 template void Trmm
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const DoubleDouble& alpha,
+  const DoubleDouble* A, BlasInt ALDim,
+        DoubleDouble* B, BlasInt BLDim );
+template void NaiveTrmm
 ( char side, char uplo, char trans, char unit,
   BlasInt m, BlasInt n,
   const DoubleDouble& alpha,
   const DoubleDouble* A, BlasInt ALDim,
         DoubleDouble* B, BlasInt BLDim );
 template void Trmm
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const QuadDouble& alpha,
+  const QuadDouble* A, BlasInt ALDim,
+        QuadDouble* B, BlasInt BLDim );
+template void NaiveTrmm
 ( char side, char uplo, char trans, char unit,
   BlasInt m, BlasInt n,
   const QuadDouble& alpha,
   const QuadDouble* A, BlasInt ALDim,
         QuadDouble* B, BlasInt BLDim );
 template void Trmm
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const Complex<DoubleDouble>& alpha,
+  const Complex<DoubleDouble>* A, BlasInt ALDim,
+        Complex<DoubleDouble>* B, BlasInt BLDim );
+template void NaiveTrmm
 ( char side, char uplo, char trans, char unit,
   BlasInt m, BlasInt n,
   const Complex<DoubleDouble>& alpha,
   const Complex<DoubleDouble>* A, BlasInt ALDim,
         Complex<DoubleDouble>* B, BlasInt BLDim );
 template void Trmm
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const Complex<QuadDouble>& alpha,
+  const Complex<QuadDouble>* A, BlasInt ALDim,
+        Complex<QuadDouble>* B, BlasInt BLDim );
+template void NaiveTrmm
 ( char side, char uplo, char trans, char unit,
   BlasInt m, BlasInt n,
   const Complex<QuadDouble>& alpha,
@@ -112,12 +216,24 @@ template void Trmm
 #endif
 #ifdef EL_HAVE_QUAD
 template void Trmm
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const Quad& alpha,
+  const Quad* A, BlasInt ALDim,
+        Quad* B, BlasInt BLDim );
+template void NaiveTrmm
 ( char side, char uplo, char trans, char unit,
   BlasInt m, BlasInt n,
   const Quad& alpha,
   const Quad* A, BlasInt ALDim,
         Quad* B, BlasInt BLDim );
 template void Trmm
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const Complex<Quad>& alpha,
+  const Complex<Quad>* A, BlasInt ALDim,
+        Complex<Quad>* B, BlasInt BLDim );
+template void NaiveTrmm
 ( char side, char uplo, char trans, char unit,
   BlasInt m, BlasInt n,
   const Complex<Quad>& alpha,
@@ -126,18 +242,36 @@ template void Trmm
 #endif
 #ifdef EL_HAVE_MPC
 template void Trmm
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const BigInt& alpha,
+  const BigInt* A, BlasInt ALDim,
+        BigInt* B, BlasInt BLDim );
+template void NaiveTrmm
 ( char side, char uplo, char trans, char unit,
   BlasInt m, BlasInt n,
   const BigInt& alpha,
   const BigInt* A, BlasInt ALDim,
         BigInt* B, BlasInt BLDim );
 template void Trmm
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const BigFloat& alpha,
+  const BigFloat* A, BlasInt ALDim,
+        BigFloat* B, BlasInt BLDim );
+template void NaiveTrmm
 ( char side, char uplo, char trans, char unit,
   BlasInt m, BlasInt n,
   const BigFloat& alpha,
   const BigFloat* A, BlasInt ALDim,
         BigFloat* B, BlasInt BLDim );
 template void Trmm
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const Complex<BigFloat>& alpha,
+  const Complex<BigFloat>* A, BlasInt ALDim,
+        Complex<BigFloat>* B, BlasInt BLDim );
+template void NaiveTrmm
 ( char side, char uplo, char trans, char unit,
   BlasInt m, BlasInt n,
   const Complex<BigFloat>& alpha,
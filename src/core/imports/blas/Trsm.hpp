@@ -38,7 +38,7 @@ namespace El {
 namespace blas {
 
 template<typename F>
-void Trsm
+void NaiveTrsm
 ( char side, char uplo, char trans, char unit,
   BlasInt m, BlasInt n,
   const F& alpha,
@@ -293,26 +293,124 @@ void Trsm
         }
     }
 }
+
+// Blocked triangular solve which casts all but O(bsize) of the work per
+// row/column of B into the packed generic Gemm
+template<typename F>
+void Trsm
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const F& alpha,
+  const F* A, BlasInt ALDim,
+        F* B, BlasInt BLDim )
+{
+    const bool onLeft = ( std::toupper(side) == 'L' );
+    const bool lower = ( std::toupper(uplo) == 'L' );
+    const bool normal = ( std::toupper(trans) == 'N' );
+    const BlasInt bsize = gemm::triangularBlocksize;
+    const BlasInt triSize = ( onLeft ? m : n );
+    if( triSize <= bsize )
+    {
+        NaiveTrsm( side, uplo, trans, unit, m, n, alpha, A, ALDim, B, BLDim );
+        return;
+    }
+    gemm::ScaleC( m, n, alpha, B, BLDim );
+
+    // Solves with lower-triangular op(A) from the left, or upper-triangular
+    // op(A) from the right, sweep forward through the blocks
+    const bool opLower = ( lower == normal );
+    const bool forward = ( onLeft == opLower );
+    const F one(1), negOne(-1);
+    const BlasInt numBlocks = (triSize+bsize-1)/bsize;
+    for( BlasInt t=0; t<numBlocks; ++t )
+    {
+        const BlasInt block = ( forward ? t : numBlocks-1-t );
+        const BlasInt k = block*bsize;
+        const BlasInt nb = Min(bsize,triSize-k);
+        const BlasInt rest = triSize-(k+nb);
+        const F* A11 = &A[k+k*ALDim];
+        const F* A21 = &A[(k+nb)+k*ALDim];
+        const F* A12 = &A[k+(k+nb)*ALDim];
+        const F* A10 = &A[k];
+        const F* A01 = &A[k*ALDim];
+        if( onLeft )
+        {
+            F* B1 = &B[k];
+            NaiveTrsm
+            ( side, uplo, trans, unit, nb, n, one, A11, ALDim, B1, BLDim );
+            if( forward )
+                Gemm
+                ( trans, 'N', rest, n, nb,
+                  negOne, (normal ? A21 : A12), ALDim, B1, BLDim,
+                  one, &B[k+nb], BLDim );
+            else
+                Gemm
+                ( trans, 'N', k, n, nb,
+                  negOne, (normal ? A01 : A10), ALDim, B1, BLDim,
+                  one, B, BLDim );
+        }
+        else
+        {
+            F* B1 = &B[k*BLDim];
+            NaiveTrsm
+            ( side, uplo, trans, unit, m, nb, one, A11, ALDim, B1, BLDim );
+            if( forward )
+                Gemm
+                ( 'N', trans, m, rest, nb,
+                  negOne, B1, BLDim, (normal ? A12 : A21), ALDim,
+                  one, &B[(k+nb)*BLDim], BLDim );
+            else
+                Gemm
+                ( 'N', trans, m, k, nb,
+                  negOne, B1, BLDim, (normal ? A10 : A01), ALDim,
+                  one, B, BLDim );
+        }
+    }
+}
 #ifdef EL_HAVE_QD
 template void Trsm
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const DoubleDouble& alpha,
+  const DoubleDouble* A, BlasInt ALDim,
+        DoubleDouble* B, BlasInt BLDim );
+template void NaiveTrsm
 ( char side, char uplo, char trans, char unit,
   BlasInt m, BlasInt n,
   const DoubleDouble& alpha,
   const DoubleDouble* A, BlasInt ALDim,
         DoubleDouble* B, BlasInt BLDim );
 template void Trsm
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const QuadDouble& alpha,
+  const QuadDouble* A, BlasInt ALDim,
+        QuadDouble* B, BlasInt BLDim );
+template void NaiveTrsm
 ( char side, char uplo, char trans, char unit,
   BlasInt m, BlasInt n,
   const QuadDouble& alpha,
   const QuadDouble* A, BlasInt ALDim,
         QuadDouble* B, BlasInt BLDim );
 template void Trsm
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const Complex<DoubleDouble>& alpha,
+  const Complex<DoubleDouble>* A, BlasInt ALDim,
+        Complex<DoubleDouble>* B, BlasInt BLDim );
+template void NaiveTrsm
 ( char side, char uplo, char trans, char unit,
   BlasInt m, BlasInt n,
   const Complex<DoubleDouble>& alpha,
   const Complex<DoubleDouble>* A, BlasInt ALDim,
         Complex<DoubleDouble>* B, BlasInt BLDim );
 template void Trsm
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const Complex<QuadDouble>& alpha,
+  const Complex<QuadDouble>* A, BlasInt ALDim,
+        Complex<QuadDouble>* B, BlasInt BLDim );
+template void NaiveTrsm
 ( char side, char uplo, char trans, char unit,
   BlasInt m, BlasInt n,
   const Complex<QuadDouble>& alpha,
@@ -321,12 +419,24 @@ template void Trsm
 #endif
 #ifdef EL_HAVE_QUAD
 template void Trsm
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const Quad& alpha,
+  const Quad* A, BlasInt ALDim,
+        Quad* B, BlasInt BLDim );
+template void NaiveTrsm
 ( char side, char uplo, char trans, char unit,
   BlasInt m, BlasInt n,
   const Quad& alpha,
   const Quad* A, BlasInt ALDim,
         Quad* B, BlasInt BLDim );
 template void Trsm
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const Complex<Quad>& alpha,
+  const Complex<Quad>* A, BlasInt ALDim,
+        Complex<Quad>* B, BlasInt BLDim );
+template void NaiveTrsm
 ( char side, char uplo, char trans, char unit,
   BlasInt m, BlasInt n,
   const Complex<Quad>& alpha,
@@ -335,12 +445,24 @@ template void Trsm
 #endif
 #ifdef EL_HAVE_MPC
 template void Trsm
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const BigFloat& alpha,
+  const BigFloat* A, BlasInt ALDim,
+        BigFloat* B, BlasInt BLDim );
+template void NaiveTrsm
 ( char side, char uplo, char trans, char unit,
   BlasInt m, BlasInt n,
   const BigFloat& alpha,
   const BigFloat* A, BlasInt ALDim,
         BigFloat* B, BlasInt BLDim );
 template void Trsm
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const Complex<BigFloat>& alpha,
+  const Complex<BigFloat>* A, BlasInt ALDim,
+        Complex<BigFloat>* B, BlasInt BLDim );
+template void NaiveTrsm
 ( char side, char uplo, char trans, char unit,
   BlasInt m, BlasInt n,
   const Complex<BigFloat>& alpha,
@@ -13,6 +13,8 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El-lite.hpp>
+#include <iomanip>
+#include <map>
 
 typedef unsigned char* UCP;
 
@@ -49,6 +51,526 @@ MPI_Op NativeOp( const El::mpi::Op& op )
     return opC;
 }
 
+El::Int maxMessageCount = std::numeric_limits<int>::max() / 2;
+
+// Communication profiling
+// =======================
+// Every MPI communication call in this file is routed through the shims in
+// the 'profiled' namespace below, which, when profiling is enabled, charge
+// the call count, payload bytes, and wall-clock time to the pair
+// (scope, operation), where the scope is formed from the innermost
+// mpi::ProfileScope tag and (in debug builds) the innermost caller outside of
+// El::mpi on the call stack.
+
+enum CommKind
+{
+  COMM_SEND,
+  COMM_RECV,
+  COMM_ISEND,
+  COMM_IRECV,
+  COMM_SENDRECV,
+  COMM_BROADCAST,
+  COMM_IBROADCAST,
+  COMM_GATHER,
+  COMM_IGATHER,
+  COMM_ALLGATHER,
+  COMM_IALLGATHER,
+  COMM_SCATTER,
+  COMM_ALLTOALL,
+  COMM_REDUCE,
+  COMM_ALLREDUCE,
+  COMM_REDUCE_SCATTER,
+  COMM_SCAN,
+  COMM_BARRIER,
+  COMM_WAIT
+};
+
+const char* CommKindName( int kind )
+{
+    switch( kind )
+    {
+    case COMM_SEND:           return "Send";
+    case COMM_RECV:           return "Recv";
+    case COMM_ISEND:          return "ISend";
+    case COMM_IRECV:          return "IRecv";
+    case COMM_SENDRECV:       return "SendRecv";
+    case COMM_BROADCAST:      return "Broadcast";
+    case COMM_IBROADCAST:     return "IBroadcast";
+    case COMM_GATHER:         return "Gather";
+    case COMM_IGATHER:        return "IGather";
+    case COMM_ALLGATHER:      return "AllGather";
+    case COMM_IALLGATHER:     return "IAllGather";
+    case COMM_SCATTER:        return "Scatter";
+    case COMM_ALLTOALL:       return "AllToAll";
+    case COMM_REDUCE:         return "Reduce";
+    case COMM_ALLREDUCE:      return "AllReduce";
+    case COMM_REDUCE_SCATTER: return "ReduceScatter";
+    case COMM_SCAN:           return "Scan";
+    case COMM_BARRIER:        return "Barrier";
+    default:                  return "Wait";
+    }
+}
+
+struct CommProfileEntry
+{
+    El::Int numCalls=0;
+    double bytesSent=0, bytesRecv=0, time=0;
+};
+
+bool profiling = false;
+std::vector<std::string> profileScopes;
+std::map<std::pair<std::string,int>,CommProfileEntry> commProfile;
+
+std::string CurrentProfileScope()
+{
+    std::string scope =
+      ( profileScopes.empty() ? std::string() : profileScopes.back() );
+    EL_DEBUG_ONLY(
+      const std::string caller = El::InnermostCallStackEntry("El::mpi::");
+      if( !caller.empty() )
+      {
+          if( !scope.empty() )
+              scope += " / ";
+          scope += El::CallStackFunctionName( caller );
+      }
+    )
+    return scope.empty() ? std::string("(unscoped)") : scope;
+}
+
+void RecordComm( int kind, double bytesSent, double bytesRecv, double time )
+{
+#ifdef EL_HYBRID
+    if( omp_get_thread_num() != 0 )
+        return;
+#endif
+    auto& entry = commProfile[std::make_pair(CurrentProfileScope(),kind)];
+    ++entry.numCalls;
+    entry.bytesSent += bytesSent;
+    entry.bytesRecv += bytesRecv;
+    entry.time += time;
+}
+
+double Bytes( int count, MPI_Datatype type )
+{
+    int typeSize;
+    MPI_Type_size( type, &typeSize );
+    return double(count)*typeSize;
+}
+
+double Bytes( const int* counts, int numCounts, MPI_Datatype type )
+{
+    double numEntries = 0;
+    for( int q=0; q<numCounts; ++q )
+        numEntries += counts[q];
+    return numEntries*Bytes( 1, type );
+}
+
+int CommRank( MPI_Comm comm )
+{
+    int rank;
+    MPI_Comm_rank( comm, &rank );
+    return rank;
+}
+
+int CommSize( MPI_Comm comm )
+{
+    int size;
+    MPI_Comm_size( comm, &size );
+    return size;
+}
+
+// Calls 'call' and, if profiling is enabled, charges it to 'kind' with the
+// payload sizes computed by 'bytes'
+template<typename CallFunc,typename BytesFunc>
+int Profile( int kind, CallFunc call, BytesFunc bytes )
+{
+    if( !profiling )
+        return call();
+    const double startTime = MPI_Wtime();
+    const int error = call();
+    const double time = MPI_Wtime() - startTime;
+    double bytesSent=0, bytesRecv=0;
+    bytes( bytesSent, bytesRecv );
+    RecordComm( kind, bytesSent, bytesRecv, time );
+    return error;
+}
+
+// NOTE: The buffer and count arguments are accepted as pointers-to-const and
+//       cast back so that the shims work with both the MPI-2 and MPI-3
+//       signatures
+namespace profiled {
+
+int Send
+( const void* buf, int count, MPI_Datatype type, int to, int tag,
+  MPI_Comm comm )
+{
+    return Profile
+    ( COMM_SEND,
+      [&]() { return MPI_Send
+              ( const_cast<void*>(buf), count, type, to, tag, comm ); },
+      [&]( double& sent, double& ) { sent = Bytes(count,type); } );
+}
+
+int Recv
+( void* buf, int count, MPI_Datatype type, int from, int tag, MPI_Comm comm,
+  MPI_Status* status )
+{
+    return Profile
+    ( COMM_RECV,
+      [&]() { return MPI_Recv( buf, count, type, from, tag, comm, status ); },
+      [&]( double&, double& recv ) { recv = Bytes(count,type); } );
+}
+
+int Isend
+( const void* buf, int count, MPI_Datatype type, int to, int tag,
+  MPI_Comm comm, MPI_Request* request )
+{
+    return Profile
+    ( COMM_ISEND,
+      [&]() { return MPI_Isend
+              ( const_cast<void*>(buf), count, type, to, tag, comm,
+                request ); },
+      [&]( double& sent, double& ) { sent = Bytes(count,type); } );
+}
+
+int Irsend
+( const void* buf, int count, MPI_Datatype type, int to, int tag,
+  MPI_Comm comm, MPI_Request* request )
+{
+    return Profile
+    ( COMM_ISEND,
+      [&]() { return MPI_Irsend
+              ( const_cast<void*>(buf), count, type, to, tag, comm,
+                request ); },
+      [&]( double& sent, double& ) { sent = Bytes(count,type); } );
+}
+
+int Issend
+( const void* buf, int count, MPI_Datatype type, int to, int tag,
+  MPI_Comm comm, MPI_Request* request )
+{
+    return Profile
+    ( COMM_ISEND,
+      [&]() { return MPI_Issend
+              ( const_cast<void*>(buf), count, type, to, tag, comm,
+                request ); },
+      [&]( double& sent, double& ) { sent = Bytes(count,type); } );
+}
+
+int Irecv
+( void* buf, int count, MPI_Datatype type, int from, int tag, MPI_Comm comm,
+  MPI_Request* request )
+{
+    return Profile
+    ( COMM_IRECV,
+      [&]() { return MPI_Irecv( buf, count, type, from, tag, comm, request ); },
+      [&]( double&, double& recv ) { recv = Bytes(count,type); } );
+}
+
+int Sendrecv
+( const void* sbuf, int sc, MPI_Datatype stype, int to, int stag,
+        void* rbuf, int rc, MPI_Datatype rtype, int from, int rtag,
+  MPI_Comm comm, MPI_Status* status )
+{
+    return Profile
+    ( COMM_SENDRECV,
+      [&]() { return MPI_Sendrecv
+              ( const_cast<void*>(sbuf), sc, stype, to, stag,
+                rbuf, rc, rtype, from, rtag, comm, status ); },
+      [&]( double& sent, double& recv )
+      { sent = Bytes(sc,stype); recv = Bytes(rc,rtype); } );
+}
+
+int Sendrecv_replace
+( void* buf, int count, MPI_Datatype type, int to, int stag,
+  int from, int rtag, MPI_Comm comm, MPI_Status* status )
+{
+    return Profile
+    ( COMM_SENDRECV,
+      [&]() { return MPI_Sendrecv_replace
+              ( buf, count, type, to, stag, from, rtag, comm, status ); },
+      [&]( double& sent, double& recv )
+      { sent = recv = Bytes(count,type); } );
+}
+
+int Bcast( void* buf, int count, MPI_Datatype type, int root, MPI_Comm comm )
+{
+    return Profile
+    ( COMM_BROADCAST,
+      [&]() { return MPI_Bcast( buf, count, type, root, comm ); },
+      [&]( double& sent, double& recv )
+      {
+          if( CommRank(comm) == root )
+              sent = Bytes(count,type);
+          else
+              recv = Bytes(count,type);
+      } );
+}
+
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+int Ibcast
+( void* buf, int count, MPI_Datatype type, int root, MPI_Comm comm,
+  MPI_Request* request )
+{
+    return Profile
+    ( COMM_IBROADCAST,
+      [&]() { return EL_NONBLOCKING_COLL(Ibcast)
+              ( buf, count, type, root, comm, request ); },
+      [&]( double& sent, double& recv )
+      {
+          if( CommRank(comm) == root )
+              sent = Bytes(count,type);
+          else
+              recv = Bytes(count,type);
+      } );
+}
+#endif
+
+int Gather
+( const void* sbuf, int sc, MPI_Datatype stype,
+        void* rbuf, int rc, MPI_Datatype rtype, int root, MPI_Comm comm )
+{
+    return Profile
+    ( COMM_GATHER,
+      [&]() { return MPI_Gather
+              ( const_cast<void*>(sbuf), sc, stype, rbuf, rc, rtype,
+                root, comm ); },
+      [&]( double& sent, double& recv )
+      {
+          sent = Bytes(sc,stype);
+          if( CommRank(comm) == root )
+              recv = CommSize(comm)*Bytes(rc,rtype);
+      } );
+}
+
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+int Igather
+( const void* sbuf, int sc, MPI_Datatype stype,
+        void* rbuf, int rc, MPI_Datatype rtype, int root, MPI_Comm comm,
+  MPI_Request* request )
+{
+    return Profile
+    ( COMM_IGATHER,
+      [&]() { return EL_NONBLOCKING_COLL(Igather)
+              ( const_cast<void*>(sbuf), sc, stype, rbuf, rc, rtype,
+                root, comm, request ); },
+      [&]( double& sent, double& recv )
+      {
+          sent = Bytes(sc,stype);
+          if( CommRank(comm) == root )
+              recv = CommSize(comm)*Bytes(rc,rtype);
+      } );
+}
+#endif
+
+int Gatherv
+( const void* sbuf, int sc, MPI_Datatype stype,
+        void* rbuf, const int* rcs, const int* rds, MPI_Datatype rtype,
+  int root, MPI_Comm comm )
+{
+    return Profile
+    ( COMM_GATHER,
+      [&]() { return MPI_Gatherv
+              ( const_cast<void*>(sbuf), sc, stype,
+                rbuf, const_cast<int*>(rcs), const_cast<int*>(rds), rtype,
+                root, comm ); },
+      [&]( double& sent, double& recv )
+      {
+          sent = Bytes(sc,stype);
+          if( CommRank(comm) == root )
+              recv = Bytes(rcs,CommSize(comm),rtype);
+      } );
+}
+
+int Allgather
+( const void* sbuf, int sc, MPI_Datatype stype,
+        void* rbuf, int rc, MPI_Datatype rtype, MPI_Comm comm )
+{
+    return Profile
+    ( COMM_ALLGATHER,
+      [&]() { return MPI_Allgather
+              ( const_cast<void*>(sbuf), sc, stype, rbuf, rc, rtype, comm ); },
+      [&]( double& sent, double& recv )
+      { sent = Bytes(sc,stype); recv = CommSize(comm)*Bytes(rc,rtype); } );
+}
+
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+int Iallgather
+( const void* sbuf, int sc, MPI_Datatype stype,
+        void* rbuf, int rc, MPI_Datatype rtype, MPI_Comm comm,
+  MPI_Request* request )
+{
+    return Profile
+    ( COMM_IALLGATHER,
+      [&]() { return EL_NONBLOCKING_COLL(Iallgather)
+              ( const_cast<void*>(sbuf), sc, stype, rbuf, rc, rtype, comm,
+                request ); },
+      [&]( double& sent, double& recv )
+      { sent = Bytes(sc,stype); recv = CommSize(comm)*Bytes(rc,rtype); } );
+}
+#endif
+
+int Allgatherv
+( const void* sbuf, int sc, MPI_Datatype stype,
+        void* rbuf, const int* rcs, const int* rds, MPI_Datatype rtype,
+  MPI_Comm comm )
+{
+    return Profile
+    ( COMM_ALLGATHER,
+      [&]() { return MPI_Allgatherv
+              ( const_cast<void*>(sbuf), sc, stype,
+                rbuf, const_cast<int*>(rcs), const_cast<int*>(rds), rtype,
+                comm ); },
+      [&]( double& sent, double& recv )
+      { sent = Bytes(sc,stype); recv = Bytes(rcs,CommSize(comm),rtype); } );
+}
+
+int Scatter
+( const void* sbuf, int sc, MPI_Datatype stype,
+        void* rbuf, int rc, MPI_Datatype rtype, int root, MPI_Comm comm )
+{
+    return Profile
+    ( COMM_SCATTER,
+      [&]() { return MPI_Scatter
+              ( const_cast<void*>(sbuf), sc, stype, rbuf, rc, rtype,
+                root, comm ); },
+      [&]( double& sent, double& recv )
+      {
+          if( CommRank(comm) == root )
+              sent = CommSize(comm)*Bytes(sc,stype);
+          recv = Bytes(rc,rtype);
+      } );
+}
+
+int Alltoall
+( const void* sbuf, int sc, MPI_Datatype stype,
+        void* rbuf, int rc, MPI_Datatype rtype, MPI_Comm comm )
+{
+    return Profile
+    ( COMM_ALLTOALL,
+      [&]() { return MPI_Alltoall
+              ( const_cast<void*>(sbuf), sc, stype, rbuf, rc, rtype, comm ); },
+      [&]( double& sent, double& recv )
+      {
+          const int commSize = CommSize(comm);
+          sent = commSize*Bytes(sc,stype);
+          recv = commSize*Bytes(rc,rtype);
+      } );
+}
+
+int Alltoallv
+( const void* sbuf, const int* scs, const int* sds, MPI_Datatype stype,
+        void* rbuf, const int* rcs, const int* rds, MPI_Datatype rtype,
+  MPI_Comm comm )
+{
+    return Profile
+    ( COMM_ALLTOALL,
+      [&]() { return MPI_Alltoallv
+              ( const_cast<void*>(sbuf),
+                const_cast<int*>(scs), const_cast<int*>(sds), stype,
+                rbuf, const_cast<int*>(rcs), const_cast<int*>(rds), rtype,
+                comm ); },
+      [&]( double& sent, double& recv )
+      {
+          const int commSize = CommSize(comm);
+          sent = Bytes(scs,commSize,stype);
+          recv = Bytes(rcs,commSize,rtype);
+      } );
+}
+
+int Reduce
+( const void* sbuf, void* rbuf, int count, MPI_Datatype type, MPI_Op op,
+  int root, MPI_Comm comm )
+{
+    return Profile
+    ( COMM_REDUCE,
+      [&]() { return MPI_Reduce
+              ( const_cast<void*>(sbuf), rbuf, count, type, op, root,
+                comm ); },
+      [&]( double& sent, double& recv )
+      {
+          sent = Bytes(count,type);
+          if( CommRank(comm) == root )
+              recv = sent;
+      } );
+}
+
+int Allreduce
+( const void* sbuf, void* rbuf, int count, MPI_Datatype type, MPI_Op op,
+  MPI_Comm comm )
+{
+    return Profile
+    ( COMM_ALLREDUCE,
+      [&]() { return MPI_Allreduce
+              ( const_cast<void*>(sbuf), rbuf, count, type, op, comm ); },
+      [&]( double& sent, double& recv ) { sent = recv = Bytes(count,type); } );
+}
+
+int Reduce_scatter
+( const void* sbuf, void* rbuf, const int* rcs, MPI_Datatype type, MPI_Op op,
+  MPI_Comm comm )
+{
+    return Profile
+    ( COMM_REDUCE_SCATTER,
+      [&]() { return MPI_Reduce_scatter
+              ( const_cast<void*>(sbuf), rbuf, const_cast<int*>(rcs), type,
+                op, comm ); },
+      [&]( double& sent, double& recv )
+      {
+          sent = Bytes(rcs,CommSize(comm),type);
+          recv = Bytes(rcs[CommRank(comm)],type);
+      } );
+}
+
+int Reduce_scatter_block
+( const void* sbuf, void* rbuf, int rc, MPI_Datatype type, MPI_Op op,
+  MPI_Comm comm )
+{
+    return Profile
+    ( COMM_REDUCE_SCATTER,
+      [&]() { return MPI_Reduce_scatter_block
+              ( const_cast<void*>(sbuf), rbuf, rc, type, op, comm ); },
+      [&]( double& sent, double& recv )
+      { recv = Bytes(rc,type); sent = CommSize(comm)*recv; } );
+}
+
+int Scan
+( const void* sbuf, void* rbuf, int count, MPI_Datatype type, MPI_Op op,
+  MPI_Comm comm )
+{
+    return Profile
+    ( COMM_SCAN,
+      [&]() { return MPI_Scan
+              ( const_cast<void*>(sbuf), rbuf, count, type, op, comm ); },
+      [&]( double& sent, double& recv ) { sent = recv = Bytes(count,type); } );
+}
+
+int Barrier( MPI_Comm comm )
+{
+    return Profile
+    ( COMM_BARRIER,
+      [&]() { return MPI_Barrier( comm ); },
+      []( double&, double& ) { } );
+}
+
+int Wait( MPI_Request* request, MPI_Status* status )
+{
+    return Profile
+    ( COMM_WAIT,
+      [&]() { return MPI_Wait( request, status ); },
+      []( double&, double& ) { } );
+}
+
+int Waitall( int numRequests, MPI_Request* requests, MPI_Status* statuses )
+{
+    return Profile
+    ( COMM_WAIT,
+      [&]() { return MPI_Waitall( numRequests, requests, statuses ); },
+      []( double&, double& ) { } );
+}
+
+} // namespace profiled
+
 } // anonymous namespace
 
 namespace El {
@@ -60,6 +582,170 @@ bool CommSameSizeAsInteger() EL_NO_EXCEPT
 bool GroupSameSizeAsInteger() EL_NO_EXCEPT
 { return sizeof(MPI_Group) == sizeof(int); }
 
+Int MaxMessageCount() EL_NO_EXCEPT
+{ return ::maxMessageCount; }
+
+void SetMaxMessageCount( Int maxCount )
+{
+    EL_DEBUG_CSE
+    if( maxCount < 1 || maxCount > std::numeric_limits<int>::max()/2 )
+        LogicError
+        ("Maximum message count must be in [1,",
+         std::numeric_limits<int>::max()/2,"]");
+    ::maxMessageCount = maxCount;
+}
+
+// Communication profiling
+// =======================
+
+void EnableProfiling() EL_NO_EXCEPT { ::profiling = true; }
+void DisableProfiling() EL_NO_EXCEPT { ::profiling = false; }
+bool Profiling() EL_NO_EXCEPT { return ::profiling; }
+
+void ResetProfile() { ::commProfile.clear(); }
+
+void PushProfileScope( const std::string& scope )
+{ ::profileScopes.push_back( scope ); }
+
+void PopProfileScope()
+{
+    if( ::profileScopes.empty() )
+        LogicError("Attempted to pop an empty profile scope stack");
+    ::profileScopes.pop_back();
+}
+
+std::vector<std::string> ProfiledScopes()
+{
+    std::vector<std::string> scopes;
+    for( const auto& pair : ::commProfile )
+        if( scopes.empty() || scopes.back() != pair.first.first )
+            scopes.push_back( pair.first.first );
+    return scopes;
+}
+
+Int ProfiledCalls( const std::string& scope )
+{
+    Int numCalls = 0;
+    for( const auto& pair : ::commProfile )
+        if( pair.first.first == scope )
+            numCalls += pair.second.numCalls;
+    return numCalls;
+}
+
+void PrintProfile( Comm comm, std::ostream& os )
+{
+    EL_DEBUG_CSE
+    // Do not charge the aggregation to the profile
+    const bool wasProfiling = ::profiling;
+    ::profiling = false;
+
+    // Serialize the local entries as tab-separated lines
+    std::ostringstream localStream;
+    localStream << std::setprecision(17);
+    for( const auto& pair : ::commProfile )
+    {
+        const auto& entry = pair.second;
+        localStream << pair.first.first << '\t' << pair.first.second << '\t'
+          << entry.numCalls << '\t' << entry.bytesSent << '\t'
+          << entry.bytesRecv << '\t' << entry.time << '\n';
+    }
+    const std::string localString = localStream.str();
+
+    const int commRank = Rank( comm );
+    const int commSize = Size( comm );
+    const int localSize = localString.size();
+    vector<int> sizes( commSize );
+    SafeMpi
+    ( MPI_Gather
+      ( const_cast<int*>(&localSize), 1, MPI_INT,
+        sizes.data(), 1, MPI_INT, 0, comm.comm ) );
+    vector<int> offsets;
+    const int totalSize = El::Scan( sizes, offsets );
+    vector<char> allStrings( Max(totalSize,1) );
+    SafeMpi
+    ( MPI_Gatherv
+      ( const_cast<char*>(localString.data()), localSize, MPI_CHAR,
+        allStrings.data(), sizes.data(), offsets.data(), MPI_CHAR,
+        0, comm.comm ) );
+    ::profiling = wasProfiling;
+    if( commRank != 0 )
+        return;
+
+    struct Aggregate
+    {
+        Int numCalls=0, numProcs=0;
+        double bytesSent=0, bytesRecv=0, minTime=0, sumTime=0, maxTime=0;
+    };
+    std::map<std::pair<std::string,int>,Aggregate> aggregates;
+    for( int q=0; q<commSize; ++q )
+    {
+        std::istringstream procStream
+        ( std::string( &allStrings[offsets[q]], sizes[q] ) );
+        std::string line;
+        while( std::getline( procStream, line ) )
+        {
+            std::istringstream lineStream( line );
+            std::string scope;
+            std::getline( lineStream, scope, '\t' );
+            int kind;
+            CommProfileEntry entry;
+            lineStream >> kind >> entry.numCalls >> entry.bytesSent
+                       >> entry.bytesRecv >> entry.time;
+
+            auto& aggregate = aggregates[std::make_pair(scope,kind)];
+            aggregate.minTime =
+              ( aggregate.numProcs == 0 ? entry.time
+                                        : Min(aggregate.minTime,entry.time) );
+            aggregate.maxTime = Max( aggregate.maxTime, entry.time );
+            aggregate.sumTime += entry.time;
+            aggregate.numCalls += entry.numCalls;
+            aggregate.bytesSent += entry.bytesSent;
+            aggregate.bytesRecv += entry.bytesRecv;
+            ++aggregate.numProcs;
+        }
+    }
+
+    // Processes which never entered a scope spent no time in it
+    typedef std::pair<std::pair<std::string,int>,Aggregate> AggregatePair;
+    vector<AggregatePair> sorted( aggregates.begin(), aggregates.end() );
+    size_t scopeWidth = 5;
+    for( auto& pair : sorted )
+    {
+        if( pair.second.numProcs < commSize )
+            pair.second.minTime = 0;
+        scopeWidth = Max( scopeWidth, pair.first.first.size() );
+    }
+    std::sort
+    ( sorted.begin(), sorted.end(),
+      []( const AggregatePair& a, const AggregatePair& b )
+      { return a.second.maxTime > b.second.maxTime; } );
+
+    std::ostringstream msg;
+    msg << "MPI communication profile over " << commSize << " processes "
+        << "(bytes are summed and times are in seconds over processes)\n"
+        << std::left << std::setw(scopeWidth) << "scope" << "  "
+        << std::setw(14) << "operation" << std::right
+        << std::setw(10) << "calls" << std::setw(12) << "MB sent"
+        << std::setw(12) << "MB recv" << std::setw(12) << "min time"
+        << std::setw(12) << "avg time" << std::setw(12) << "max time" << "\n";
+    for( const auto& pair : sorted )
+    {
+        const auto& aggregate = pair.second;
+        msg << std::left << std::setw(scopeWidth) << pair.first.first << "  "
+            << std::setw(14) << CommKindName(pair.first.second) << std::right
+            << std::setw(10) << aggregate.numCalls
+            << std::fixed << std::setprecision(3)
+            << std::setw(12) << aggregate.bytesSent/1e6
+            << std::setw(12) << aggregate.bytesRecv/1e6
+            << std::setprecision(6)
+            << std::setw(12) << aggregate.minTime
+            << std::setw(12) << aggregate.sumTime/commSize
+            << std::setw(12) << aggregate.maxTime << "\n";
+    }
+    os << msg.str();
+    os.flush();
+}
+
 // MPI environmental routines
 // ==========================
 
@@ -176,6 +862,19 @@ void Split( Comm comm, int color, int key, Comm& newComm ) EL_NO_RELEASE_EXCEPT
     SafeMpi( MPI_Comm_split( comm.comm, color, key, &newComm.comm ) );
 }
 
+void SplitShared( Comm comm, int key, Comm& newComm ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+#if MPI_VERSION >= 3
+    SafeMpi
+    ( MPI_Comm_split_type
+      ( comm.comm, MPI_COMM_TYPE_SHARED, key, MPI_INFO_NULL, &newComm.comm ) );
+#else
+    // Without MPI-3, conservatively treat each process as its own node
+    SafeMpi( MPI_Comm_split( comm.comm, Rank(comm), key, &newComm.comm ) );
+#endif
+}
+
 void Free( Comm& comm ) EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
@@ -398,7 +1097,7 @@ void Translate
 void Barrier( Comm comm ) EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
-    SafeMpi( MPI_Barrier( comm.comm ) );
+    SafeMpi( profiled::Barrier( comm.comm ) );
 }
 
 // Test for completion
@@ -427,7 +1126,7 @@ template<typename T,
 void Wait( Request<T>& request, Status& status ) EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
-    SafeMpi( MPI_Wait( &request.backend, &status ) );
+    SafeMpi( profiled::Wait( &request.backend, &status ) );
 }
 
 // Ensure that several requests finish before continuing
@@ -454,7 +1153,7 @@ EL_NO_RELEASE_EXCEPT
     vector<MPI_Request> backends( numRequests );
     for( Int j=0; j<numRequests; ++j )
         backends[j] = requests[j].backend;
-    SafeMpi( MPI_Waitall( numRequests, backends.data(), statuses ) );
+    SafeMpi( profiled::Waitall( numRequests, backends.data(), statuses ) );
     // NOTE: This write back will almost always be superfluous, but it ensures
     //       that any changes to the pointer are propagated
     for( Int j=0; j<numRequests; ++j )
@@ -463,7 +1162,7 @@ EL_NO_RELEASE_EXCEPT
     for( Int j=0; j<numRequests; ++j )
     {
         Status status;
-        MPI_Wait( &requests[j].backend, &status );
+        profiled::Wait( &requests[j].backend, &status );
     }
 #endif
 }
@@ -474,7 +1173,7 @@ template<typename T,
 void Wait( Request<T>& request, Status& status ) EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
-    SafeMpi( MPI_Wait( &request.backend, &status ) );
+    SafeMpi( profiled::Wait( &request.backend, &status ) );
     if( request.receivingPacked )
     {
         Deserialize
@@ -499,7 +1198,7 @@ EL_NO_RELEASE_EXCEPT
     vector<MPI_Request> backends( numRequests );
     for( Int j=0; j<numRequests; ++j )
         backends[j] = requests[j].backend;
-    SafeMpi( MPI_Waitall( numRequests, backends.data(), statuses ) );
+    SafeMpi( profiled::Waitall( numRequests, backends.data(), statuses ) );
     // NOTE: This write back will almost always be superfluous, but it ensures
     //       that any changes to the pointer are propagated
     for( Int j=0; j<numRequests; ++j )
@@ -508,7 +1207,7 @@ EL_NO_RELEASE_EXCEPT
     for( Int j=0; j<numRequests; ++j )
     {
         Status status;
-        MPI_Wait( &requests[j].backend, &status );
+        profiled::Wait( &requests[j].backend, &status );
     }
 #endif
     for( Int j=0; j<numRequests; ++j )
@@ -553,7 +1252,7 @@ EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
     SafeMpi
-    ( MPI_Send
+    ( profiled::Send
       ( const_cast<Real*>(buf), count, TypeMap<Real>(), to, tag, comm.comm ) );
 }
 
@@ -566,12 +1265,12 @@ EL_NO_RELEASE_EXCEPT
     EL_DEBUG_CSE
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Send
+    ( profiled::Send
       ( const_cast<Complex<Real>*>(buf), 2*count, TypeMap<Real>(), to,
         tag, comm.comm ) );
 #else
     SafeMpi
-    ( MPI_Send
+    ( profiled::Send
       ( const_cast<Complex<Real>*>(buf), count,
         TypeMap<Complex<Real>>(), to, tag, comm.comm ) );
 #endif
@@ -586,7 +1285,7 @@ void TaggedSend( const T* buf, int count, int to, int tag, Comm comm )
     std::vector<byte> packedBuf;
     Serialize( count, buf, packedBuf );
     SafeMpi
-    ( MPI_Send( packedBuf.data(), count, TypeMap<T>(), to, tag, comm.comm ) );
+    ( profiled::Send( packedBuf.data(), count, TypeMap<T>(), to, tag, comm.comm ) );
 }
 
 template<typename T>
@@ -610,7 +1309,7 @@ EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
     SafeMpi
-    ( MPI_Isend
+    ( profiled::Isend
       ( const_cast<Real*>(buf), count, TypeMap<Real>(), to,
         tag, comm.comm, &request.backend ) );
 }
@@ -624,12 +1323,12 @@ void TaggedISend
     EL_DEBUG_CSE
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Isend
+    ( profiled::Isend
       ( const_cast<Complex<Real>*>(buf), 2*count,
         TypeMap<Real>(), to, tag, comm.comm, &request.backend ) );
 #else
     SafeMpi
-    ( MPI_Isend
+    ( profiled::Isend
       ( const_cast<Complex<Real>*>(buf), count,
         TypeMap<Complex<Real>>(), to, tag, comm.comm, &request.backend ) );
 #endif
@@ -645,7 +1344,7 @@ EL_NO_RELEASE_EXCEPT
     EL_DEBUG_CSE
     Serialize( count, buf, request.buffer );
     SafeMpi
-    ( MPI_Isend
+    ( profiled::Isend
       ( request.buffer.data(), count, TypeMap<T>(), to, tag, comm.comm,
         &request.backend ) );
 }
@@ -675,7 +1374,7 @@ EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
     SafeMpi
-    ( MPI_Irsend
+    ( profiled::Irsend
       ( const_cast<Real*>(buf), count, TypeMap<Real>(), to,
         tag, comm.comm, &request.backend ) );
 }
@@ -689,12 +1388,12 @@ void TaggedIRSend
     EL_DEBUG_CSE
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Irsend
+    ( profiled::Irsend
       ( const_cast<Complex<Real>*>(buf), 2*count,
         TypeMap<Real>(), to, tag, comm.comm, &request.backend ) );
 #else
     SafeMpi
-    ( MPI_Irsend
+    ( profiled::Irsend
       ( const_cast<Complex<Real>*>(buf), count,
         TypeMap<Complex<Real>>(), to, tag, comm.comm, &request.backend ) );
 #endif
@@ -711,7 +1410,7 @@ EL_NO_RELEASE_EXCEPT
     EL_DEBUG_CSE
     Serialize( count, buf, request.buffer );
     SafeMpi
-    ( MPI_Irsend
+    ( profiled::Irsend
       ( request.buffer.data(), count, TypeMap<T>(), to,
         tag, comm.comm, &request.backend ) );
 }
@@ -740,7 +1439,7 @@ void TaggedISSend
 {
     EL_DEBUG_CSE
     SafeMpi
-    ( MPI_Issend
+    ( profiled::Issend
       ( const_cast<Real*>(buf), count, TypeMap<Real>(), to,
         tag, comm.comm, &request.backend ) );
 }
@@ -754,12 +1453,12 @@ void TaggedISSend
     EL_DEBUG_CSE
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Issend
+    ( profiled::Issend
       ( const_cast<Complex<Real>*>(buf), 2*count,
         TypeMap<Real>(), to, tag, comm.comm, &request.backend ) );
 #else
     SafeMpi
-    ( MPI_Issend
+    ( profiled::Issend
       ( const_cast<Complex<Real>*>(buf), count,
         TypeMap<Complex<Real>>(), to, tag, comm.comm, &request.backend ) );
 #endif
@@ -775,7 +1474,7 @@ EL_NO_RELEASE_EXCEPT
     EL_DEBUG_CSE
     Serialize( count, buf, request.buffer );
     SafeMpi
-    ( MPI_Issend
+    ( profiled::Issend
       ( request.buffer.data(), count, TypeMap<T>(), to,
         tag, comm.comm, &request.backend ) );
 }
@@ -798,7 +1497,7 @@ EL_NO_RELEASE_EXCEPT
     EL_DEBUG_CSE
     Status status;
     SafeMpi
-    ( MPI_Recv( buf, count, TypeMap<Real>(), from, tag, comm.comm, &status ) );
+    ( profiled::Recv( buf, count, TypeMap<Real>(), from, tag, comm.comm, &status ) );
 }
 
 template<typename Real,
@@ -810,10 +1509,10 @@ EL_NO_RELEASE_EXCEPT
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Recv( buf, 2*count, TypeMap<Real>(), from, tag, comm.comm, &status ) );
+    ( profiled::Recv( buf, 2*count, TypeMap<Real>(), from, tag, comm.comm, &status ) );
 #else
     SafeMpi
-    ( MPI_Recv
+    ( profiled::Recv
       ( buf, count, TypeMap<Complex<Real>>(), from, tag, comm.comm, &status ) );
 #endif
 }
@@ -828,7 +1527,7 @@ void TaggedRecv( T* buf, int count, int from, int tag, Comm comm )
     ReserveSerialized( count, buf, packedBuf );
     Status status;
     SafeMpi
-    ( MPI_Recv
+    ( profiled::Recv
       ( packedBuf.data(), count, TypeMap<T>(), from, tag,
         comm.comm, &status ) );
     Deserialize( count, packedBuf, buf );
@@ -857,7 +1556,7 @@ EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
     SafeMpi
-    ( MPI_Irecv
+    ( profiled::Irecv
       ( buf, count, TypeMap<Real>(), from, tag, comm.comm, &request.backend ) );
 }
 
@@ -871,12 +1570,12 @@ EL_NO_RELEASE_EXCEPT
     EL_DEBUG_CSE
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Irecv
+    ( profiled::Irecv
       ( buf, 2*count, TypeMap<Real>(), from, tag, comm.comm,
         &request.backend ) );
 #else
     SafeMpi
-    ( MPI_Irecv
+    ( profiled::Irecv
       ( buf, count, TypeMap<Complex<Real>>(), from, tag, comm.comm,
         &request.backend ) );
 #endif
@@ -895,7 +1594,7 @@ EL_NO_RELEASE_EXCEPT
     request.unpackedRecvBuf = buf;
     ReserveSerialized( count, buf, request.buffer );
     SafeMpi
-    ( MPI_Irecv
+    ( profiled::Irecv
       ( request.buffer.data(), count, TypeMap<T>(), from, tag, comm.comm,
         &request.backend ) );
 }
@@ -925,7 +1624,7 @@ EL_NO_RELEASE_EXCEPT
     EL_DEBUG_CSE
     Status status;
     SafeMpi
-    ( MPI_Sendrecv
+    ( profiled::Sendrecv
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(), to,   stag,
         rbuf,                    rc, TypeMap<Real>(), from, rtag,
         comm.comm, &status ) );
@@ -942,13 +1641,13 @@ EL_NO_RELEASE_EXCEPT
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Sendrecv
+    ( profiled::Sendrecv
       ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(), to,   stag,
         rbuf,                             2*rc, TypeMap<Real>(), from, rtag,
         comm.comm, &status ) );
 #else
     SafeMpi
-    ( MPI_Sendrecv
+    ( profiled::Sendrecv
       ( const_cast<Complex<Real>*>(sbuf),
         sc, TypeMap<Complex<Real>>(), to,   stag,
         rbuf,
@@ -969,7 +1668,7 @@ void TaggedSendRecv
     Serialize( sc, sbuf, packedSend );
     ReserveSerialized( rc, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Sendrecv
+    ( profiled::Sendrecv
       ( packedSend.data(), sc, TypeMap<T>(), to,   stag,
         packedRecv.data(), rc, TypeMap<T>(), from, rtag,
         comm.comm, &status ) );
@@ -1006,7 +1705,7 @@ EL_NO_RELEASE_EXCEPT
     EL_DEBUG_CSE
     Status status;
     SafeMpi
-    ( MPI_Sendrecv_replace
+    ( profiled::Sendrecv_replace
       ( buf, count, TypeMap<Real>(), to, stag, from, rtag, comm.comm,
         &status ) );
 }
@@ -1022,12 +1721,12 @@ EL_NO_RELEASE_EXCEPT
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Sendrecv_replace
+    ( profiled::Sendrecv_replace
       ( buf, 2*count, TypeMap<Real>(), to, stag, from, rtag, comm.comm,
         &status ) );
 #else
     SafeMpi
-    ( MPI_Sendrecv_replace
+    ( profiled::Sendrecv_replace
       ( buf, count, TypeMap<Complex<Real>>(),
         to, stag, from, rtag, comm.comm, &status ) );
 #endif
@@ -1046,7 +1745,7 @@ EL_NO_RELEASE_EXCEPT
     Serialize( count, buf, packedBuf );
     Status status;
     SafeMpi
-    ( MPI_Sendrecv_replace
+    ( profiled::Sendrecv_replace
       ( packedBuf.data(), count, TypeMap<T>(), to, stag, from, rtag,
         comm.comm, &status ) );
     Deserialize( count, packedBuf, buf );
@@ -1065,7 +1764,7 @@ EL_NO_RELEASE_EXCEPT
     EL_DEBUG_CSE
     if( Size(comm) == 1 || count == 0 )
         return;
-    SafeMpi( MPI_Bcast( buf, count, TypeMap<Real>(), root, comm.comm ) );
+    SafeMpi( profiled::Bcast( buf, count, TypeMap<Real>(), root, comm.comm ) );
 }
 
 template<typename Real,
@@ -1077,9 +1776,9 @@ EL_NO_RELEASE_EXCEPT
     if( Size(comm) == 1 )
         return;
 #ifdef EL_AVOID_COMPLEX_MPI
-    SafeMpi( MPI_Bcast( buf, 2*count, TypeMap<Real>(), root, comm.comm ) );
+    SafeMpi( profiled::Bcast( buf, 2*count, TypeMap<Real>(), root, comm.comm ) );
 #else
-    SafeMpi( MPI_Bcast( buf, count, TypeMap<Complex<Real>>(), root, comm.comm ) );
+    SafeMpi( profiled::Bcast( buf, count, TypeMap<Complex<Real>>(), root, comm.comm ) );
 #endif
 }
 
@@ -1095,7 +1794,7 @@ EL_NO_RELEASE_EXCEPT
     std::vector<byte> packedBuf;
     Serialize( count, buf, packedBuf );
     SafeMpi(
-      MPI_Bcast( packedBuf.data(), count, TypeMap<T>(), root, comm.comm )
+      profiled::Bcast( packedBuf.data(), count, TypeMap<T>(), root, comm.comm )
     );
     Deserialize( count, packedBuf, buf );
 }
@@ -1112,7 +1811,7 @@ void IBroadcast
     EL_DEBUG_CSE
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
     SafeMpi
-    ( MPI_Ibcast
+    ( profiled::Ibcast
       ( buf, count, TypeMap<Real>(), root, comm.comm, &request.backend ) );
 #else
     LogicError("Elemental was not configured with non-blocking support");
@@ -1129,11 +1828,11 @@ void IBroadcast
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Ibcast
+    ( profiled::Ibcast
       ( buf, 2*count, TypeMap<Real>(), root, comm.comm, &request.backend ) );
 #else
     SafeMpi
-    ( MPI_Ibcast
+    ( profiled::Ibcast
       ( buf, count, TypeMap<Complex<Real>>(), root, comm.comm,
         &request.backend ) );
 #endif
@@ -1149,18 +1848,10 @@ void IBroadcast
 ( T* buf, int count, int root, Comm comm, Request<T>& request )
 {
     EL_DEBUG_CSE
-#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
-    request.receivingPacked = true;
-    request.recvCount = count;
-    request.unpackedRecvBuf = buf;
-    ReserveSerialized( count, buf, request.buffer );
-    SafeMpi
-    ( MPI_Ibcast
-      ( request.buffer.data(), count, TypeMap<Real>(), root, comm.comm,
-        &request.backend ) );
-#else
-    LogicError("Elemental was not configured with non-blocking support");
-#endif
+    // Serialized datatypes would require the packed send buffer to outlive
+    // this call, so the broadcast is completed eagerly
+    Broadcast( buf, count, root, comm );
+    request.backend = MPI_REQUEST_NULL;
 }
 
 template<typename T>
@@ -1176,7 +1867,7 @@ EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
     SafeMpi
-    ( MPI_Gather
+    ( profiled::Gather
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
         rbuf,                    rc, TypeMap<Real>(), root, comm.comm ) );
 }
@@ -1191,13 +1882,13 @@ EL_NO_RELEASE_EXCEPT
     EL_DEBUG_CSE
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Gather
+    ( profiled::Gather
       ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
         rbuf,                             2*rc, TypeMap<Real>(),
         root, comm.comm ) );
 #else
     SafeMpi
-    ( MPI_Gather
+    ( profiled::Gather
       ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
         rbuf,                             rc, TypeMap<Complex<Real>>(),
         root, comm.comm ) );
@@ -1223,7 +1914,7 @@ EL_NO_RELEASE_EXCEPT
     if( commRank == root )
         ReserveSerialized( totalRecv, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Gather
+    ( profiled::Gather
       ( packedSend.data(), sc, TypeMap<T>(),
         packedRecv.data(), rc, TypeMap<T>(), root, comm.comm ) );
     if( commRank == root )
@@ -1241,7 +1932,7 @@ void IGather
     EL_DEBUG_CSE
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
     SafeMpi
-    ( MPI_Igather
+    ( profiled::Igather
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
         rbuf,                    rc, TypeMap<Real>(), root, comm.comm,
         &request.backend ) );
@@ -1262,13 +1953,13 @@ void IGather
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Igather
+    ( profiled::Igather
       ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
         rbuf,                             2*rc, TypeMap<Real>(),
         root, comm.comm, &request.backend ) );
 #else
     SafeMpi
-    ( MPI_Igather
+    ( profiled::Igather
       ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
         rbuf,                             rc, TypeMap<Complex<Real>>(),
         root, comm.comm, &request.backend ) );
@@ -1288,23 +1979,9 @@ void IGather
   Request<T>& request )
 {
     EL_DEBUG_CSE
-#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
-    if( mpi::Rank(comm) == root )
-    {
-        const int commSize = mpi::Size(comm);
-        request.receivingPacked = true;
-        request.recvCount = rc*commSize;
-        request.unpackedRecvBuf = rbuf;
-        ReserveSerialized( rc*commSize, rbuf, request.buffer );
-    }
-    SafeMpi
-    ( MPI_Igather
-      ( request.buffer.data(), sc, TypeMap<Real>(),
-        rbuf,                  rc, TypeMap<Real>(), root, comm.comm,
-        &request.backend ) );
-#else
-    LogicError("Elemental was not configured with non-blocking support");
-#endif
+    // See the note in the non-packed IBroadcast
+    Gather( sbuf, sc, rbuf, rc, root, comm );
+    request.backend = MPI_REQUEST_NULL;
 }
 
 template<typename Real,
@@ -1317,7 +1994,7 @@ EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
     SafeMpi
-    ( MPI_Gatherv
+    ( profiled::Gatherv
       ( const_cast<Real*>(sbuf),
         sc,
         TypeMap<Real>(),
@@ -1353,13 +2030,13 @@ EL_NO_RELEASE_EXCEPT
         }
     }
     SafeMpi
-    ( MPI_Gatherv
+    ( profiled::Gatherv
       ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
         rbuf, rcsDouble.data(), rdsDouble.data(), TypeMap<Real>(),
         root, comm.comm ) );
 #else
     SafeMpi
-    ( MPI_Gatherv
+    ( profiled::Gatherv
       ( const_cast<Complex<Real>*>(sbuf),
         sc,
         TypeMap<Complex<Real>>(),
@@ -1394,7 +2071,7 @@ EL_NO_RELEASE_EXCEPT
     if( commRank == root )
         ReserveSerialized( totalRecv, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Gatherv
+    ( profiled::Gatherv
       ( packedSend.data(),
         sc,
         TypeMap<T>(),
@@ -1418,7 +2095,7 @@ EL_NO_RELEASE_EXCEPT
     EL_DEBUG_CSE
 #ifdef EL_USE_BYTE_ALLGATHERS
     SafeMpi
-    ( MPI_Allgather
+    ( profiled::Allgather
       ( reinterpret_cast<UCP>(const_cast<Real*>(sbuf)),
         sizeof(Real)*sc, MPI_UNSIGNED_CHAR,
         reinterpret_cast<UCP>(rbuf),
@@ -1426,7 +2103,7 @@ EL_NO_RELEASE_EXCEPT
         comm.comm ) );
 #else
     SafeMpi
-    ( MPI_Allgather
+    ( profiled::Allgather
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
         rbuf,                    rc, TypeMap<Real>(), comm.comm ) );
 #endif
@@ -1442,7 +2119,7 @@ EL_NO_RELEASE_EXCEPT
     EL_DEBUG_CSE
 #ifdef EL_USE_BYTE_ALLGATHERS
     SafeMpi
-    ( MPI_Allgather
+    ( profiled::Allgather
       ( reinterpret_cast<UCP>(const_cast<Complex<Real>*>(sbuf)),
         2*sizeof(Real)*sc, MPI_UNSIGNED_CHAR,
         reinterpret_cast<UCP>(rbuf),
@@ -1451,13 +2128,13 @@ EL_NO_RELEASE_EXCEPT
 #else
  #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Allgather
+    ( profiled::Allgather
       ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
         rbuf,                             2*rc, TypeMap<Real>(),
         comm.comm ) );
  #else
     SafeMpi
-    ( MPI_Allgather
+    ( profiled::Allgather
       ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
         rbuf,                             rc, TypeMap<Complex<Real>>(),
         comm.comm ) );
@@ -1482,12 +2159,74 @@ EL_NO_RELEASE_EXCEPT
 
     ReserveSerialized( totalRecv, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Allgather
+    ( profiled::Allgather
       ( packedSend.data(), sc, TypeMap<T>(),
         packedRecv.data(), rc, TypeMap<T>(), comm.comm ) );
     Deserialize( totalRecv, packedRecv, rbuf );
 }
 
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllGather
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm comm,
+  Request<Real>& request )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    SafeMpi
+    ( profiled::Iallgather
+      ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
+        rbuf,                    rc, TypeMap<Real>(), comm.comm,
+        &request.backend ) );
+#else
+    AllGather( sbuf, sc, rbuf, rc, comm );
+    request.backend = MPI_REQUEST_NULL;
+#endif
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllGather
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm comm,
+  Request<Complex<Real>>& request )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+ #ifdef EL_AVOID_COMPLEX_MPI
+    SafeMpi
+    ( profiled::Iallgather
+      ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
+        rbuf,                             2*rc, TypeMap<Real>(),
+        comm.comm, &request.backend ) );
+ #else
+    SafeMpi
+    ( profiled::Iallgather
+      ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
+        rbuf,                             rc, TypeMap<Complex<Real>>(),
+        comm.comm, &request.backend ) );
+ #endif
+#else
+    AllGather( sbuf, sc, rbuf, rc, comm );
+    request.backend = MPI_REQUEST_NULL;
+#endif
+}
+
+template<typename T,
+         typename/*=DisableIf<IsPacked<T>>*/,
+         typename/*=void*/>
+void IAllGather
+( const T* sbuf, int sc,
+        T* rbuf, int rc, Comm comm,
+  Request<T>& request )
+{
+    EL_DEBUG_CSE
+    // See the note in the non-packed IBroadcast
+    AllGather( sbuf, sc, rbuf, rc, comm );
+    request.backend = MPI_REQUEST_NULL;
+}
+
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
 void AllGather
@@ -1505,7 +2244,7 @@ EL_NO_RELEASE_EXCEPT
         byteRds[i] = sizeof(Real)*rds[i];
     }
     SafeMpi
-    ( MPI_Allgatherv
+    ( profiled::Allgatherv
       ( reinterpret_cast<UCP>(const_cast<Real*>(sbuf)),
         sizeof(Real)*sc, MPI_UNSIGNED_CHAR,
         reinterpret_cast<UCP>(rbuf),
@@ -1513,7 +2252,7 @@ EL_NO_RELEASE_EXCEPT
         comm.comm ) );
 #else
     SafeMpi
-    ( MPI_Allgatherv
+    ( profiled::Allgatherv
       ( const_cast<Real*>(sbuf),
         sc,
         TypeMap<Real>(),
@@ -1542,7 +2281,7 @@ EL_NO_RELEASE_EXCEPT
         byteRds[i] = 2*sizeof(Real)*rds[i];
     }
     SafeMpi
-    ( MPI_Allgatherv
+    ( profiled::Allgatherv
       ( reinterpret_cast<UCP>(const_cast<Complex<Real>*>(sbuf)),
         2*sizeof(Real)*sc, MPI_UNSIGNED_CHAR,
         reinterpret_cast<UCP>(rbuf),
@@ -1558,12 +2297,12 @@ EL_NO_RELEASE_EXCEPT
         realRds[i] = 2*rds[i];
     }
     SafeMpi
-    ( MPI_Allgatherv
+    ( profiled::Allgatherv
       ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
         rbuf, realRcs.data(), realRds.data(), TypeMap<Real>(), comm.comm ) );
  #else
     SafeMpi
-    ( MPI_Allgatherv
+    ( profiled::Allgatherv
       ( const_cast<Complex<Real>*>(sbuf),
         sc,
         TypeMap<Complex<Real>>(),
@@ -1593,7 +2332,7 @@ EL_NO_RELEASE_EXCEPT
 
     ReserveSerialized( totalRecv, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Allgatherv
+    ( profiled::Allgatherv
       ( packedSend.data(),
         sc,
         TypeMap<T>(),
@@ -1614,7 +2353,7 @@ EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
     SafeMpi
-    ( MPI_Scatter
+    ( profiled::Scatter
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
         rbuf,                    rc, TypeMap<Real>(), root, comm.comm ) );
 }
@@ -1629,13 +2368,13 @@ EL_NO_RELEASE_EXCEPT
     EL_DEBUG_CSE
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Scatter
+    ( profiled::Scatter
       ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
         rbuf,                             2*rc, TypeMap<Real>(), root,
         comm.comm ) );
 #else
     SafeMpi
-    ( MPI_Scatter
+    ( profiled::Scatter
       ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
         rbuf,                             rc, TypeMap<Complex<Real>>(),
         root, comm.comm ) );
@@ -1661,7 +2400,7 @@ EL_NO_RELEASE_EXCEPT
 
     ReserveSerialized( rc, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Scatter
+    ( profiled::Scatter
       ( packedSend.data(), sc, TypeMap<T>(),
         packedRecv.data(), rc, TypeMap<T>(), root, comm.comm ) );
     Deserialize( rc, packedRecv, rbuf );
@@ -1677,14 +2416,14 @@ EL_NO_RELEASE_EXCEPT
     if( commRank == root )
     {
         SafeMpi
-        ( MPI_Scatter
+        ( profiled::Scatter
           ( buf,          sc, TypeMap<Real>(),
             MPI_IN_PLACE, rc, TypeMap<Real>(), root, comm.comm ) );
     }
     else
     {
         SafeMpi
-        ( MPI_Scatter
+        ( profiled::Scatter
           ( 0,   sc, TypeMap<Real>(),
             buf, rc, TypeMap<Real>(), root, comm.comm ) );
     }
@@ -1701,12 +2440,12 @@ EL_NO_RELEASE_EXCEPT
     {
 #ifdef EL_AVOID_COMPLEX_MPI
         SafeMpi
-        ( MPI_Scatter
+        ( profiled::Scatter
           ( buf,          2*sc, TypeMap<Real>(),
             MPI_IN_PLACE, 2*rc, TypeMap<Real>(), root, comm.comm ) );
 #else
         SafeMpi
-        ( MPI_Scatter
+        ( profiled::Scatter
           ( buf,          sc, TypeMap<Complex<Real>>(),
             MPI_IN_PLACE, rc, TypeMap<Complex<Real>>(), root, comm.comm ) );
 #endif
@@ -1715,12 +2454,12 @@ EL_NO_RELEASE_EXCEPT
     {
 #ifdef EL_AVOID_COMPLEX_MPI
         SafeMpi
-        ( MPI_Scatter
+        ( profiled::Scatter
           ( 0,   2*sc, TypeMap<Real>(),
             buf, 2*rc, TypeMap<Real>(), root, comm.comm ) );
 #else
         SafeMpi
-        ( MPI_Scatter
+        ( profiled::Scatter
           ( 0,   sc, TypeMap<Complex<Real>>(),
             buf, rc, TypeMap<Complex<Real>>(), root, comm.comm ) );
 #endif
@@ -1746,7 +2485,7 @@ EL_NO_RELEASE_EXCEPT
 
     ReserveSerialized( rc, buf, packedRecv );
     SafeMpi
-    ( MPI_Scatter
+    ( profiled::Scatter
       ( packedSend.data(), sc, TypeMap<T>(),
         packedRecv.data(), rc, TypeMap<T>(), root, comm.comm ) );
     Deserialize( rc, packedRecv, buf );
@@ -1761,7 +2500,7 @@ EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
     SafeMpi
-    ( MPI_Alltoall
+    ( profiled::Alltoall
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
         rbuf,                    rc, TypeMap<Real>(), comm.comm ) );
 }
@@ -1776,14 +2515,14 @@ EL_NO_RELEASE_EXCEPT
     EL_DEBUG_CSE
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Alltoall
+    ( profiled::Alltoall
       ( const_cast<Complex<Real>*>(sbuf),
         2*sc, TypeMap<Real>(),
         rbuf,
         2*rc, TypeMap<Real>(), comm.comm ) );
 #else
     SafeMpi
-    ( MPI_Alltoall
+    ( profiled::Alltoall
       ( const_cast<Complex<Real>*>(sbuf),
         sc, TypeMap<Complex<Real>>(),
         rbuf,
@@ -1808,7 +2547,7 @@ EL_NO_RELEASE_EXCEPT
     Serialize( totalSend, sbuf, packedSend );
     ReserveSerialized( totalRecv, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Alltoall
+    ( profiled::Alltoall
       ( packedSend.data(), sc, TypeMap<T>(),
         packedRecv.data(), rc, TypeMap<T>(), comm.comm ) );
     Deserialize( totalRecv, packedRecv, rbuf );
@@ -1823,7 +2562,7 @@ EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
     SafeMpi
-    ( MPI_Alltoallv
+    ( profiled::Alltoallv
       ( const_cast<Real*>(sbuf),
         const_cast<int*>(scs),
         const_cast<int*>(sds),
@@ -1856,13 +2595,13 @@ EL_NO_RELEASE_EXCEPT
         rdsDoubled[i] = 2*rds[i];
     }
     SafeMpi
-    ( MPI_Alltoallv
+    ( profiled::Alltoallv
       ( const_cast<Complex<Real>*>(sbuf),
               scsDoubled.data(), sdsDoubled.data(), TypeMap<Real>(),
         rbuf, rcsDoubled.data(), rdsDoubled.data(), TypeMap<Real>(), comm.comm ) );
 #else
     SafeMpi
-    ( MPI_Alltoallv
+    ( profiled::Alltoallv
       ( const_cast<Complex<Real>*>(sbuf),
         const_cast<int*>(scs),
         const_cast<int*>(sds),
@@ -1892,7 +2631,7 @@ EL_NO_RELEASE_EXCEPT
     Serialize( totalSend, sbuf, packedSend );
     ReserveSerialized( totalRecv, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Alltoallv
+    ( profiled::Alltoallv
       ( packedSend.data(),
         const_cast<int*>(scs), const_cast<int*>(sds), TypeMap<T>(),
         packedRecv.data(),
@@ -1933,7 +2672,7 @@ EL_NO_RELEASE_EXCEPT
 
     MPI_Op opC = NativeOp<Real>( op );
     SafeMpi
-    ( MPI_Reduce
+    ( profiled::Reduce
       ( const_cast<Real*>(sbuf), rbuf, count, TypeMap<Real>(),
         opC, root, comm.comm ) );
 }
@@ -1954,7 +2693,7 @@ EL_NO_RELEASE_EXCEPT
     {
         MPI_Op opC = NativeOp<Real>( op );
         SafeMpi
-        ( MPI_Reduce
+        ( profiled::Reduce
           ( const_cast<Complex<Real>*>(sbuf),
             rbuf, 2*count, TypeMap<Real>(), opC,
             root, comm.comm ) );
@@ -1963,14 +2702,14 @@ EL_NO_RELEASE_EXCEPT
     {
         MPI_Op opC = NativeOp<Complex<Real>>( op );
         SafeMpi
-        ( MPI_Reduce
+        ( profiled::Reduce
           ( const_cast<Complex<Real>*>(sbuf),
             rbuf, count, TypeMap<Complex<Real>>(), opC, root, comm.comm ) );
     }
 #else
     MPI_Op opC = NativeOp<Complex<Real>>( op );
     SafeMpi
-    ( MPI_Reduce
+    ( profiled::Reduce
       ( const_cast<Complex<Real>*>(sbuf),
         rbuf, count, TypeMap<Complex<Real>>(), opC, root, comm.comm ) );
 #endif
@@ -1996,7 +2735,7 @@ EL_NO_RELEASE_EXCEPT
     if( commRank == root )
         ReserveSerialized( count, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Reduce
+    ( profiled::Reduce
       ( packedSend.data(), packedRecv.data(), count, TypeMap<T>(),
         opC, root, comm.comm ) );
     if( commRank == root )
@@ -2041,13 +2780,13 @@ EL_NO_RELEASE_EXCEPT
     if( commRank == root )
     {
         SafeMpi
-        ( MPI_Reduce
+        ( profiled::Reduce
           ( MPI_IN_PLACE, buf, count, TypeMap<Real>(), opC, root,
             comm.comm ) );
     }
     else
         SafeMpi
-        ( MPI_Reduce
+        ( profiled::Reduce
           ( buf, 0, count, TypeMap<Real>(), opC, root, comm.comm ) );
 }
 
@@ -2069,13 +2808,13 @@ EL_NO_RELEASE_EXCEPT
             if( commRank == root )
             {
                 SafeMpi
-                ( MPI_Reduce
+                ( profiled::Reduce
                   ( MPI_IN_PLACE, buf, 2*count, TypeMap<Real>(), opC,
                     root, comm.comm ) );
             }
             else
                 SafeMpi
-                ( MPI_Reduce
+                ( profiled::Reduce
                   ( buf, 0, 2*count, TypeMap<Real>(), opC, root, comm.comm ) );
         }
         else
@@ -2084,13 +2823,13 @@ EL_NO_RELEASE_EXCEPT
             if( commRank == root )
             {
                 SafeMpi
-                ( MPI_Reduce
+                ( profiled::Reduce
                   ( MPI_IN_PLACE, buf, count, TypeMap<Complex<Real>>(), opC,
                     root, comm.comm ) );
             }
             else
                 SafeMpi
-                ( MPI_Reduce
+                ( profiled::Reduce
                   ( buf, 0, count, TypeMap<Complex<Real>>(), opC,
                     root, comm.comm ) );
         }
@@ -2099,13 +2838,13 @@ EL_NO_RELEASE_EXCEPT
         if( commRank == root )
         {
             SafeMpi
-            ( MPI_Reduce
+            ( profiled::Reduce
               ( MPI_IN_PLACE, buf, count, TypeMap<Complex<Real>>(), opC,
                 root, comm.comm ) );
         }
         else
             SafeMpi
-            ( MPI_Reduce
+            ( profiled::Reduce
               ( buf, 0, count, TypeMap<Complex<Real>>(), opC, root,
                 comm.comm ) );
 #endif
@@ -2133,7 +2872,7 @@ EL_NO_RELEASE_EXCEPT
     if( commRank == root )
         ReserveSerialized( count, buf, packedRecv );
     SafeMpi
-    ( MPI_Reduce
+    ( profiled::Reduce
       ( packedSend.data(), packedRecv.data(), count, TypeMap<T>(),
         opC, root, comm.comm ) );
     if( commRank == root )
@@ -2155,7 +2894,7 @@ EL_NO_RELEASE_EXCEPT
     {
         MPI_Op opC = NativeOp<Real>( op );
         SafeMpi
-        ( MPI_Allreduce
+        ( profiled::Allreduce
           ( const_cast<Real*>(sbuf), rbuf, count, TypeMap<Real>(), opC,
             comm.comm ) );
     }
@@ -2175,7 +2914,7 @@ EL_NO_RELEASE_EXCEPT
         {
             MPI_Op opC = NativeOp<Real>( op );
             SafeMpi
-            ( MPI_Allreduce
+            ( profiled::Allreduce
                 ( const_cast<Complex<Real>*>(sbuf),
                   rbuf, 2*count, TypeMap<Real>(), opC, comm.comm ) );
         }
@@ -2183,14 +2922,14 @@ EL_NO_RELEASE_EXCEPT
         {
             MPI_Op opC = NativeOp<Complex<Real>>( op );
             SafeMpi
-            ( MPI_Allreduce
+            ( profiled::Allreduce
               ( const_cast<Complex<Real>*>(sbuf),
                 rbuf, count, TypeMap<Complex<Real>>(), opC, comm.comm ) );
         }
 #else
         MPI_Op opC = NativeOp<Complex<Real>>( op );
         SafeMpi
-        ( MPI_Allreduce
+        ( profiled::Allreduce
           ( const_cast<Complex<Real>*>(sbuf),
             rbuf, count, TypeMap<Complex<Real>>(), opC, comm.comm ) );
 #endif
@@ -2214,7 +2953,7 @@ EL_NO_RELEASE_EXCEPT
 
     ReserveSerialized( count, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Allreduce
+    ( profiled::Allreduce
       ( packedSend.data(), packedRecv.data(), count, TypeMap<T>(),
         opC, comm.comm ) );
     Deserialize( count, packedRecv, rbuf );
@@ -2246,7 +2985,7 @@ EL_NO_RELEASE_EXCEPT
 
     MPI_Op opC = NativeOp<Real>( op );
     SafeMpi
-    ( MPI_Allreduce
+    ( profiled::Allreduce
       ( MPI_IN_PLACE, buf, count, TypeMap<Real>(), opC, comm.comm ) );
 }
 
@@ -2264,21 +3003,21 @@ EL_NO_RELEASE_EXCEPT
     {
         MPI_Op opC = NativeOp<Real>( op );
         SafeMpi
-        ( MPI_Allreduce
+        ( profiled::Allreduce
           ( MPI_IN_PLACE, buf, 2*count, TypeMap<Real>(), opC, comm.comm ) );
     }
     else
     {
         MPI_Op opC = NativeOp<Complex<Real>>( op );
         SafeMpi
-        ( MPI_Allreduce
+        ( profiled::Allreduce
           ( MPI_IN_PLACE, buf, count, TypeMap<Complex<Real>>(),
             opC, comm.comm ) );
     }
 #else
     MPI_Op opC = NativeOp<Complex<Real>>( op );
     SafeMpi
-    ( MPI_Allreduce
+    ( profiled::Allreduce
       ( MPI_IN_PLACE, buf, count, TypeMap<Complex<Real>>(), opC,
         comm.comm ) );
 #endif
@@ -2300,7 +3039,7 @@ EL_NO_RELEASE_EXCEPT
 
     ReserveSerialized( count, buf, packedRecv );
     SafeMpi
-    ( MPI_Allreduce
+    ( profiled::Allreduce
       ( packedSend.data(), packedRecv.data(), count, TypeMap<T>(),
         opC, comm.comm ) );
     Deserialize( count, packedRecv, buf );
@@ -2327,7 +3066,7 @@ EL_NO_RELEASE_EXCEPT
 #elif defined(EL_HAVE_MPI_REDUCE_SCATTER_BLOCK)
     MPI_Op opC = NativeOp<Real>( op );
     SafeMpi
-    ( MPI_Reduce_scatter_block
+    ( profiled::Reduce_scatter_block
       ( sbuf, rbuf, rc, TypeMap<Real>(), opC, comm.comm ) );
 #else
     const int commSize = Size( comm );
@@ -2355,12 +3094,12 @@ EL_NO_RELEASE_EXCEPT
 # ifdef EL_AVOID_COMPLEX_MPI
     MPI_Op opC = NativeOp<Real>( op );
     SafeMpi
-    ( MPI_Reduce_scatter_block
+    ( profiled::Reduce_scatter_block
       ( sbuf, rbuf, 2*rc, TypeMap<Real>(), opC, comm.comm ) );
 # else
     MPI_Op opC = NativeOp<Complex<Real>>( op );
     SafeMpi
-    ( MPI_Reduce_scatter_block
+    ( profiled::Reduce_scatter_block
       ( sbuf, rbuf, rc, TypeMap<Complex<Real>>(), opC, comm.comm ) );
 # endif
 #else
@@ -2392,7 +3131,7 @@ EL_NO_RELEASE_EXCEPT
 
     ReserveSerialized( totalRecv, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Reduce_scatter_block
+    ( profiled::Reduce_scatter_block
       ( packedSend.data(), packedRecv.data(), rc, TypeMap<T>(),
         opC, comm.comm ) );
 
@@ -2436,7 +3175,7 @@ EL_NO_RELEASE_EXCEPT
 #elif defined(EL_HAVE_MPI_REDUCE_SCATTER_BLOCK)
     MPI_Op opC = NativeOp<Real>( op );
     SafeMpi
-    ( MPI_Reduce_scatter_block
+    ( profiled::Reduce_scatter_block
       ( MPI_IN_PLACE, buf, rc, TypeMap<Real>(), opC, comm.comm ) );
 #else
     const int commSize = Size( comm );
@@ -2464,12 +3203,12 @@ EL_NO_RELEASE_EXCEPT
 # ifdef EL_AVOID_COMPLEX_MPI
     MPI_Op opC = NativeOp<Real>( op );
     SafeMpi
-    ( MPI_Reduce_scatter_block
+    ( profiled::Reduce_scatter_block
       ( MPI_IN_PLACE, buf, 2*rc, TypeMap<Real>(), opC, comm.comm ) );
 # else
     MPI_Op opC = NativeOp<Complex<Real>>( op );
     SafeMpi
-    ( MPI_Reduce_scatter_block
+    ( profiled::Reduce_scatter_block
       ( MPI_IN_PLACE, buf, rc, TypeMap<Complex<Real>>(), opC, comm.comm ) );
 # endif
 #else
@@ -2501,7 +3240,7 @@ EL_NO_RELEASE_EXCEPT
 
     ReserveSerialized( totalRecv, buf, packedRecv );
     SafeMpi
-    ( MPI_Reduce_scatter_block
+    ( profiled::Reduce_scatter_block
       ( packedSend.data(), packedRecv.data(), rc, TypeMap<T>(),
         opC, comm.comm ) );
 
@@ -2526,7 +3265,7 @@ EL_NO_RELEASE_EXCEPT
     EL_DEBUG_CSE
     MPI_Op opC = NativeOp<Real>( op );
     SafeMpi
-    ( MPI_Reduce_scatter
+    ( profiled::Reduce_scatter
       ( const_cast<Real*>(sbuf),
         rbuf, const_cast<int*>(rcs), TypeMap<Real>(), opC, comm.comm ) );
 }
@@ -2549,7 +3288,7 @@ EL_NO_RELEASE_EXCEPT
         for( int i=0; i<p; ++i )
             rcsDoubled[i] = 2*rcs[i];
         SafeMpi
-        ( MPI_Reduce_scatter
+        ( profiled::Reduce_scatter
           ( const_cast<Complex<Real>*>(sbuf),
             rbuf, rcsDoubled.data(), TypeMap<Real>(), opC, comm.comm ) );
     }
@@ -2557,7 +3296,7 @@ EL_NO_RELEASE_EXCEPT
     {
         MPI_Op opC = NativeOp<Complex<Real>>( op );
         SafeMpi
-        ( MPI_Reduce_scatter
+        ( profiled::Reduce_scatter
           ( const_cast<Complex<Real>*>(sbuf),
             rbuf, const_cast<int*>(rcs), TypeMap<Complex<Real>>(),
             opC, comm.comm ) );
@@ -2565,7 +3304,7 @@ EL_NO_RELEASE_EXCEPT
 #else
     MPI_Op opC = NativeOp<Complex<Real>>( op );
     SafeMpi
-    ( MPI_Reduce_scatter
+    ( profiled::Reduce_scatter
       ( const_cast<Complex<Real>*>(sbuf),
         rbuf, const_cast<int*>(rcs), TypeMap<Complex<Real>>(), opC,
         comm.comm ) );
@@ -2592,7 +3331,7 @@ EL_NO_RELEASE_EXCEPT
     Serialize( totalSend, sbuf, packedSend );
     ReserveSerialized( totalRecv, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Reduce_scatter
+    ( profiled::Reduce_scatter
       ( packedSend.data(), packedRecv.data(), const_cast<int*>(rcs),
         TypeMap<T>(), opC, comm.comm ) );
     Deserialize( totalRecv, packedRecv, rbuf );
@@ -2630,7 +3369,7 @@ EL_NO_RELEASE_EXCEPT
     {
         MPI_Op opC = NativeOp<Real>( op );
         SafeMpi
-        ( MPI_Scan
+        ( profiled::Scan
           ( const_cast<Real*>(sbuf), rbuf, count, TypeMap<Real>(),
             opC, comm.comm ) );
     }
@@ -2651,7 +3390,7 @@ EL_NO_RELEASE_EXCEPT
         {
             MPI_Op opC = NativeOp<Real>( op );
             SafeMpi
-            ( MPI_Scan
+            ( profiled::Scan
               ( const_cast<Complex<Real>*>(sbuf),
                 rbuf, 2*count, TypeMap<Real>(), opC, comm.comm ) );
         }
@@ -2659,14 +3398,14 @@ EL_NO_RELEASE_EXCEPT
         {
             MPI_Op opC = NativeOp<Complex<Real>>( op );
             SafeMpi
-            ( MPI_Scan
+            ( profiled::Scan
               ( const_cast<Complex<Real>*>(sbuf),
                 rbuf, count, TypeMap<Complex<Real>>(), opC, comm.comm ) );
         }
 #else
         MPI_Op opC = NativeOp<Complex<Real>>( op );
         SafeMpi
-        ( MPI_Scan
+        ( profiled::Scan
           ( const_cast<Complex<Real>*>(sbuf),
             rbuf, count, TypeMap<Complex<Real>>(), opC, comm.comm ) );
 #endif
@@ -2688,7 +3427,7 @@ EL_NO_RELEASE_EXCEPT
     Serialize( count, sbuf, packedSend );
     ReserveSerialized( count, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Scan
+    ( profiled::Scan
       ( packedSend.data(), packedRecv.data(), count, TypeMap<T>(),
         opC, comm.comm ) );
     Deserialize( count, packedRecv, rbuf );
@@ -2727,7 +3466,7 @@ EL_NO_RELEASE_EXCEPT
     {
         MPI_Op opC = NativeOp<Real>( op );
         SafeMpi
-        ( MPI_Scan
+        ( profiled::Scan
           ( MPI_IN_PLACE, buf, count, TypeMap<Real>(), opC, comm.comm ) );
     }
 }
@@ -2745,21 +3484,21 @@ EL_NO_RELEASE_EXCEPT
         {
             MPI_Op opC = NativeOp<Real>( op );
             SafeMpi
-            ( MPI_Scan
+            ( profiled::Scan
               ( MPI_IN_PLACE, buf, 2*count, TypeMap<Real>(), opC, comm.comm ) );
         }
         else
         {
             MPI_Op opC = NativeOp<Complex<Real>>( op );
             SafeMpi
-            ( MPI_Scan
+            ( profiled::Scan
               ( MPI_IN_PLACE, buf, count, TypeMap<Complex<Real>>(), opC,
                 comm.comm ) );
         }
 #else
         MPI_Op opC = NativeOp<Complex<Real>>( op );
         SafeMpi
-        ( MPI_Scan
+        ( profiled::Scan
           ( MPI_IN_PLACE, buf, count, TypeMap<Complex<Real>>(), opC,
             comm.comm ) );
 #endif
@@ -2781,7 +3520,7 @@ EL_NO_RELEASE_EXCEPT
     Serialize( count, buf, packedSend );
     ReserveSerialized( count, buf, packedRecv );
     SafeMpi
-    ( MPI_Scan
+    ( profiled::Scan
       ( packedSend.data(), packedRecv.data(), count, TypeMap<T>(),
         opC, comm.comm ) );
     Deserialize( count, packedRecv, buf );
@@ -2827,7 +3566,7 @@ EL_NO_RELEASE_EXCEPT
     }
 
     // Ensure that recvs are posted before the sends
-    // (Invalid MPI_Irecv's have been observed otherwise)
+    // (Invalid profiled::Irecv's have been observed otherwise)
     Barrier( comm );
 
     for( int q=0; q<commSize; ++q )
@@ -2997,6 +3736,9 @@ EL_NO_RELEASE_EXCEPT
   EL_NO_RELEASE_EXCEPT; \
   template void AllGather<S>( const T* sbuf, int sc, T* rbuf, int rc, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
+  template void IAllGather<S> \
+  ( const T* sbuf, int sc, T* rbuf, int rc, Comm comm, \
+    Request<T>& request ); \
   template void AllGather<S> \
   ( const T* sbuf, int sc, \
           T* rbuf, const int* rcs, const int* rds, Comm comm ) \
@@ -11,6 +11,7 @@
 #include "./Bidiag/Apply.hpp"
 #include "./Bidiag/LowerBlocked.hpp"
 #include "./Bidiag/UpperBlocked.hpp"
+#include "./Bidiag/TwoStage.hpp"
 
 namespace El {
 
@@ -205,7 +206,38 @@ void ExplicitCondensed( AbstractDistMatrix<F>& A )
   ( LeftOrRight side, Orientation orientation, \
     const AbstractDistMatrix<F>& A, \
     const AbstractDistMatrix<F>& householderScalars, \
-          AbstractDistMatrix<F>& B );
+          AbstractDistMatrix<F>& B ); \
+  template void bidiag::ReduceToBand \
+  ( AbstractDistMatrix<F>& A, \
+    AbstractDistMatrix<F>& householderScalarsQ, \
+    AbstractDistMatrix<Base<F>>& signatureQ, \
+    AbstractDistMatrix<F>& householderScalarsP, \
+    AbstractDistMatrix<Base<F>>& signatureP, \
+    Int bandwidth ); \
+  template void bidiag::ApplyBandQ \
+  ( const AbstractDistMatrix<F>& A, \
+    const AbstractDistMatrix<F>& householderScalars, \
+    const AbstractDistMatrix<Base<F>>& signature, \
+    Int bandwidth, \
+          AbstractDistMatrix<F>& B ); \
+  template void bidiag::ApplyBandP \
+  ( const AbstractDistMatrix<F>& A, \
+    const AbstractDistMatrix<F>& householderScalars, \
+    const AbstractDistMatrix<Base<F>>& signature, \
+    Int bandwidth, \
+          AbstractDistMatrix<F>& B ); \
+  template void bidiag::BandToBidiag \
+  ( Int bandwidth, \
+    const Matrix<F>& band, \
+          Matrix<Base<F>>& d, \
+          Matrix<Base<F>>& e ); \
+  template void bidiag::BandToBidiag \
+  ( Int bandwidth, \
+    const Matrix<F>& band, \
+          Matrix<Base<F>>& d, \
+          Matrix<Base<F>>& e, \
+          Matrix<F>& U, \
+          Matrix<F>& V );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
@@ -0,0 +1,388 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BIDIAG_TWOSTAGE_HPP
+#define EL_BIDIAG_TWOSTAGE_HPP
+
+namespace El {
+namespace bidiag {
+
+// Two-stage reduction to bidiagonal form
+// ======================================
+// Analogous to the two-stage Hermitian reduction to tridiagonal form, a
+// tall matrix is first reduced to an upper band matrix via alternating
+// QR and LQ factorizations of panels, each followed by a Gemm-based
+// application of its unitary factor, and the band is then reduced to upper
+// bidiagonal form by bulge chasing.
+
+// On exit, the upper band of the top n x n submatrix of A holds
+// B = Q1^H A P1, with the Householder vectors of the QR factorizations stored
+// below the diagonal and those of the LQ factorizations stored above the band.
+template<typename F>
+void ReduceToBand
+( AbstractDistMatrix<F>& APre,
+  AbstractDistMatrix<F>& householderScalarsQPre,
+  AbstractDistMatrix<Base<F>>& signatureQPre,
+  AbstractDistMatrix<F>& householderScalarsPPre,
+  AbstractDistMatrix<Base<F>>& signaturePPre,
+  Int bandwidth )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      AssertSameGrids
+      ( APre, householderScalarsQPre, signatureQPre,
+        householderScalarsPPre, signaturePPre );
+      if( APre.Height() < APre.Width() )
+          LogicError("A must be at least as tall as it is wide");
+      if( bandwidth < 1 )
+          LogicError("The bandwidth must be positive");
+    )
+    typedef Base<F> Real;
+    const Int m = APre.Height();
+    const Int n = APre.Width();
+    const Grid& g = APre.Grid();
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<F,F,STAR,STAR>
+      householderScalarsQProx( householderScalarsQPre ),
+      householderScalarsPProx( householderScalarsPPre );
+    DistMatrixWriteProxy<Real,Real,STAR,STAR>
+      signatureQProx( signatureQPre ),
+      signaturePProx( signaturePPre );
+    auto& A = AProx.Get();
+    auto& householderScalarsQ = householderScalarsQProx.Get();
+    auto& householderScalarsP = householderScalarsPProx.Get();
+    auto& signatureQ = signatureQProx.Get();
+    auto& signatureP = signaturePProx.Get();
+
+    Zeros( householderScalarsQ, n, 1 );
+    Zeros( householderScalarsP, n, 1 );
+    Ones( signatureQ, n, 1 );
+    Ones( signatureP, n, 1 );
+
+    DistMatrix<F,STAR,STAR> householderScalars1(g);
+    DistMatrix<Real,STAR,STAR> signature1(g);
+    for( Int k=0; k<n; k+=bandwidth )
+    {
+        const Int nb = Min(bandwidth,n-k);
+        const Range<Int> ind1( k, k+nb ),
+                         indB( k, m ),
+                         indR( k+nb, n );
+
+        // Annihilate the panel below its diagonal
+        auto APan = A( indB, ind1 );
+        auto ARight = A( indB, indR );
+        QR( APan, householderScalars1, signature1 );
+        qr::ApplyQ
+        ( LEFT, ADJOINT, APan, householderScalars1, signature1, ARight );
+        auto tQ1 = householderScalarsQ( ind1, ALL );
+        auto dQ1 = signatureQ( ind1, ALL );
+        tQ1 = householderScalars1;
+        dQ1 = signature1;
+
+        // Annihilate the entries to the right of the band
+        if( k+nb < n-1 )
+        {
+            const Int minDim = Min(nb,n-k-nb);
+            const Range<Int> indP( k, k+minDim );
+            auto ATop = A( ind1, indR );
+            auto ABR = A( IR(k+nb,m), indR );
+            LQ( ATop, householderScalars1, signature1 );
+            lq::ApplyQ
+            ( RIGHT, ADJOINT, ATop, householderScalars1, signature1, ABR );
+            auto tP1 = householderScalarsP( indP, ALL );
+            auto dP1 = signatureP( indP, ALL );
+            tP1 = householderScalars1;
+            dP1 = signature1;
+        }
+    }
+}
+
+// Overwrite B with Q1 B
+template<typename F>
+void ApplyBandQ
+( const AbstractDistMatrix<F>& APre,
+  const AbstractDistMatrix<F>& householderScalarsPre,
+  const AbstractDistMatrix<Base<F>>& signaturePre,
+  Int bandwidth,
+        AbstractDistMatrix<F>& BPre )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      AssertSameGrids( APre, householderScalarsPre, signaturePre, BPre );
+      if( APre.Height() != BPre.Height() )
+          LogicError("A and B must be the same height");
+    )
+    typedef Base<F> Real;
+    const Int m = APre.Height();
+    const Int n = APre.Width();
+
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixReadProxy<F,F,STAR,STAR>
+      householderScalarsProx( householderScalarsPre );
+    DistMatrixReadProxy<Real,Real,STAR,STAR> signatureProx( signaturePre );
+    DistMatrixReadWriteProxy<F,F,MC,MR> BProx( BPre );
+    auto& A = AProx.GetLocked();
+    auto& householderScalars = householderScalarsProx.GetLocked();
+    auto& signature = signatureProx.GetLocked();
+    auto& B = BProx.Get();
+
+    const Int numPanels = ( n > 0 ? (n-1)/bandwidth + 1 : 0 );
+    for( Int panel=numPanels-1; panel>=0; --panel )
+    {
+        const Int k = panel*bandwidth;
+        const Int nb = Min(bandwidth,n-k);
+        const Range<Int> ind1( k, k+nb ), indB( k, m );
+
+        auto APan = A( indB, ind1 );
+        auto BB = B( indB, ALL );
+        auto t1 = householderScalars( ind1, ALL );
+        auto d1 = signature( ind1, ALL );
+        qr::ApplyQ( LEFT, NORMAL, APan, t1, d1, BB );
+    }
+}
+
+// Overwrite B with P1 B
+template<typename F>
+void ApplyBandP
+( const AbstractDistMatrix<F>& APre,
+  const AbstractDistMatrix<F>& householderScalarsPre,
+  const AbstractDistMatrix<Base<F>>& signaturePre,
+  Int bandwidth,
+        AbstractDistMatrix<F>& BPre )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      AssertSameGrids( APre, householderScalarsPre, signaturePre, BPre );
+      if( APre.Width() != BPre.Height() )
+          LogicError("B must be as tall as A is wide");
+    )
+    typedef Base<F> Real;
+    const Int n = APre.Width();
+
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixReadProxy<F,F,STAR,STAR>
+      householderScalarsProx( householderScalarsPre );
+    DistMatrixReadProxy<Real,Real,STAR,STAR> signatureProx( signaturePre );
+    DistMatrixReadWriteProxy<F,F,MC,MR> BProx( BPre );
+    auto& A = AProx.GetLocked();
+    auto& householderScalars = householderScalarsProx.GetLocked();
+    auto& signature = signatureProx.GetLocked();
+    auto& B = BProx.Get();
+
+    const Int numPanels = ( n > 0 ? (n-1)/bandwidth + 1 : 0 );
+    for( Int panel=numPanels-1; panel>=0; --panel )
+    {
+        const Int k = panel*bandwidth;
+        const Int nb = Min(bandwidth,n-k);
+        if( k+nb >= n-1 )
+            continue;
+        const Int minDim = Min(nb,n-k-nb);
+        const Range<Int> ind1( k, k+nb ),
+                         indP( k, k+minDim ),
+                         indR( k+nb, n );
+
+        auto ATop = A( ind1, indR );
+        auto BB = B( indR, ALL );
+        auto t1 = householderScalars( indP, ALL );
+        auto d1 = signature( indP, ALL );
+        lq::ApplyQ( LEFT, ADJOINT, ATop, t1, d1, BB );
+    }
+}
+
+namespace band_to_bidiag {
+
+// The band is stored such that B(j-i+bandwidth,j) = A(i,j), which leaves
+// room for the bandwidth-1 subdiagonals of fill introduced by the
+// right reflectors and the 2*bandwidth-1 superdiagonals introduced by the
+// left reflectors.
+
+// Overwrite the leading columns of each of the (local) rows of Q with
+// Q H^H, where H = I - tau v v^H
+template<typename F>
+void AccumulateReflector
+( Matrix<F>& Q, Int offset, const vector<F>& v, const F& tau,
+  vector<F>& work )
+{
+    const Int QHeight = Q.Height();
+    const Int len = v.size();
+    if( QHeight == 0 )
+        return;
+    work.resize( QHeight );
+    blas::Gemv
+    ( 'N', QHeight, len,
+      F(1), Q.Buffer(0,offset), Q.LDim(), v.data(), 1,
+      F(0), work.data(), 1 );
+    blas::Ger
+    ( QHeight, len,
+      -Conj(tau), work.data(), 1, v.data(), 1,
+      Q.Buffer(0,offset), Q.LDim() );
+}
+
+// Annihilate A(r,c0+1:c1) via A := A H^H, where H acts on columns c0:c1
+template<typename F>
+void RightStep
+( Matrix<F>& B, Int bandwidth, Int r, Int c0, Int c1,
+  vector<F>& v, Matrix<F>& V, vector<F>& work )
+{
+    const Int len = c1 - c0 + 1;
+    auto entry = [&]( Int i, Int j ) -> F& { return B(j-i+bandwidth,j); };
+
+    v.resize( len );
+    for( Int l=0; l<len; ++l )
+        v[l] = Conj(entry(r,c0+l));
+    F chi = v[0];
+    const F tau = lapack::Reflector( len, chi, &v[1], 1 );
+    v[0] = F(1);
+    entry(r,c0) = chi;
+    for( Int l=1; l<len; ++l )
+        entry(r,c0+l) = F(0);
+
+    for( Int i=r+1; i<=c1; ++i )
+    {
+        F gamma = 0;
+        for( Int l=0; l<len; ++l )
+            gamma += entry(i,c0+l)*v[l];
+        gamma *= Conj(tau);
+        for( Int l=0; l<len; ++l )
+            entry(i,c0+l) -= gamma*Conj(v[l]);
+    }
+
+    AccumulateReflector( V, c0, v, tau, work );
+}
+
+// Annihilate A(c+1:r1,c) via A := H A, where H acts on rows c:r1
+template<typename F>
+void LeftStep
+( Matrix<F>& B, Int bandwidth, Int c, Int r1,
+  vector<F>& v, Matrix<F>& U, vector<F>& work )
+{
+    const Int n = B.Width();
+    const Int len = r1 - c + 1;
+    auto entry = [&]( Int i, Int j ) -> F& { return B(j-i+bandwidth,j); };
+
+    v.resize( len );
+    for( Int l=0; l<len; ++l )
+        v[l] = entry(c+l,c);
+    F chi = v[0];
+    const F tau = lapack::Reflector( len, chi, &v[1], 1 );
+    v[0] = F(1);
+    entry(c,c) = chi;
+    for( Int l=1; l<len; ++l )
+        entry(c+l,c) = F(0);
+
+    const Int colEnd = Min(r1+bandwidth+1,n);
+    for( Int j=c+1; j<colEnd; ++j )
+    {
+        F gamma = 0;
+        for( Int l=0; l<len; ++l )
+            gamma += Conj(v[l])*entry(c+l,j);
+        gamma *= tau;
+        for( Int l=0; l<len; ++l )
+            entry(c+l,j) -= v[l]*gamma;
+    }
+
+    AccumulateReflector( U, c, v, tau, work );
+}
+
+template<typename F>
+void Reduce
+( Int bandwidth,
+  const Matrix<F>& band,
+        Matrix<Base<F>>& d,
+        Matrix<Base<F>>& e,
+        Matrix<F>& U,
+        Matrix<F>& V )
+{
+    EL_DEBUG_CSE
+    const Int n = band.Width();
+    EL_DEBUG_ONLY(
+      if( band.Height() != bandwidth+1 )
+          LogicError("The band should have bandwidth+1 rows");
+      if( U.Width() != n || V.Width() != n )
+          LogicError("U and V should have ",n," columns");
+    )
+
+    Matrix<F> B;
+    Zeros( B, 3*bandwidth+1, n );
+    for( Int offset=0; offset<=bandwidth; ++offset )
+        for( Int i=0; i<n-offset; ++i )
+            B(offset+bandwidth,i+offset) = band(offset,i);
+
+    vector<F> v, work;
+
+    // Ensure that the top-left entry is real
+    LeftStep( B, bandwidth, 0, 0, v, U, work );
+
+    for( Int j=0; j<n-1; ++j )
+    {
+        // Annihilate row j to the right of its superdiagonal (so that the
+        // superdiagonal and the next diagonal entry are real) and then chase
+        // the resulting bulge off of the end
+        Int r = j;
+        Int c0 = j+1;
+        Int c1 = Min(j+bandwidth,n-1);
+        while( true )
+        {
+            RightStep( B, bandwidth, r, c0, c1, v, V, work );
+            LeftStep( B, bandwidth, c0, c1, v, U, work );
+            r = c0;
+            c0 = c1+1;
+            c1 = Min(c0+bandwidth-1,n-1);
+            if( c1 <= c0 )
+                break;
+        }
+    }
+
+    d.Resize( n, 1 );
+    e.Resize( Max(n-1,Int(0)), 1 );
+    for( Int j=0; j<n; ++j )
+        d(j) = RealPart(B(bandwidth,j));
+    for( Int j=0; j<n-1; ++j )
+        e(j) = RealPart(B(bandwidth+1,j+1));
+}
+
+} // namespace band_to_bidiag
+
+// Reduce the upper band matrix stored in 'band', such that
+// band(j-i,i) = A(i,j) for 0 <= j-i <= bandwidth, to real upper bidiagonal
+// form.
+template<typename F>
+void BandToBidiag
+( Int bandwidth,
+  const Matrix<F>& band,
+        Matrix<Base<F>>& d,
+        Matrix<Base<F>>& e )
+{
+    EL_DEBUG_CSE
+    const Int n = band.Width();
+    Matrix<F> U( 0, n ), V( 0, n );
+    band_to_bidiag::Reduce( bandwidth, band, d, e, U, V );
+}
+
+// Also overwrite U with U Q2 and V with V P2, where A = Q2 B P2^H. Since the
+// updates only mix columns, U and V may hold arbitrary subsets of the rows
+// of distributed matrices (e.g., the local rows of [VC,* ] matrices), and
+// either may have zero height if it is not needed.
+template<typename F>
+void BandToBidiag
+( Int bandwidth,
+  const Matrix<F>& band,
+        Matrix<Base<F>>& d,
+        Matrix<Base<F>>& e,
+        Matrix<F>& U,
+        Matrix<F>& V )
+{
+    EL_DEBUG_CSE
+    band_to_bidiag::Reduce( bandwidth, band, d, e, U, V );
+}
+
+} // namespace bidiag
+} // namespace El
+
+#endif // ifndef EL_BIDIAG_TWOSTAGE_HPP
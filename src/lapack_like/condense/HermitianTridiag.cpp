@@ -47,6 +47,7 @@ void Ger2Sub
 #include "./HermitianTridiag/UpperBlockedSquare.hpp"
 
 #include "./HermitianTridiag/ApplyQ.hpp"
+#include "./HermitianTridiag/TwoStage.hpp"
 
 namespace El {
 
@@ -77,6 +78,8 @@ void HermitianTridiag
     auto& householderScalars = householderScalarsProx.Get();
 
     const Grid& grid = A.Grid();
+    BlocksizeScope
+      blocksizeScope( TunedBlocksize<F>( "HermitianTridiag", grid ) );
     if( ctrl.approach == HERMITIAN_TRIDIAG_NORMAL )
     {
         // Use the pipelined algorithm for nonsquare meshes
@@ -218,7 +221,30 @@ void ExplicitCondensed
     Orientation orientation, \
     const AbstractDistMatrix<F>& A, \
     const AbstractDistMatrix<F>& householderScalars, \
-          AbstractDistMatrix<F>& B );
+          AbstractDistMatrix<F>& B ); \
+  template void herm_tridiag::ReduceToBand \
+  ( UpperOrLower uplo, \
+    AbstractDistMatrix<F>& A, \
+    AbstractDistMatrix<F>& householderScalars, \
+    AbstractDistMatrix<Base<F>>& signature, \
+    Int bandwidth ); \
+  template void herm_tridiag::ApplyBandQ \
+  ( const AbstractDistMatrix<F>& A, \
+    const AbstractDistMatrix<F>& householderScalars, \
+    const AbstractDistMatrix<Base<F>>& signature, \
+    Int bandwidth, \
+          AbstractDistMatrix<F>& B ); \
+  template void herm_tridiag::BandToTridiag \
+  ( Int bandwidth, \
+    const Matrix<F>& band, \
+          Matrix<Base<F>>& d, \
+          Matrix<Base<F>>& e ); \
+  template void herm_tridiag::BandToTridiag \
+  ( Int bandwidth, \
+    const Matrix<F>& band, \
+          Matrix<Base<F>>& d, \
+          Matrix<Base<F>>& e, \
+          Matrix<F>& Q );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
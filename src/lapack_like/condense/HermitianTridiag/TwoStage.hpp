@@ -0,0 +1,328 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HERMITIANTRIDIAG_TWOSTAGE_HPP
+#define EL_HERMITIANTRIDIAG_TWOSTAGE_HPP
+
+namespace El {
+namespace herm_tridiag {
+
+// Two-stage reduction to tridiagonal form
+// =======================================
+// The one-stage reduction performs half of its work in Symv, which is
+// memory-bound and requires a reduction over the process grid for each
+// column. The two-stage approach, e.g., as described in
+//
+//   C. Bischof, B. Lang, and X. Sun,
+//   "A framework for symmetric band reduction",
+//   ACM Trans. Math. Software, Vol. 26, No. 4, pp. 581--601, 2000,
+//
+// and
+//
+//   A. Haidar, H. Ltaief, and J. Dongarra,
+//   "Parallel reduction to condensed forms for symmetric eigenvalue problems
+//    using aggregated fine-grained and memory-aware kernels",
+//   Proc. SC11, 2011,
+//
+// instead first reduces A to a band matrix using QR factorizations of
+// the panels below the band followed by two-sided, Gemm-based updates of
+// the trailing matrix, and then reduces the band to tridiagonal form by
+// chasing bulges, which only requires O(n^2 bandwidth) work.
+
+// On exit, the lower band of A (including the diagonal) holds the band
+// matrix B = Q1^H A Q1, and the Householder vectors defining Q1 are stored
+// below the band in the same manner as in a QR factorization of each panel.
+template<typename F>
+void ReduceToBand
+( UpperOrLower uplo,
+  AbstractDistMatrix<F>& APre,
+  AbstractDistMatrix<F>& householderScalarsPre,
+  AbstractDistMatrix<Base<F>>& signaturePre,
+  Int bandwidth )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      AssertSameGrids( APre, householderScalarsPre, signaturePre );
+      if( APre.Height() != APre.Width() )
+          LogicError("A must be square");
+      if( bandwidth < 1 )
+          LogicError("The bandwidth must be positive");
+    )
+    typedef Base<F> Real;
+    const Int n = APre.Height();
+    const Grid& g = APre.Grid();
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<F,F,STAR,STAR>
+      householderScalarsProx( householderScalarsPre );
+    DistMatrixWriteProxy<Real,Real,STAR,STAR> signatureProx( signaturePre );
+    auto& A = AProx.Get();
+    auto& householderScalars = householderScalarsProx.Get();
+    auto& signature = signatureProx.Get();
+
+    // The two-sided updates act upon full Hermitian matrices
+    MakeHermitian( uplo, A );
+
+    Zeros( householderScalars, n, 1 );
+    Ones( signature, n, 1 );
+
+    DistMatrix<F,STAR,STAR> householderScalars1(g);
+    DistMatrix<Real,STAR,STAR> signature1(g);
+    for( Int k=0; k+bandwidth<n-1; k+=bandwidth )
+    {
+        const Int minDim = Min(n-k-bandwidth,bandwidth);
+        const Range<Int> ind1( k, k+minDim ),
+                         indB( k+bandwidth, n ),
+                         indPan( k, k+bandwidth );
+
+        auto APan = A( indB, indPan );
+        auto A22 = A( indB, indB );
+
+        QR( APan, householderScalars1, signature1 );
+        qr::ApplyQ( LEFT, ADJOINT, APan, householderScalars1, signature1, A22 );
+        qr::ApplyQ( RIGHT, NORMAL, APan, householderScalars1, signature1, A22 );
+
+        auto t1 = householderScalars( ind1, ALL );
+        auto d1 = signature( ind1, ALL );
+        t1 = householderScalars1;
+        d1 = signature1;
+    }
+}
+
+// Overwrite B with Q1 B, where Q1 is the unitary matrix from ReduceToBand
+template<typename F>
+void ApplyBandQ
+( const AbstractDistMatrix<F>& APre,
+  const AbstractDistMatrix<F>& householderScalarsPre,
+  const AbstractDistMatrix<Base<F>>& signaturePre,
+  Int bandwidth,
+        AbstractDistMatrix<F>& BPre )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      AssertSameGrids( APre, householderScalarsPre, signaturePre, BPre );
+      if( APre.Height() != BPre.Height() )
+          LogicError("A and B must be the same height");
+    )
+    typedef Base<F> Real;
+    const Int n = APre.Height();
+
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixReadProxy<F,F,STAR,STAR>
+      householderScalarsProx( householderScalarsPre );
+    DistMatrixReadProxy<Real,Real,STAR,STAR> signatureProx( signaturePre );
+    DistMatrixReadWriteProxy<F,F,MC,MR> BProx( BPre );
+    auto& A = AProx.GetLocked();
+    auto& householderScalars = householderScalarsProx.GetLocked();
+    auto& signature = signatureProx.GetLocked();
+    auto& B = BProx.Get();
+
+    // Apply the panel transformations in the reverse order of their creation
+    const Int numPanels =
+      ( n-2-bandwidth >= 0 ? (n-2-bandwidth)/bandwidth + 1 : 0 );
+    for( Int panel=numPanels-1; panel>=0; --panel )
+    {
+        const Int k = panel*bandwidth;
+        const Int minDim = Min(n-k-bandwidth,bandwidth);
+        const Range<Int> ind1( k, k+minDim ),
+                         indB( k+bandwidth, n ),
+                         indPan( k, k+bandwidth );
+
+        auto APan = A( indB, indPan );
+        auto BB = B( indB, ALL );
+        auto t1 = householderScalars( ind1, ALL );
+        auto d1 = signature( ind1, ALL );
+        qr::ApplyQ( LEFT, NORMAL, APan, t1, d1, BB );
+    }
+}
+
+namespace band_to_tridiag {
+
+// Apply a single step of the bulge chase to the lower band of a Hermitian
+// matrix stored so that B(i-j,j) = A(i,j), with room for 2*bandwidth
+// subdiagonals. The entries of column c in rows r0+1:r1 are annihilated
+// with a reflector H acting upon rows/columns r0:r1 via A := H A H^H, which
+// introduces a bulge in rows r1+1:r1+bandwidth. The accumulated unitary
+// matrix, whose rows are stored in Q, is updated as Q := Q H^H.
+template<typename F>
+void Step
+( Matrix<F>& B, Int bandwidth, Int c, Int r0, Int r1,
+  vector<F>& v, Matrix<F>& D, Matrix<F>* Q, vector<F>& work )
+{
+    const Int n = B.Width();
+    const Int len = r1 - r0 + 1;
+    auto entry = [&]( Int i, Int j ) -> F& { return B(i-j,j); };
+
+    // Form the reflector which annihilates A(r0+1:r1,c)
+    v.resize( len );
+    for( Int l=0; l<len; ++l )
+        v[l] = entry(r0+l,c);
+    F chi = v[0];
+    const F tau = lapack::Reflector( len, chi, &v[1], 1 );
+    v[0] = F(1);
+    entry(r0,c) = chi;
+    for( Int l=1; l<len; ++l )
+        entry(r0+l,c) = F(0);
+
+    // Apply H from the left to the columns strictly between c and r0
+    for( Int j=c+1; j<r0; ++j )
+    {
+        F gamma = 0;
+        for( Int l=0; l<len; ++l )
+            gamma += Conj(v[l])*entry(r0+l,j);
+        gamma *= tau;
+        for( Int l=0; l<len; ++l )
+            entry(r0+l,j) -= v[l]*gamma;
+    }
+
+    // Apply H from both sides to the diagonal block
+    D.Resize( len, len );
+    for( Int j=0; j<len; ++j )
+    {
+        D(j,j) = entry(r0+j,r0+j);
+        for( Int i=j+1; i<len; ++i )
+        {
+            D(i,j) = entry(r0+i,r0+j);
+            D(j,i) = Conj(D(i,j));
+        }
+    }
+    for( Int j=0; j<len; ++j )
+    {
+        F gamma = 0;
+        for( Int l=0; l<len; ++l )
+            gamma += Conj(v[l])*D(l,j);
+        gamma *= tau;
+        for( Int l=0; l<len; ++l )
+            D(l,j) -= v[l]*gamma;
+    }
+    for( Int i=0; i<len; ++i )
+    {
+        F gamma = 0;
+        for( Int l=0; l<len; ++l )
+            gamma += D(i,l)*v[l];
+        gamma *= Conj(tau);
+        for( Int l=0; l<len; ++l )
+            D(i,l) -= gamma*Conj(v[l]);
+    }
+    for( Int j=0; j<len; ++j )
+        for( Int i=j; i<len; ++i )
+            entry(r0+i,r0+j) = D(i,j);
+
+    // Apply H^H from the right to the rows below the diagonal block
+    const Int rowEnd = Min(r1+bandwidth+1,n);
+    for( Int i=r1+1; i<rowEnd; ++i )
+    {
+        F gamma = 0;
+        for( Int l=0; l<len; ++l )
+            gamma += entry(i,r0+l)*v[l];
+        gamma *= Conj(tau);
+        for( Int l=0; l<len; ++l )
+            entry(i,r0+l) -= gamma*Conj(v[l]);
+    }
+
+    if( Q != nullptr )
+    {
+        const Int QHeight = Q->Height();
+        work.resize( QHeight );
+        blas::Gemv
+        ( 'N', QHeight, len,
+          F(1), Q->Buffer(0,r0), Q->LDim(), v.data(), 1,
+          F(0), work.data(), 1 );
+        blas::Ger
+        ( QHeight, len,
+          -Conj(tau), work.data(), 1, v.data(), 1,
+          Q->Buffer(0,r0), Q->LDim() );
+    }
+}
+
+template<typename F>
+void Reduce
+( Int bandwidth,
+  const Matrix<F>& band,
+        Matrix<Base<F>>& d,
+        Matrix<Base<F>>& e,
+        Matrix<F>* Q )
+{
+    EL_DEBUG_CSE
+    const Int n = band.Width();
+    EL_DEBUG_ONLY(
+      if( band.Height() != bandwidth+1 )
+          LogicError("The band should have bandwidth+1 rows");
+      if( Q != nullptr && Q->Width() != n )
+          LogicError("Q should have ",n," columns");
+    )
+
+    // Leave room for the bulges, which extend up to 2*bandwidth-1
+    // subdiagonals below the main diagonal
+    Matrix<F> B;
+    Zeros( B, 2*bandwidth+1, n );
+    auto BTop = B( IR(0,bandwidth+1), ALL );
+    BTop = band;
+
+    vector<F> v, work;
+    Matrix<F> D;
+    for( Int j=0; j<n-1; ++j )
+    {
+        // Annihilate the subdiagonals of column j (so that the subdiagonal
+        // entry is real) and then chase the resulting bulge off of the end
+        Int c = j;
+        Int r0 = j+1;
+        while( r0 < n )
+        {
+            const Int r1 = Min(r0+bandwidth-1,n-1);
+            if( c != j && r1 == r0 )
+                break;
+            Step( B, bandwidth, c, r0, r1, v, D, Q, work );
+            c = r0;
+            r0 += bandwidth;
+        }
+    }
+
+    d.Resize( n, 1 );
+    e.Resize( Max(n-1,0), 1 );
+    for( Int j=0; j<n; ++j )
+        d(j) = RealPart(B(0,j));
+    for( Int j=0; j<n-1; ++j )
+        e(j) = RealPart(B(1,j));
+}
+
+} // namespace band_to_tridiag
+
+// Reduce the Hermitian band matrix stored in 'band', such that
+// band(i-j,j) = A(i,j) for 0 <= i-j <= bandwidth, to real symmetric
+// tridiagonal form.
+template<typename F>
+void BandToTridiag
+( Int bandwidth,
+  const Matrix<F>& band,
+        Matrix<Base<F>>& d,
+        Matrix<Base<F>>& e )
+{
+    EL_DEBUG_CSE
+    band_to_tridiag::Reduce<F>( bandwidth, band, d, e, nullptr );
+}
+
+// Also overwrite Q with Q Q2, where A = Q2 T Q2^H. Since the update only
+// mixes the columns of Q, Q may hold an arbitrary subset of the rows of a
+// distributed matrix (e.g., the local rows of a [VC,* ] matrix).
+template<typename F>
+void BandToTridiag
+( Int bandwidth,
+  const Matrix<F>& band,
+        Matrix<Base<F>>& d,
+        Matrix<Base<F>>& e,
+        Matrix<F>& Q )
+{
+    EL_DEBUG_CSE
+    band_to_tridiag::Reduce( bandwidth, band, d, e, &Q );
+}
+
+} // namespace herm_tridiag
+} // namespace El
+
+#endif // ifndef EL_HERMITIANTRIDIAG_TWOSTAGE_HPP
@@ -43,7 +43,8 @@ void Overwrite
 ( Orientation orientation,
         AbstractDistMatrix<F>& APre,
   const AbstractDistMatrix<F>& B,
-        AbstractDistMatrix<F>& X )
+        AbstractDistMatrix<F>& X,
+  const QRCtrl<Base<F>>& qrCtrl )
 {
     EL_DEBUG_CSE
 
@@ -57,7 +58,7 @@ void Overwrite
     const Int n = A.Width();
     if( m >= n )
     {
-        QR( A, phase, signature );
+        QR( A, phase, signature, qrCtrl );
         qr::SolveAfter( orientation, A, phase, signature, B, X );
     }
     else
@@ -86,11 +87,12 @@ void LeastSquares
 ( Orientation orientation,
   const AbstractDistMatrix<F>& A,
   const AbstractDistMatrix<F>& B,
-        AbstractDistMatrix<F>& X )
+        AbstractDistMatrix<F>& X,
+  const QRCtrl<Base<F>>& qrCtrl )
 {
     EL_DEBUG_CSE
     DistMatrix<F> ACopy( A );
-    ls::Overwrite( orientation, ACopy, B, X );
+    ls::Overwrite( orientation, ACopy, B, X, qrCtrl );
 }
 
 // The following routines solve either
@@ -498,7 +500,8 @@ void LeastSquares
   ( Orientation orientation, \
           AbstractDistMatrix<F>& A, \
     const AbstractDistMatrix<F>& B, \
-          AbstractDistMatrix<F>& X ); \
+          AbstractDistMatrix<F>& X, \
+    const QRCtrl<Base<F>>& qrCtrl ); \
   template void LeastSquares \
   ( Orientation orientation, \
     const Matrix<F>& A, \
@@ -508,7 +511,8 @@ void LeastSquares
   ( Orientation orientation, \
     const AbstractDistMatrix<F>& A, \
     const AbstractDistMatrix<F>& B, \
-          AbstractDistMatrix<F>& X ); \
+          AbstractDistMatrix<F>& X, \
+    const QRCtrl<Base<F>>& qrCtrl ); \
   template void LeastSquares \
   ( Orientation orientation, \
     const SparseMatrix<F>& A, \
@@ -0,0 +1,143 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#include "../../blas_like/level3/Batched/Util.hpp"
+#include "./Batched/Cholesky.hpp"
+#include "./Batched/LU.hpp"
+
+namespace El {
+
+template<typename Field>
+void BatchedCholesky( UpperOrLower uplo, vector<Matrix<Field>>& A )
+{
+    EL_DEBUG_CSE
+    const Int batchSize = A.size();
+    for( Int b=0; b<batchSize; ++b )
+        if( A[b].Height() != A[b].Width() )
+            LogicError("Problem ",b," of the batch was not square");
+
+    // The upper-triangular case is handled by factoring the adjoints
+    const Orientation orientation = ( uplo == LOWER ? NORMAL : ADJOINT );
+    const Int W = batched::INTERLEAVE_WIDTH;
+    const Int numGroups = (batchSize+W-1)/W;
+    vector<Int> failed( batchSize, 0 );
+    vector<std::exception_ptr> errors( batchSize );
+    EL_PARALLEL_FOR
+    for( Int group=0; group<numGroups; ++group )
+    {
+        const Int offset = group*W;
+        const Int numLanes = Min(W,batchSize-offset);
+        if( batched::Interleavable( A, offset, numLanes ) )
+        {
+            const Int n = A[offset].Height();
+            vector<Field> buf;
+            Int groupFailed[batched::INTERLEAVE_WIDTH] = { 0 };
+            batched::Interleave
+            ( orientation, A, offset, numLanes, buf, Field(1) );
+            batched::InterleavedCholesky( n, buf, groupFailed );
+            batched::Deinterleave( orientation, buf, A, offset, numLanes );
+            for( Int l=0; l<numLanes; ++l )
+                failed[offset+l] = groupFailed[l];
+        }
+        else
+        {
+            for( Int b=offset; b<offset+numLanes; ++b )
+            {
+                try { Cholesky( uplo, A[b] ); }
+                catch( const NonHPDMatrixException& ) { failed[b] = 1; }
+                catch( ... ) { errors[b] = std::current_exception(); }
+            }
+        }
+    }
+    batched::RethrowErrors( errors );
+    batched::ReportFailures<NonHPDMatrixException>( failed, "were not HPD" );
+}
+
+template<typename Field>
+void BatchedCholesky( UpperOrLower uplo, Matrix<Field>& A, Int batchSize )
+{
+    EL_DEBUG_CSE
+    auto AViews = batched::StridedViews( A, batchSize );
+    BatchedCholesky( uplo, AViews );
+}
+
+template<typename Field>
+void BatchedLU( vector<Matrix<Field>>& A, vector<Permutation>& P )
+{
+    EL_DEBUG_CSE
+    const Int batchSize = A.size();
+    P.resize( batchSize );
+
+    const Int W = batched::INTERLEAVE_WIDTH;
+    const Int numGroups = (batchSize+W-1)/W;
+    vector<Int> failed( batchSize, 0 );
+    vector<std::exception_ptr> errors( batchSize );
+    EL_PARALLEL_FOR
+    for( Int group=0; group<numGroups; ++group )
+    {
+        const Int offset = group*W;
+        const Int numLanes = Min(W,batchSize-offset);
+        if( batched::Interleavable( A, offset, numLanes ) )
+        {
+            const Int m = A[offset].Height();
+            const Int n = A[offset].Width();
+            vector<Field> buf;
+            vector<Int> pivots;
+            Int groupFailed[batched::INTERLEAVE_WIDTH] = { 0 };
+            batched::Interleave( NORMAL, A, offset, numLanes, buf, Field(1) );
+            batched::InterleavedLU( m, n, buf, pivots, groupFailed );
+            batched::Deinterleave( NORMAL, buf, A, offset, numLanes );
+            for( Int l=0; l<numLanes; ++l )
+            {
+                batched::InterleavedPivotsToPermutation
+                ( m, pivots, l, P[offset+l] );
+                failed[offset+l] = groupFailed[l];
+            }
+        }
+        else
+        {
+            for( Int b=offset; b<offset+numLanes; ++b )
+            {
+                try { LU( A[b], P[b] ); }
+                catch( const SingularMatrixException& ) { failed[b] = 1; }
+                catch( ... ) { errors[b] = std::current_exception(); }
+            }
+        }
+    }
+    batched::RethrowErrors( errors );
+    batched::ReportFailures<SingularMatrixException>( failed, "were singular" );
+}
+
+template<typename Field>
+void BatchedLU( Matrix<Field>& A, vector<Permutation>& P, Int batchSize )
+{
+    EL_DEBUG_CSE
+    auto AViews = batched::StridedViews( A, batchSize );
+    BatchedLU( AViews, P );
+}
+
+#define PROTO(Field) \
+  template void BatchedCholesky \
+  ( UpperOrLower uplo, vector<Matrix<Field>>& A ); \
+  template void BatchedCholesky \
+  ( UpperOrLower uplo, Matrix<Field>& A, Int batchSize ); \
+  template void BatchedLU \
+  ( vector<Matrix<Field>>& A, vector<Permutation>& P ); \
+  template void BatchedLU \
+  ( Matrix<Field>& A, vector<Permutation>& P, Int batchSize );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -0,0 +1,61 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BATCHED_CHOLESKY_HPP
+#define EL_BATCHED_CHOLESKY_HPP
+
+namespace El {
+namespace batched {
+
+// Overwrite the lower triangles of the interleaved n x n matrices in A with
+// their Cholesky factors, setting failed[l]=1 for each lane which was not
+// HPD (whose factor is then meaningless)
+template<typename Field>
+void InterleavedCholesky( Int n, vector<Field>& A, Int* failed )
+{
+    typedef Base<Field> Real;
+    const Int W = INTERLEAVE_WIDTH;
+    for( Int k=0; k<n; ++k )
+    {
+        Field* alpha11 = &A[(k+k*n)*W];
+        for( Int l=0; l<W; ++l )
+        {
+            Real delta = RealPart(alpha11[l]);
+            if( !(delta > Real(0)) )
+            {
+                failed[l] = 1;
+                delta = Real(1);
+            }
+            alpha11[l] = Sqrt(delta);
+        }
+        for( Int i=k+1; i<n; ++i )
+        {
+            Field* alpha21 = &A[(i+k*n)*W];
+            EL_SIMD
+            for( Int l=0; l<W; ++l )
+                alpha21[l] /= alpha11[l];
+        }
+        for( Int j=k+1; j<n; ++j )
+        {
+            const Field* alpha_jk = &A[(j+k*n)*W];
+            for( Int i=j; i<n; ++i )
+            {
+                const Field* alpha_ik = &A[(i+k*n)*W];
+                Field* alpha_ij = &A[(i+j*n)*W];
+                EL_SIMD
+                for( Int l=0; l<W; ++l )
+                    alpha_ij[l] -= alpha_ik[l]*Conj(alpha_jk[l]);
+            }
+        }
+    }
+}
+
+} // namespace batched
+} // namespace El
+
+#endif // ifndef EL_BATCHED_CHOLESKY_HPP
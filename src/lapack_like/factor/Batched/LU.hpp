@@ -0,0 +1,96 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BATCHED_LU_HPP
+#define EL_BATCHED_LU_HPP
+
+namespace El {
+namespace batched {
+
+// Overwrite the interleaved m x n matrices in A with their partially-pivoted
+// LU factorizations, where pivots[k*INTERLEAVE_WIDTH+l] is the row swapped
+// with row k of lane l, and failed[l]=1 for each lane with a zero pivot
+template<typename Field>
+void InterleavedLU
+( Int m, Int n, vector<Field>& A, vector<Int>& pivots, Int* failed )
+{
+    typedef Base<Field> Real;
+    const Int W = INTERLEAVE_WIDTH;
+    const Int minDim = Min(m,n);
+    pivots.resize( minDim*W );
+    Field alpha11Inv[INTERLEAVE_WIDTH];
+    for( Int k=0; k<minDim; ++k )
+    {
+        // Choose and apply the pivot of each lane (measuring magnitudes as in
+        // the BLAS i?amax routines)
+        for( Int l=0; l<W; ++l )
+        {
+            Int iPiv = k;
+            Real maxAbs = OneAbs(A[(k+k*m)*W+l]);
+            for( Int i=k+1; i<m; ++i )
+            {
+                const Real absVal = OneAbs(A[(i+k*m)*W+l]);
+                if( absVal > maxAbs )
+                {
+                    iPiv = i;
+                    maxAbs = absVal;
+                }
+            }
+            pivots[k*W+l] = iPiv;
+            if( iPiv != k )
+                for( Int j=0; j<n; ++j )
+                    std::swap( A[(k+j*m)*W+l], A[(iPiv+j*m)*W+l] );
+
+            const Field alpha11 = A[(k+k*m)*W+l];
+            if( alpha11 == Field(0) )
+            {
+                failed[l] = 1;
+                alpha11Inv[l] = Field(0);
+            }
+            else
+                alpha11Inv[l] = Field(1)/alpha11;
+        }
+
+        for( Int i=k+1; i<m; ++i )
+        {
+            Field* alpha21 = &A[(i+k*m)*W];
+            EL_SIMD
+            for( Int l=0; l<W; ++l )
+                alpha21[l] *= alpha11Inv[l];
+        }
+        for( Int j=k+1; j<n; ++j )
+        {
+            const Field* alpha12 = &A[(k+j*m)*W];
+            for( Int i=k+1; i<m; ++i )
+            {
+                const Field* alpha21 = &A[(i+k*m)*W];
+                Field* alpha22 = &A[(i+j*m)*W];
+                EL_SIMD
+                for( Int l=0; l<W; ++l )
+                    alpha22[l] -= alpha21[l]*alpha12[l];
+            }
+        }
+    }
+}
+
+// Form the permutation of the given lane from the pivots of InterleavedLU
+inline void InterleavedPivotsToPermutation
+( Int m, const vector<Int>& pivots, Int lane, Permutation& P )
+{
+    const Int W = INTERLEAVE_WIDTH;
+    const Int minDim = pivots.size()/W;
+    P.MakeIdentity( m );
+    P.ReserveSwaps( minDim );
+    for( Int k=0; k<minDim; ++k )
+        P.Swap( k, pivots[k*W+lane] );
+}
+
+} // namespace batched
+} // namespace El
+
+#endif // ifndef EL_BATCHED_LU_HPP
@@ -31,7 +31,15 @@ void Cholesky( UpperOrLower uplo, Matrix<F>& A )
       if( A.Height() != A.Width() )
           LogicError("A must be square");
     )
-    if( uplo == LOWER )
+    // Scalars without BLAS support are factored recursively
+    if( !IsBlasScalar<F>::value )
+    {
+        if( uplo == LOWER )
+            cholesky::LowerVariant3Recursive( A );
+        else
+            cholesky::UpperVariant3Recursive( A );
+    }
+    else if( uplo == LOWER )
         cholesky::LowerVariant3Blocked( A );
     else
         cholesky::UpperVariant3Blocked( A );
@@ -92,24 +100,35 @@ void ScaLAPACKHelper( UpperOrLower uplo, AbstractDistMatrix<F>& A )
 
 } // anonymous namespace
 
-template<typename F> 
+template<typename F>
 void Cholesky( UpperOrLower uplo, AbstractDistMatrix<F>& A, bool scalapack )
 {
     EL_DEBUG_CSE
-    if( scalapack )
+    CholeskyCtrl ctrl;
+    ctrl.scalapack = scalapack;
+    Cholesky( uplo, A, ctrl );
+}
+
+template<typename F>
+void Cholesky
+( UpperOrLower uplo, AbstractDistMatrix<F>& A, const CholeskyCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    BlocksizeScope blocksizeScope( TunedBlocksize<F>( "Cholesky", A.Grid() ) );
+    if( ctrl.scalapack )
     {
         cholesky::ScaLAPACKHelper( uplo, A );
     }
     else
     {
         if( uplo == LOWER )
-            cholesky::LowerVariant3Blocked( A );
+            cholesky::LowerVariant3Blocked( A, ctrl.lookahead );
         else
-            cholesky::UpperVariant3Blocked( A );
+            cholesky::UpperVariant3Blocked( A, ctrl.lookahead );
     }
 }
 
-template<typename F> 
+template<typename F>
 void Cholesky
 ( UpperOrLower uplo, AbstractDistMatrix<F>& A, DistPermutation& p )
 {
@@ -207,6 +226,9 @@ void HPSDCholesky( UpperOrLower uplo, AbstractDistMatrix<F>& APre )
   template void Cholesky( UpperOrLower uplo, Matrix<F>& A ); \
   template void Cholesky \
   ( UpperOrLower uplo, AbstractDistMatrix<F>& A, bool scalapack ); \
+  template void Cholesky \
+  ( UpperOrLower uplo, AbstractDistMatrix<F>& A, \
+    const CholeskyCtrl& ctrl ); \
   template void Cholesky( UpperOrLower uplo, DistMatrix<F,STAR,STAR>& A ); \
   template void ReverseCholesky( UpperOrLower uplo, Matrix<F>& A ); \
   template void ReverseCholesky \
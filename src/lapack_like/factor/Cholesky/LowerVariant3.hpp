@@ -40,6 +40,35 @@ void LowerVariant3Unblocked( Matrix<F>& A )
     }
 }
 
+// A recursive (cache-oblivious) alternative to the blocked algorithm which
+// casts nearly all of the work into Trsm and Herk, at every scale
+template<typename F>
+void LowerVariant3Recursive( Matrix<F>& A )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("Can only compute Cholesky factor of square matrices");
+    )
+    const Int n = A.Height();
+    if( n <= 16 )
+    {
+        cholesky::LowerVariant3Unblocked( A );
+        return;
+    }
+    const Int n1 = n/2;
+    const Range<Int> ind1( 0, n1 ), ind2( n1, n );
+
+    auto A11 = A( ind1, ind1 );
+    auto A21 = A( ind2, ind1 );
+    auto A22 = A( ind2, ind2 );
+
+    cholesky::LowerVariant3Recursive( A11 );
+    Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), A11, A21 );
+    Herk( LOWER, NORMAL, Base<F>(-1), A21, Base<F>(1), A22 );
+    cholesky::LowerVariant3Recursive( A22 );
+}
+
 template<typename F>
 void LowerVariant3Blocked( Matrix<F>& A )
 {
@@ -68,7 +97,7 @@ void LowerVariant3Blocked( Matrix<F>& A )
 }
 
 template<typename F>
-void LowerVariant3Blocked( AbstractDistMatrix<F>& APre )
+void LowerVariant3Blocked( AbstractDistMatrix<F>& APre, Int lookahead=0 )
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
@@ -83,45 +112,151 @@ void LowerVariant3Blocked( AbstractDistMatrix<F>& APre )
     DistMatrix<F,STAR,STAR> A11_STAR_STAR(grid);
     DistMatrix<F,VC,  STAR> A21_VC_STAR(grid);
     DistMatrix<F,VR,  STAR> A21_VR_STAR(grid);
-    DistMatrix<F,STAR,MC  > A21Trans_STAR_MC(grid);
-    DistMatrix<F,STAR,MR  > A21Adj_STAR_MR(grid);
+    DistMatrix<F,MC,  STAR> A21_MC_STAR(grid);
+    DistMatrix<F,MR,  STAR> A21_MR_STAR(grid);
+    copy::PendingAllGather<F> gatherTrans, gatherAdj;
+
+    // With lookahead, the next panel is factored while the current panel is
+    // still needed for the remainder of the trailing update, and so two sets
+    // of panel redistributions are alternated between
+    DistMatrix<F,STAR,MC  > A21Trans_STAR_MC(grid), A21NextTrans_STAR_MC(grid);
+    DistMatrix<F,STAR,MR  > A21Adj_STAR_MR(grid), A21NextAdj_STAR_MR(grid);
+    auto* panelTrans = &A21Trans_STAR_MC;
+    auto* panelAdj = &A21Adj_STAR_MR;
+    auto* nextPanelTrans = &A21NextTrans_STAR_MC;
+    auto* nextPanelAdj = &A21NextAdj_STAR_MR;
 
     const Int n = A.Height();
     const Int bsize = Blocksize();
-    for( Int k=0; k<n; k+=bsize )
-    {
-        const Int nb = Min(bsize,n-k);
+    auto factorPanel =
+      [&]( Int k )
+      {
+          const Int nb = Min(bsize,n-k);
 
-        const Range<Int> ind1( k,    k+nb ),
-                         ind2( k+nb, n    );
+          const Range<Int> ind1( k,    k+nb ),
+                           ind2( k+nb, n    );
 
-        auto A11 = A( ind1, ind1 );
-        auto A21 = A( ind2, ind1 );
-        auto A22 = A( ind2, ind2 );
+          auto A11 = A( ind1, ind1 );
+          auto A21 = A( ind2, ind1 );
+          auto A22 = A( ind2, ind2 );
+
+          A11_STAR_STAR = A11;
+          Cholesky( LOWER, A11_STAR_STAR );
+          A11 = A11_STAR_STAR;
+
+          A21_VC_STAR.AlignWith( A22 );
+          A21_VC_STAR = A21;
+          LocalTrsm
+          ( RIGHT, LOWER, ADJOINT, NON_UNIT,
+            F(1), A11_STAR_STAR, A21_VC_STAR );
+
+          A21_VR_STAR.AlignWith( A22 );
+          A21_VR_STAR = A21_VC_STAR;
+      };
+    auto redistributePanel =
+      [&]( Int k,
+           DistMatrix<F,STAR,MC>& APanTrans_STAR_MC,
+           DistMatrix<F,STAR,MR>& APanAdj_STAR_MR )
+      {
+          const Int nb = Min(bsize,n-k);
+          auto A21 = A( IR(k+nb,n), IR(k,k+nb) );
+          auto A22 = A( IR(k+nb,n), IR(k+nb,n) );
+
+          APanTrans_STAR_MC.AlignWith( A22 );
+          APanAdj_STAR_MR.AlignWith( A22 );
+          Transpose( A21_VC_STAR, APanTrans_STAR_MC );
+          Adjoint( A21_VR_STAR, APanAdj_STAR_MR );
 
-        A11_STAR_STAR = A11;
-        Cholesky( LOWER, A11_STAR_STAR );
-        A11 = A11_STAR_STAR;
+          Transpose( APanTrans_STAR_MC, A21 );
+      };
+    // The non-blocking equivalent of redistributePanel
+    auto startPanel =
+      [&]()
+      {
+          copy::StartPartialColAllGather( A21_VC_STAR, gatherTrans );
+          copy::StartPartialColAllGather( A21_VR_STAR, gatherAdj );
+      };
+    auto finishPanel =
+      [&]( Int k,
+           DistMatrix<F,STAR,MC>& APanTrans_STAR_MC,
+           DistMatrix<F,STAR,MR>& APanAdj_STAR_MR )
+      {
+          const Int nb = Min(bsize,n-k);
+          auto A21 = A( IR(k+nb,n), IR(k,k+nb) );
+          auto A22 = A( IR(k+nb,n), IR(k+nb,n) );
 
-        A21_VC_STAR.AlignWith( A22 );
-        A21_VC_STAR = A21;
-        LocalTrsm
-        ( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), A11_STAR_STAR, A21_VC_STAR );
+          A21_MC_STAR.AlignWith( A22 );
+          A21_MR_STAR.AlignWith( A22 );
+          copy::FinishPartialColAllGather
+          ( A21_VC_STAR, gatherTrans, A21_MC_STAR );
+          copy::FinishPartialColAllGather
+          ( A21_VR_STAR, gatherAdj, A21_MR_STAR );
+          APanTrans_STAR_MC.AlignWith( A22 );
+          APanAdj_STAR_MR.AlignWith( A22 );
+          Transpose( A21_MC_STAR, APanTrans_STAR_MC );
+          Adjoint( A21_MR_STAR, APanAdj_STAR_MR );
 
-        A21_VR_STAR.AlignWith( A22 );
-        A21_VR_STAR = A21_VC_STAR;
-        A21Trans_STAR_MC.AlignWith( A22 );
-        A21Adj_STAR_MR.AlignWith( A22 );
-        Transpose( A21_VC_STAR, A21Trans_STAR_MC );
-        Adjoint( A21_VR_STAR, A21Adj_STAR_MR );
+          A21 = A21_MC_STAR;
+      };
+
+    if( n > 0 )
+    {
+        factorPanel( 0 );
+        redistributePanel( 0, *panelTrans, *panelAdj );
+    }
+    for( Int k=0; k<n; k+=bsize )
+    {
+        const Int nb = Min(bsize,n-k);
+        const Int kNext = k+nb;
+
+        auto A22 = A( IR(kNext,n), IR(kNext,n) );
 
         // (A21^T[* ,MC])^T A21^H[* ,MR] = A21[MC,* ] A21^H[* ,MR]
         //                               = (A21 A21^H)[MC,MR]
-        LocalTrrk
-        ( LOWER, TRANSPOSE,
-          F(-1), A21Trans_STAR_MC, A21Adj_STAR_MR, F(1), A22 );
+        if( lookahead > 0 && kNext < n )
+        {
+            // Update the leading columns of the trailing matrix first so that
+            // the next panel can be factored, and its redistribution
+            // overlapped with the bulk of the trailing update
+            const Int lookaheadSize = Min( lookahead*bsize, n-kNext );
+            const Range<Int> indL( 0, lookaheadSize ),
+                             indR( lookaheadSize, n-kNext );
+
+            auto A22LL = A22( indL, indL );
+            auto A22RL = A22( indR, indL );
+            auto A22RR = A22( indR, indR );
+            auto A21LTrans_STAR_MC = (*panelTrans)( ALL, indL );
+            auto A21RTrans_STAR_MC = (*panelTrans)( ALL, indR );
+            auto A21LAdj_STAR_MR = (*panelAdj)( ALL, indL );
+            auto A21RAdj_STAR_MR = (*panelAdj)( ALL, indR );
+
+            LocalTrrk
+            ( LOWER, TRANSPOSE,
+              F(-1), A21LTrans_STAR_MC, A21LAdj_STAR_MR, F(1), A22LL );
+            LocalGemm
+            ( TRANSPOSE, NORMAL,
+              F(-1), A21RTrans_STAR_MC, A21LAdj_STAR_MR, F(1), A22RL );
+            factorPanel( kNext );
+            startPanel();
+            LocalTrrk
+            ( LOWER, TRANSPOSE,
+              F(-1), A21RTrans_STAR_MC, A21RAdj_STAR_MR, F(1), A22RR );
+            finishPanel( kNext, *nextPanelTrans, *nextPanelAdj );
 
-        Transpose( A21Trans_STAR_MC, A21 );
+            std::swap( panelTrans, nextPanelTrans );
+            std::swap( panelAdj, nextPanelAdj );
+        }
+        else
+        {
+            LocalTrrk
+            ( LOWER, TRANSPOSE,
+              F(-1), *panelTrans, *panelAdj, F(1), A22 );
+            if( kNext < n )
+            {
+                factorPanel( kNext );
+                redistributePanel( kNext, *panelTrans, *panelAdj );
+            }
+        }
     }
 }
 
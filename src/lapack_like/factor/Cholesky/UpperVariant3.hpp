@@ -45,6 +45,35 @@ void UpperVariant3Unblocked( Matrix<F>& A )
     }
 }
 
+// A recursive (cache-oblivious) alternative to the blocked algorithm which
+// casts nearly all of the work into Trsm and Herk, at every scale
+template<typename F>
+void UpperVariant3Recursive( Matrix<F>& A )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("Can only compute Cholesky factor of square matrices");
+    )
+    const Int n = A.Height();
+    if( n <= 16 )
+    {
+        cholesky::UpperVariant3Unblocked( A );
+        return;
+    }
+    const Int n1 = n/2;
+    const Range<Int> ind1( 0, n1 ), ind2( n1, n );
+
+    auto A11 = A( ind1, ind1 );
+    auto A12 = A( ind1, ind2 );
+    auto A22 = A( ind2, ind2 );
+
+    cholesky::UpperVariant3Recursive( A11 );
+    Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), A11, A12 );
+    Herk( UPPER, ADJOINT, Base<F>(-1), A12, Base<F>(1), A22 );
+    cholesky::UpperVariant3Recursive( A22 );
+}
+
 template<typename F>
 void UpperVariant3Blocked( Matrix<F>& A )
 {
@@ -73,7 +102,7 @@ void UpperVariant3Blocked( Matrix<F>& A )
 }
 
 template<typename F>
-void UpperVariant3Blocked( AbstractDistMatrix<F>& APre )
+void UpperVariant3Blocked( AbstractDistMatrix<F>& APre, Int lookahead=0 )
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
@@ -87,38 +116,146 @@ void UpperVariant3Blocked( AbstractDistMatrix<F>& APre )
 
     DistMatrix<F,STAR,STAR> A11_STAR_STAR(grid);
     DistMatrix<F,STAR,VR  > A12_STAR_VR(grid);
-    DistMatrix<F,STAR,MC  > A12_STAR_MC(grid);
-    DistMatrix<F,STAR,MR  > A12_STAR_MR(grid);
+    DistMatrix<F,STAR,VC  > A12_STAR_VC(grid);
+    copy::PendingAllGather<F> gather_STAR_MC, gather_STAR_MR;
+
+    // With lookahead, the next panel is factored while the current panel is
+    // still needed for the remainder of the trailing update, and so two sets
+    // of panel redistributions are alternated between
+    DistMatrix<F,STAR,MC  > A12_STAR_MC(grid), A12Next_STAR_MC(grid);
+    DistMatrix<F,STAR,MR  > A12_STAR_MR(grid), A12Next_STAR_MR(grid);
+    auto* panel_STAR_MC = &A12_STAR_MC;
+    auto* panel_STAR_MR = &A12_STAR_MR;
+    auto* nextPanel_STAR_MC = &A12Next_STAR_MC;
+    auto* nextPanel_STAR_MR = &A12Next_STAR_MR;
 
     const Int n = A.Height();
     const Int bsize = Blocksize();
+    auto factorPanel =
+      [&]( Int k )
+      {
+          const Int nb = Min(bsize,n-k);
+
+          const Range<Int> ind1( k,    k+nb ),
+                           ind2( k+nb, n    );
+
+          auto A11 = A( ind1, ind1 );
+          auto A12 = A( ind1, ind2 );
+          auto A22 = A( ind2, ind2 );
+
+          A11_STAR_STAR = A11;
+          Cholesky( UPPER, A11_STAR_STAR );
+          A11 = A11_STAR_STAR;
+
+          A12_STAR_VR.AlignWith( A22 );
+          A12_STAR_VR = A12;
+          LocalTrsm
+          ( LEFT, UPPER, ADJOINT, NON_UNIT,
+            F(1), A11_STAR_STAR, A12_STAR_VR );
+      };
+    auto redistributePanel =
+      [&]( Int k,
+           DistMatrix<F,STAR,MC>& APan_STAR_MC,
+           DistMatrix<F,STAR,MR>& APan_STAR_MR )
+      {
+          const Int nb = Min(bsize,n-k);
+          auto A12 = A( IR(k,k+nb), IR(k+nb,n) );
+          auto A22 = A( IR(k+nb,n), IR(k+nb,n) );
+
+          APan_STAR_MC.AlignWith( A22 );
+          APan_STAR_MC = A12_STAR_VR;
+          APan_STAR_MR.AlignWith( A22 );
+          APan_STAR_MR = A12_STAR_VR;
+
+          A12 = APan_STAR_MR;
+      };
+    // The non-blocking equivalent of redistributePanel
+    auto startPanel =
+      [&]( Int k )
+      {
+          const Int nb = Min(bsize,n-k);
+          auto A22 = A( IR(k+nb,n), IR(k+nb,n) );
+
+          A12_STAR_VC.AlignWith( A22 );
+          A12_STAR_VC = A12_STAR_VR;
+          copy::StartPartialRowAllGather( A12_STAR_VC, gather_STAR_MC );
+          copy::StartPartialRowAllGather( A12_STAR_VR, gather_STAR_MR );
+      };
+    auto finishPanel =
+      [&]( Int k,
+           DistMatrix<F,STAR,MC>& APan_STAR_MC,
+           DistMatrix<F,STAR,MR>& APan_STAR_MR )
+      {
+          const Int nb = Min(bsize,n-k);
+          auto A12 = A( IR(k,k+nb), IR(k+nb,n) );
+          auto A22 = A( IR(k+nb,n), IR(k+nb,n) );
+
+          APan_STAR_MC.AlignWith( A22 );
+          APan_STAR_MR.AlignWith( A22 );
+          copy::FinishPartialRowAllGather
+          ( A12_STAR_VC, gather_STAR_MC, APan_STAR_MC );
+          copy::FinishPartialRowAllGather
+          ( A12_STAR_VR, gather_STAR_MR, APan_STAR_MR );
+
+          A12 = APan_STAR_MR;
+      };
+
+    if( n > 0 )
+    {
+        factorPanel( 0 );
+        redistributePanel( 0, *panel_STAR_MC, *panel_STAR_MR );
+    }
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
+        const Int kNext = k+nb;
 
-        const Range<Int> ind1( k,    k+nb ),
-                         ind2( k+nb, n    );
+        auto A22 = A( IR(kNext,n), IR(kNext,n) );
 
-        auto A11 = A( ind1, ind1 );
-        auto A12 = A( ind1, ind2 );
-        auto A22 = A( ind2, ind2 );
+        if( lookahead > 0 && kNext < n )
+        {
+            // Update the leading rows of the trailing matrix first so that
+            // the next panel can be factored, and its redistribution
+            // overlapped with the bulk of the trailing update
+            const Int lookaheadSize = Min( lookahead*bsize, n-kNext );
+            const Range<Int> indT( 0, lookaheadSize ),
+                             indB( lookaheadSize, n-kNext );
+
+            auto A22TT = A22( indT, indT );
+            auto A22TB = A22( indT, indB );
+            auto A22BB = A22( indB, indB );
+            auto A12T_STAR_MC = (*panel_STAR_MC)( ALL, indT );
+            auto A12B_STAR_MC = (*panel_STAR_MC)( ALL, indB );
+            auto A12T_STAR_MR = (*panel_STAR_MR)( ALL, indT );
+            auto A12B_STAR_MR = (*panel_STAR_MR)( ALL, indB );
+
+            LocalTrrk
+            ( UPPER, ADJOINT,
+              F(-1), A12T_STAR_MC, A12T_STAR_MR, F(1), A22TT );
+            LocalGemm
+            ( ADJOINT, NORMAL,
+              F(-1), A12T_STAR_MC, A12B_STAR_MR, F(1), A22TB );
+            factorPanel( kNext );
+            startPanel( kNext );
+            LocalTrrk
+            ( UPPER, ADJOINT,
+              F(-1), A12B_STAR_MC, A12B_STAR_MR, F(1), A22BB );
+            finishPanel( kNext, *nextPanel_STAR_MC, *nextPanel_STAR_MR );
 
-        A11_STAR_STAR = A11;
-        Cholesky( UPPER, A11_STAR_STAR );
-        A11 = A11_STAR_STAR;
-
-        A12_STAR_VR.AlignWith( A22 );
-        A12_STAR_VR = A12;
-        LocalTrsm
-        ( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), A11_STAR_STAR, A12_STAR_VR );
-
-        A12_STAR_MC.AlignWith( A22 );
-        A12_STAR_MC = A12_STAR_VR;
-        A12_STAR_MR.AlignWith( A22 );
-        A12_STAR_MR = A12_STAR_VR;
-        LocalTrrk
-        ( UPPER, ADJOINT, F(-1), A12_STAR_MC, A12_STAR_MR, F(1), A22 );
-        A12 = A12_STAR_MR;
+            std::swap( panel_STAR_MC, nextPanel_STAR_MC );
+            std::swap( panel_STAR_MR, nextPanel_STAR_MR );
+        }
+        else
+        {
+            LocalTrrk
+            ( UPPER, ADJOINT,
+              F(-1), *panel_STAR_MC, *panel_STAR_MR, F(1), A22 );
+            if( kNext < n )
+            {
+                factorPanel( kNext );
+                redistributePanel( kNext, *panel_STAR_MC, *panel_STAR_MR );
+            }
+        }
     }
 }
 
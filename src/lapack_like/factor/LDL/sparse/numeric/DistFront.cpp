@@ -24,6 +24,8 @@
 */
 #include <El.hpp>
 
+#include "./ExtendAdd.hpp"
+
 namespace El {
 namespace ldl {
 
@@ -1339,20 +1341,16 @@ void DistFront<Field>::ComputeCommMeta
     const auto& FBR = childFront.work;
     const Int localHeight = FBR.LocalHeight();
     const Int localWidth = FBR.LocalWidth();
+    vector<int> rowOwners;
+    ChildUpdateRowOwners( L2D, FBR, childRelInds, rowOwners );
+    const Int colStride = L2D.ColStride();
     for( Int jChildLoc=0; jChildLoc<localWidth; ++jChildLoc )
     {
         const Int jChild = FBR.GlobalCol(jChildLoc);
-        const int j = childRelInds[jChild];
-        for( Int iChildLoc=0; iChildLoc<localHeight; ++iChildLoc )
-        {
-            const Int iChild = FBR.GlobalRow(iChildLoc);
-            if( iChild >= jChild )
-            {
-                const Int i = childRelInds[iChild];
-                const int q = L2D.Owner( i, j );
-                ++commMeta.numChildSendInds[q];
-            }
-        }
+        const int qOff = L2D.ColOwner( childRelInds[jChild] )*colStride;
+        const Int iChildOff = FBR.LocalRowOffset( jChild );
+        for( Int iChildLoc=iChildOff; iChildLoc<localHeight; ++iChildLoc )
+            ++commMeta.numChildSendInds[rowOwners[iChildLoc]+qOff];
     }
 
     // This is optional since it requires a nontrivial amount of storage.
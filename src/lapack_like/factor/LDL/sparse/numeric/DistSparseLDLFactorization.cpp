@@ -82,6 +82,8 @@ void DistSparseLDLFactorization<Field>::Initialize2DGridGraph
     ldl::NaturalNestedDissection
     ( gridDim0, gridDim1, 1, A.LockedDistGraph(),
       map_, *separator_, *info_, bisectCtrl.cutoff );
+    if( bisectCtrl.amalgamate )
+        ldl::Amalgamate( *separator_, *info_, bisectCtrl );
     InvertMap( map_, inverseMap_ );
     front_.reset
     ( new ldl::DistFront<Field>(A,map_,*separator_,*info_,hermitian) );
@@ -105,6 +107,8 @@ void DistSparseLDLFactorization<Field>::Initialize3DGridGraph
     ldl::NaturalNestedDissection
     ( gridDim0, gridDim1, gridDim2, A.LockedDistGraph(),
       map_, *separator_, *info_, bisectCtrl.cutoff );
+    if( bisectCtrl.amalgamate )
+        ldl::Amalgamate( *separator_, *info_, bisectCtrl );
     InvertMap( map_, inverseMap_ );
     front_.reset
     ( new ldl::DistFront<Field>(A,map_,*separator_,*info_,hermitian) );
@@ -114,7 +118,8 @@ void DistSparseLDLFactorization<Field>::Initialize3DGridGraph
 }
 
 template<typename Field>
-void DistSparseLDLFactorization<Field>::Factor( LDLFrontType frontType )
+void DistSparseLDLFactorization<Field>::Factor
+( LDLFrontType frontType, const ldl::TraversalCtrl& traversalCtrl )
 {
     EL_DEBUG_CSE
     if( !initialized_ )
@@ -128,7 +133,8 @@ void DistSparseLDLFactorization<Field>::Factor( LDLFrontType frontType )
     ChangeFrontType( SYMM_2D );
 
     // Perform the initial factorization
-    ldl::Process( *info_, *front_, InitialFactorType(frontType) );
+    ldl::Process
+    ( *info_, *front_, InitialFactorType(frontType), traversalCtrl );
     factored_ = true;
 
     // Convert the fronts from the initial factorization to the requested form
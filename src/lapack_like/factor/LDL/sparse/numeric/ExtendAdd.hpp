@@ -0,0 +1,111 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LDL_EXTENDADD_HPP
+#define EL_LDL_EXTENDADD_HPP
+
+namespace El {
+namespace ldl {
+
+// Split the (strictly increasing) relative indices into maximal runs of
+// consecutive values, where run r consists of the entries
+// [runOffs[r],runOffs[r+1])
+inline void RelativeIndexRuns
+( const vector<Int>& relInds, vector<Int>& runOffs )
+{
+    const Int numInds = relInds.size();
+    runOffs.resize( 0 );
+    runOffs.push_back( 0 );
+    for( Int k=1; k<numInds; ++k )
+        if( relInds[k] != relInds[k-1]+1 )
+            runOffs.push_back( k );
+    runOffs.push_back( numInds );
+}
+
+// Add the lower triangle of the child update matrix 'childU' into the
+// columns [jBeg,jEnd) of the front, which land in the matrix 'F' after their
+// relative indices are shifted by 'shift'. Each contiguous run of relative
+// indices is added as a single column segment.
+template<typename Field>
+void ExtendAddColumns
+( const vector<Int>& relInds,
+  const vector<Int>& runOffs,
+  Int jBeg, Int jEnd, Int shift,
+  const Matrix<Field>& childU,
+        Matrix<Field>& F )
+{
+    const Int numRuns = runOffs.size()-1;
+    Int firstRun = 0;
+    for( Int jChild=jBeg; jChild<jEnd; ++jChild )
+    {
+        while( runOffs[firstRun+1] <= jChild )
+            ++firstRun;
+        const Field* source = childU.LockedBuffer(0,jChild);
+        Field* target = F.Buffer(0,relInds[jChild]-shift);
+        for( Int r=firstRun; r<numRuns; ++r )
+        {
+            const Int iBeg = Max( runOffs[r], jChild );
+            const Int runSize = runOffs[r+1] - iBeg;
+            const Field* sourceRun = &source[iBeg];
+            Field* targetRun = &target[relInds[iBeg]-shift];
+            EL_SIMD
+            for( Int k=0; k<runSize; ++k )
+                targetRun[k] += sourceRun[k];
+        }
+    }
+}
+
+// Add the child update matrix into the left portion, FL, and bottom-right
+// portion, FBR, of a front whose top-left block is of the given size
+template<typename Field>
+void ExtendAdd
+( const vector<Int>& relInds,
+  Int size,
+  const Matrix<Field>& childU,
+        Matrix<Field>& FL,
+        Matrix<Field>& FBR )
+{
+    EL_DEBUG_CSE
+    const Int childUSize = childU.Height();
+    if( childUSize == 0 )
+        return;
+    vector<Int> runOffs;
+    RelativeIndexRuns( relInds, runOffs );
+
+    // The child columns which land within the left portion of the front come
+    // first (and every row of such a column lands within FL)
+    const Int jSplit =
+      std::lower_bound( relInds.begin(), relInds.end(), size ) -
+      relInds.begin();
+    ExtendAddColumns( relInds, runOffs, 0, jSplit, 0, childU, FL );
+    ExtendAddColumns
+    ( relInds, runOffs, jSplit, childUSize, size, childU, FBR );
+}
+
+// The owning process row (within the distribution of the parent front) of
+// each local row of a distributed child update matrix, so that the owner of
+// entry (iLoc,jLoc) is rowOwners[iLoc] plus the column owner of its column
+// times the column stride
+template<typename Field>
+void ChildUpdateRowOwners
+( const ElementalMatrix<Field>& FL,
+  const ElementalMatrix<Field>& childU,
+  const vector<Int>& relInds,
+        vector<int>& rowOwners )
+{
+    EL_DEBUG_CSE
+    const Int localHeight = childU.LocalHeight();
+    rowOwners.resize( localHeight );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        rowOwners[iLoc] = FL.RowOwner( relInds[childU.GlobalRow(iLoc)] );
+}
+
+} // namespace ldl
+} // namespace El
+
+#endif // ifndef EL_LDL_EXTENDADD_HPP
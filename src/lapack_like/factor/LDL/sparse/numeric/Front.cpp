@@ -33,6 +33,7 @@ Front<Field>::Front( Front<Field>* parentNode )
     {
         isHermitian = parentNode->isHermitian;
         type = parentNode->type;
+        storage = parentNode->storage;
     }
 }
 
@@ -83,6 +84,21 @@ void Front<Field>::Pull
     for( Int j=0; j<n; ++j )
         invReorder[reordering[j]] = j;
 
+    // Out-of-core fronts are attached to consecutive slots of the scratch
+    // file (in post-order) and released once they have been filled
+    size_t storageOffset = 0;
+    auto attach =
+      [&]( Front<Field>& front, Int height, Int width )
+      {
+        if( front.storage == nullptr )
+            return;
+        auto* buffer =
+          static_cast<Field*>(front.storage->Buffer(storageOffset));
+        front.LDense.Attach( height, width, buffer, Max(height,Int(1)) );
+        storageOffset +=
+          OutOfCoreFile::SlotBytes( height, width, sizeof(Field) );
+      };
+
     function<void(const NodeInfo&,Front<Field>&)> pull =
       [&]( const NodeInfo& node, Front<Field>& front )
       {
@@ -101,109 +117,127 @@ void Front<Field>::Pull
             front.sparseLeaf = true;
 
         const Int lowerSize = node.lowerStruct.size();
-        const Field* AValBuf = A.LockedValueBuffer();
-        const Int* AColBuf = A.LockedTargetBuffer();
-        const Int* AOffsetBuf = A.LockedOffsetBuffer();
         if( front.sparseLeaf )
-        {
-            front.workSparse.Empty();
-            Zeros( front.workSparse, node.size, node.size );
-            Zeros( front.LDense, lowerSize, node.size );
+            attach( front, lowerSize, node.size );
+        else
+            attach( front, node.size+lowerSize, node.size );
+        front.PullNode( A, reordering, invReorder, node );
+        if( front.storage != nullptr )
+            front.storage->Evict( front.LDense );
+      };
+    pull( rootInfo, *this );
+}
 
-            // Count the number of sparse entries to queue into the top-left
-            Int numEntriesTopLeft = 0;
-            for( Int t=0; t<node.size; ++t )
+template<typename Field>
+void Front<Field>::PullNode
+( const SparseMatrix<Field>& A,
+  const vector<Int>& reordering,
+  const vector<Int>& invReorder,
+  const NodeInfo& node )
+{
+    EL_DEBUG_CSE
+    const Int lowerSize = node.lowerStruct.size();
+    const Field* AValBuf = A.LockedValueBuffer();
+    const Int* AColBuf = A.LockedTargetBuffer();
+    const Int* AOffsetBuf = A.LockedOffsetBuffer();
+    if( sparseLeaf )
+    {
+        workSparse.Empty();
+        Zeros( workSparse, node.size, node.size );
+        Zeros( LDense, lowerSize, node.size );
+
+        // Count the number of sparse entries to queue into the top-left
+        Int numEntriesTopLeft = 0;
+        for( Int t=0; t<node.size; ++t )
+        {
+            const Int j = invReorder[node.off+t];
+            const Int rowOff = AOffsetBuf[j];
+            const Int numConn = AOffsetBuf[j+1] - rowOff;
+            for( Int k=0; k<numConn; ++k )
             {
-                const Int j = invReorder[node.off+t];
-                const Int rowOff = AOffsetBuf[j];
-                const Int numConn = AOffsetBuf[j+1] - rowOff;
-                for( Int k=0; k<numConn; ++k )
-                {
-                    const Int iOrig = AColBuf[rowOff+k];
-                    const Int i = reordering[iOrig];
+                const Int iOrig = AColBuf[rowOff+k];
+                const Int i = reordering[iOrig];
 
-                    if( i < node.off+t )
-                        continue;
-                    else if( i < node.off+node.size )
-                        ++numEntriesTopLeft;
-                }
+                if( i < node.off+t )
+                    continue;
+                else if( i < node.off+node.size )
+                    ++numEntriesTopLeft;
             }
-            front.workSparse.Reserve( numEntriesTopLeft );
+        }
+        workSparse.Reserve( numEntriesTopLeft );
 
-            for( Int t=0; t<node.size; ++t )
+        for( Int t=0; t<node.size; ++t )
+        {
+            const Int j = invReorder[node.off+t];
+            const Int rowOff = AOffsetBuf[j];
+            const Int numConn = AOffsetBuf[j+1] - rowOff;
+            for( Int k=0; k<numConn; ++k )
             {
-                const Int j = invReorder[node.off+t];
-                const Int rowOff = AOffsetBuf[j];
-                const Int numConn = AOffsetBuf[j+1] - rowOff;
-                for( Int k=0; k<numConn; ++k )
-                {
-                    const Int iOrig = AColBuf[rowOff+k];
-                    const Int i = reordering[iOrig];
+                const Int iOrig = AColBuf[rowOff+k];
+                const Int i = reordering[iOrig];
 
-                    const Field transVal = AValBuf[rowOff+k];
-                    const Field value = conjugate ? Conj(transVal) : transVal;
+                const Field transVal = AValBuf[rowOff+k];
+                const Field value = isHermitian ? Conj(transVal) : transVal;
 
-                    if( i < node.off+t )
-                        continue;
-                    else if( i < node.off+node.size )
-                    {
-                        // Since SuiteSparse makes use of column-major ordering,
-                        // and Elemental uses row-major ordering of its sparse
-                        // matrices, we are implicitly storing the transpose.
-                        front.workSparse.QueueUpdate( i-node.off, t, transVal );
-                    }
-                    else
-                    {
-                        const Int origOff = Find( node.origLowerStruct, i );
-                        const Int row = node.origLowerRelInds[origOff];
-                        EL_DEBUG_ONLY(
-                          if( row < t )
-                              LogicError("Tried to touch upper triangle");
-                        )
-                        front.LDense(row-node.size,t) = value;
-                    }
+                if( i < node.off+t )
+                    continue;
+                else if( i < node.off+node.size )
+                {
+                    // Since SuiteSparse makes use of column-major ordering,
+                    // and Elemental uses row-major ordering of its sparse
+                    // matrices, we are implicitly storing the transpose.
+                    workSparse.QueueUpdate( i-node.off, t, transVal );
+                }
+                else
+                {
+                    const Int origOff = Find( node.origLowerStruct, i );
+                    const Int row = node.origLowerRelInds[origOff];
+                    EL_DEBUG_ONLY(
+                      if( row < t )
+                          LogicError("Tried to touch upper triangle");
+                    )
+                    LDense(row-node.size,t) = value;
                 }
             }
-            front.workSparse.ProcessQueues();
-            MakeSymmetric( LOWER, front.workSparse, front.isHermitian );
         }
-        else
+        workSparse.ProcessQueues();
+        MakeSymmetric( LOWER, workSparse, isHermitian );
+    }
+    else
+    {
+        Zeros( LDense, node.size+lowerSize, node.size );
+        for( Int t=0; t<node.size; ++t )
         {
-            Zeros( front.LDense, node.size+lowerSize, node.size );
-            for( Int t=0; t<node.size; ++t )
+            const Int j = invReorder[node.off+t];
+            const Int rowOff = AOffsetBuf[j];
+            const Int numConn = AOffsetBuf[j+1] - rowOff;
+            for( Int k=0; k<numConn; ++k )
             {
-                const Int j = invReorder[node.off+t];
-                const Int rowOff = AOffsetBuf[j];
-                const Int numConn = AOffsetBuf[j+1] - rowOff;
-                for( Int k=0; k<numConn; ++k )
-                {
-                    const Int iOrig = AColBuf[rowOff+k];
-                    const Int i = reordering[iOrig];
+                const Int iOrig = AColBuf[rowOff+k];
+                const Int i = reordering[iOrig];
 
-                    const Field transVal = AValBuf[rowOff+k];
-                    const Field value = conjugate ? Conj(transVal) : transVal;
+                const Field transVal = AValBuf[rowOff+k];
+                const Field value = isHermitian ? Conj(transVal) : transVal;
 
-                    if( i < node.off+t )
-                        continue;
-                    else if( i < node.off+node.size )
-                    {
-                        front.LDense(i-node.off,t) = value;
-                    }
-                    else
-                    {
-                        const Int origOff = Find( node.origLowerStruct, i );
-                        const Int row = node.origLowerRelInds[origOff];
-                        EL_DEBUG_ONLY(
-                          if( row < t )
-                              LogicError("Tried to touch upper triangle");
-                        )
-                        front.LDense(row,t) = value;
-                    }
+                if( i < node.off+t )
+                    continue;
+                else if( i < node.off+node.size )
+                {
+                    LDense(i-node.off,t) = value;
+                }
+                else
+                {
+                    const Int origOff = Find( node.origLowerStruct, i );
+                    const Int row = node.origLowerRelInds[origOff];
+                    EL_DEBUG_ONLY(
+                      if( row < t )
+                          LogicError("Tried to touch upper triangle");
+                    )
+                    LDense(row,t) = value;
                 }
             }
         }
-      };
-    pull( rootInfo, *this );
+    }
 }
 
 template<typename Field>
@@ -277,6 +311,8 @@ void Front<Field>::PullUpdate
                 }
             }
         }
+        if( front.storage != nullptr )
+            front.storage->Evict( front.LDense );
       };
     pull( rootInfo, *this );
 }
@@ -535,6 +571,10 @@ const Front<Field>& Front<Field>::operator=( const Front<Field>& front )
     workSparse = front.workSparse;
     // Do not copy parent...
 
+    // ...or the scratch file, which belongs to the original tree; the
+    // copied fronts (including the children below) are held in memory
+    storage = nullptr;
+
     // Delete any existing children
     SwapClear( children );
 
@@ -45,7 +45,11 @@ inline void LowerBackwardSolve
                                      : (haveDupMatParent ? dupMat->work.Matrix()
                                                          : X.matrix)));
 
+    if( front.storage != nullptr )
+        front.storage->Prefetch( front.LDense );
     FrontLowerBackwardSolve( front, W, conjugate );
+    if( front.storage != nullptr )
+        front.storage->Evict( front.LDense );
 
     const Int numRHS = X.matrix.Width();
     if( haveParent || haveDupMVParent || haveDupMatParent )
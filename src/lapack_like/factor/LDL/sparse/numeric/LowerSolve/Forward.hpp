@@ -68,7 +68,11 @@ void LowerForwardSolve
     }
 
     // Solve against this front
+    if( front.storage != nullptr )
+        front.storage->Prefetch( front.LDense );
     FrontLowerForwardSolve( front, W );
+    if( front.storage != nullptr )
+        front.storage->Evict( front.LDense );
 
     // Store this node's portion of the result
     X.matrix = WT;
@@ -0,0 +1,229 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#include <cerrno>
+#include <cstring>
+#include <functional>
+
+#if !defined(_WIN32)
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <unistd.h>
+#endif
+
+namespace El {
+namespace ldl {
+
+namespace {
+
+// Slots are padded so that each front starts on a cache line
+const size_t SLOT_ALIGNMENT = 64;
+
+size_t PageSize()
+{
+#if defined(_WIN32)
+    return 4096;
+#else
+    return size_t(sysconf(_SC_PAGESIZE));
+#endif
+}
+
+// Restrict [buffer,buffer+numBytes) to offsets within the mapped file,
+// returning false if the buffer does not point into it (e.g., if the front
+// was emptied or reallocated in memory)
+bool ClipToFile
+( const char* data, size_t fileBytes, const void* buffer, size_t numBytes,
+  size_t& beg, size_t& end )
+{
+    const char* bufferBeg = static_cast<const char*>(buffer);
+    std::less<const char*> less;
+    if( data == nullptr || bufferBeg == nullptr || numBytes == 0 ||
+        less(bufferBeg,data) || !less(bufferBeg,data+fileBytes) )
+        return false;
+    beg = bufferBeg - data;
+    end = Min( beg+numBytes, fileBytes );
+    return true;
+}
+
+} // anonymous namespace
+
+OutOfCoreFile::OutOfCoreFile( const string& directory, size_t numBytes )
+: numBytes_(numBytes)
+{
+    EL_DEBUG_CSE
+#if defined(_WIN32)
+    LogicError("Out-of-core fronts are not supported on this platform");
+#else
+    string filename = directory + "/El-fronts-XXXXXX";
+    vector<char> filenameBuf( filename.begin(), filename.end() );
+    filenameBuf.push_back( '\0' );
+    fd_ = mkstemp( filenameBuf.data() );
+    if( fd_ == -1 )
+        RuntimeError
+        ("Could not create a scratch file in ",directory,": ",
+         std::strerror(errno));
+    // The file is unlinked immediately so that it is removed even if the
+    // process does not exit cleanly
+    unlink( filenameBuf.data() );
+
+    if( numBytes_ == 0 )
+        return;
+    if( ftruncate( fd_, off_t(numBytes_) ) != 0 )
+    {
+        const int error = errno;
+        close( fd_ );
+        RuntimeError
+        ("Could not extend the scratch file to ",numBytes_," bytes: ",
+         std::strerror(error));
+    }
+    void* data =
+      mmap( nullptr, numBytes_, PROT_READ|PROT_WRITE, MAP_SHARED, fd_, 0 );
+    if( data == MAP_FAILED )
+    {
+        const int error = errno;
+        close( fd_ );
+        RuntimeError
+        ("Could not map the scratch file: ",std::strerror(error));
+    }
+    data_ = static_cast<char*>(data);
+#endif
+}
+
+OutOfCoreFile::~OutOfCoreFile()
+{
+#if !defined(_WIN32)
+    if( data_ != nullptr )
+        munmap( data_, numBytes_ );
+    if( fd_ != -1 )
+        close( fd_ );
+#endif
+}
+
+size_t OutOfCoreFile::NumBytes() const { return numBytes_; }
+
+void* OutOfCoreFile::Buffer( size_t offset ) const
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( offset > numBytes_ )
+          LogicError("Offset ",offset," exceeds the file size of ",numBytes_);
+    )
+    return data_ + offset;
+}
+
+size_t OutOfCoreFile::SlotBytes( Int height, Int width, size_t entrySize )
+{
+    const size_t numBytes = size_t(Max(height,Int(1)))*width*entrySize;
+    return ((numBytes+SLOT_ALIGNMENT-1)/SLOT_ALIGNMENT)*SLOT_ALIGNMENT;
+}
+
+size_t OutOfCoreFile::FrontBytes( const NodeInfo& info, size_t entrySize )
+{
+    size_t numBytes = 0;
+    for( const auto& child : info.children )
+        numBytes += FrontBytes( *child, entrySize );
+    // Leaves only store the dense bottom-left block
+    const Int lowerSize = info.lowerStruct.size();
+    const Int height = ( info.children.empty() ? 0 : info.size ) + lowerSize;
+    return numBytes + SlotBytes( height, info.size, entrySize );
+}
+
+void OutOfCoreFile::Evict( const void* buffer, size_t numBytes ) const
+{
+    EL_DEBUG_CSE
+#if !defined(_WIN32)
+    size_t beg, end;
+    if( !ClipToFile( data_, numBytes_, buffer, numBytes, beg, end ) )
+        return;
+    // Only whole pages within the range may be released
+    const size_t pageSize = PageSize();
+    const size_t pageBeg = ((beg+pageSize-1)/pageSize)*pageSize;
+    const size_t pageEnd = (end/pageSize)*pageSize;
+    if( pageBeg >= pageEnd )
+        return;
+    // Drop the pages from our address space (their modifications are kept
+    // within the page cache) and then ask the kernel to begin writing them
+    // back to the file and to release them once they are clean
+    madvise( data_+pageBeg, pageEnd-pageBeg, MADV_DONTNEED );
+    posix_fadvise
+    ( fd_, off_t(pageBeg), off_t(pageEnd-pageBeg), POSIX_FADV_DONTNEED );
+#endif
+}
+
+void OutOfCoreFile::Prefetch( const void* buffer, size_t numBytes ) const
+{
+    EL_DEBUG_CSE
+#if !defined(_WIN32)
+    size_t beg, end;
+    if( !ClipToFile( data_, numBytes_, buffer, numBytes, beg, end ) )
+        return;
+    const size_t pageSize = PageSize();
+    const size_t pageBeg = (beg/pageSize)*pageSize;
+    const size_t pageEnd = end;
+    if( pageBeg >= pageEnd )
+        return;
+    madvise( data_+pageBeg, pageEnd-pageBeg, MADV_WILLNEED );
+#endif
+}
+
+namespace {
+
+// The peak number of bytes simultaneously held by the sequential
+// factorization of the subtree (the bytes of the factors which remain in
+// memory are returned separately)
+void PeakMemoryRecursion
+( const NodeInfo& info, size_t entrySize, bool outOfCore,
+  double& peak, double& resident )
+{
+    const double n = info.size;
+    const double u = info.lowerStruct.size();
+    const double updateBytes = u*u*entrySize;
+    const bool leaf = info.children.empty();
+    const double frontBytes = ( leaf ? u : n+u )*n*entrySize;
+
+    // The diagonal and the sparse factors of the leaves are always held in
+    // memory
+    resident += n*entrySize;
+    if( leaf && !info.LOffsets.empty() )
+        resident += info.LOffsets.back()*double(entrySize+sizeof(Int));
+    if( !outOfCore )
+        resident += frontBytes;
+
+    // The update matrix of this front is formed before its children are
+    // processed and each child update is released once it has been added in
+    double childPeak = 0, maxChildUpdate = 0;
+    for( const auto& child : info.children )
+    {
+        double childTotal = 0;
+        PeakMemoryRecursion
+        ( *child, entrySize, outOfCore, childTotal, resident );
+        childPeak = Max( childPeak, childTotal );
+        const double childU = child->lowerStruct.size();
+        maxChildUpdate = Max( maxChildUpdate, childU*childU*entrySize );
+    }
+    // Out-of-core fronts are only resident while they are being assembled
+    // and factored
+    const double activeFront = ( outOfCore ? frontBytes : 0 );
+    peak = updateBytes + Max( childPeak, activeFront+maxChildUpdate );
+}
+
+} // anonymous namespace
+
+double PeakFactorMemory
+( const NodeInfo& info, size_t entrySize, bool outOfCore )
+{
+    EL_DEBUG_CSE
+    double peak=0, resident=0;
+    PeakMemoryRecursion( info, entrySize, outOfCore, peak, resident );
+    return peak + resident;
+}
+
+} // namespace ldl
+} // namespace El
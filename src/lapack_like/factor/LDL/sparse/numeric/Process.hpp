@@ -23,11 +23,108 @@
 #ifndef EL_LDL_PROCESS_HPP
 #define EL_LDL_PROCESS_HPP
 
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+
+#include "./ExtendAdd.hpp"
 #include "./ProcessFront.hpp"
 
 namespace El {
 namespace ldl {
 
+// Factor a front which was marked as a leaf of the sparse-direct portion
+// of the tree (using the up-looking sparse LDL of SuiteSparse)
+template<typename Field>
+void ProcessSparseLeaf
+( const NodeInfo& info, Front<Field>& front, LDLFrontType factorType )
+{
+    EL_DEBUG_CSE
+    front.type = factorType;
+    const Int m = front.LDense.Height();
+    const Int n = front.LDense.Width();
+    const Int numEntries = info.LOffsets.back();
+    const Int numSources = info.LOffsets.size()-1;
+
+    // TODO(poulson): Add support for pivoting here
+    if( PivotedFactorization(factorType) )
+        Zeros( front.subdiag, Max(n-1,0), 1 );
+
+    Zeros( front.LSparse, numSources, numSources );
+    front.LSparse.ForceNumEntries( numEntries );
+    Field* LValBuf = front.LSparse.ValueBuffer();
+    Int* LRowBuf = front.LSparse.SourceBuffer();
+    Int* LColBuf = front.LSparse.TargetBuffer();
+    Int* LOffsetBuf = front.LSparse.OffsetBuffer();
+
+    for( Int i=0; i<numSources; ++i )
+    {
+        const Int iStart = info.LOffsets[i];
+        const Int iEnd = info.LOffsets[i+1];
+        LOffsetBuf[i] = iStart;
+        for( Int e=iStart; e<iEnd; ++e )
+            LRowBuf[e] = i;
+    }
+    LOffsetBuf[numSources] = info.LOffsets[numSources];
+    front.diag.Resize( numSources, 1 );
+
+    // Factor the transpose of L
+    // TODO(poulson): Reuse these workspaces
+    vector<Int> LNnz(numSources), pattern(numSources), flag(numSources);
+    vector<Field> y(numSources);
+    suite_sparse::ldl::Numeric
+    ( numSources,
+      front.workSparse.LockedOffsetBuffer(),
+      front.workSparse.LockedTargetBuffer(),
+      front.workSparse.LockedValueBuffer(),
+      LOffsetBuf,
+      info.LParents.data(),
+      LNnz.data(),
+      LColBuf,
+      LValBuf,
+      front.diag.Buffer(),
+      y.data(),
+      pattern.data(),
+      flag.data(),
+      static_cast<const Int*>(nullptr),
+      static_cast<const Int*>(nullptr),
+      front.isHermitian );
+    front.LSparse.ForceConsistency();
+
+    // Solve against L_{TL}^T from the right
+    bool onLeft = false;
+    suite_sparse::ldl::LTSolveMulti
+    ( onLeft, m, n, front.LDense.Buffer(), front.LDense.LDim(),
+      LOffsetBuf, LColBuf, LValBuf, front.isHermitian );
+
+    // Save a copy of ABL
+    auto ABLCopy = front.LDense;
+
+    // Solve against the diagonal
+    suite_sparse::ldl::DSolveMulti
+    ( onLeft, m, n, front.LDense.Buffer(), front.LDense.LDim(),
+      front.diag.Buffer() );
+
+    // Form the Schur complement
+    Orientation orientation = ( front.isHermitian ? ADJOINT : TRANSPOSE );
+    Trrk
+    ( LOWER, NORMAL, orientation,
+      Field(-1), front.LDense, ABLCopy, Field(0), front.workDense );
+}
+
+// Add the update matrix of the c'th child into the front and free it
+template<typename Field>
+void AddChildUpdate( const NodeInfo& info, Front<Field>& front, Int c )
+{
+    EL_DEBUG_CSE
+    auto& childU = front.children[c]->workDense;
+    ExtendAdd
+    ( info.childRelInds[c], info.size, childU,
+      front.LDense, front.workDense );
+    childU.Empty();
+}
+
+// Process the subtree rooted at the given front, one front at a time
 template<typename Field>
 void Process
 ( const NodeInfo& info, Front<Field>& front, LDLFrontType factorType )
@@ -40,82 +137,13 @@ void Process
 
     if( front.sparseLeaf )
     {
-        front.type = factorType;
-        const Int m = front.LDense.Height();
-        const Int n = front.LDense.Width();
-        const Int numEntries = info.LOffsets.back();
-        const Int numSources = info.LOffsets.size()-1;
-
-        // TODO(poulson): Add support for pivoting here
-        if( PivotedFactorization(factorType) )
-            Zeros( front.subdiag, Max(n-1,0), 1 );
-
-        Zeros( front.LSparse, numSources, numSources );
-        front.LSparse.ForceNumEntries( numEntries );
-        Field* LValBuf = front.LSparse.ValueBuffer();
-        Int* LRowBuf = front.LSparse.SourceBuffer();
-        Int* LColBuf = front.LSparse.TargetBuffer();
-        Int* LOffsetBuf = front.LSparse.OffsetBuffer();
-
-        for( Int i=0; i<numSources; ++i )
-        {
-            const Int iStart = info.LOffsets[i];
-            const Int iEnd = info.LOffsets[i+1];
-            LOffsetBuf[i] = iStart;
-            for( Int e=iStart; e<iEnd; ++e )
-                LRowBuf[e] = i;
-        }
-        LOffsetBuf[numSources] = info.LOffsets[numSources];
-        front.diag.Resize( numSources, 1 );
-
-        // Factor the transpose of L
-        // TODO(poulson): Reuse these workspaces
-        vector<Int> LNnz(numSources), pattern(numSources), flag(numSources);
-        vector<Field> y(numSources);
-        suite_sparse::ldl::Numeric
-        ( numSources,
-          front.workSparse.LockedOffsetBuffer(),
-          front.workSparse.LockedTargetBuffer(),
-          front.workSparse.LockedValueBuffer(),
-          LOffsetBuf,
-          info.LParents.data(),
-          LNnz.data(),
-          LColBuf,
-          LValBuf,
-          front.diag.Buffer(),
-          y.data(),
-          pattern.data(),
-          flag.data(),
-          static_cast<const Int*>(nullptr),
-          static_cast<const Int*>(nullptr),
-          front.isHermitian );
-        front.LSparse.ForceConsistency();
-
-        // Solve against L_{TL}^T from the right
-        bool onLeft = false;
-        suite_sparse::ldl::LTSolveMulti
-        ( onLeft, m, n, front.LDense.Buffer(), front.LDense.LDim(),
-          LOffsetBuf, LColBuf, LValBuf, front.isHermitian );
-
-        // Save a copy of ABL
-        auto ABLCopy = front.LDense;
-
-        // Solve against the diagonal
-        suite_sparse::ldl::DSolveMulti
-        ( onLeft, m, n, front.LDense.Buffer(), front.LDense.LDim(),
-          front.diag.Buffer() );
-
-        // Form the Schur complement
-        Orientation orientation = ( front.isHermitian ? ADJOINT : TRANSPOSE );
-        Trrk
-        ( LOWER, NORMAL, orientation,
-          Field(-1), front.LDense, ABLCopy, Field(0), front.workDense );
+        ProcessSparseLeaf( info, front, factorType );
     }
     else
     {
-        auto& FL = front.LDense;
         EL_DEBUG_ONLY(
-          if( FL.Height() != info.size+updateSize || FL.Width() != info.size )
+          if( front.LDense.Height() != info.size+updateSize ||
+              front.LDense.Width() != info.size )
               LogicError("Front was not the proper size");
         )
 
@@ -124,31 +152,428 @@ void Process
         for( Int c=0; c<numChildren; ++c )
         {
             Process( *info.children[c], *front.children[c], factorType );
+            AddChildUpdate( info, front, c );
+        }
+        ProcessFront( front, factorType );
+    }
+    if( front.storage != nullptr )
+        front.storage->Evict( front.LDense );
+}
+
+namespace refactor {
+
+// Whether the subtree rooted at the given node contains any of the (sorted)
+// reordered indices, i.e., whether its factorization depends upon them
+inline bool Depends( const NodeInfo& info, const vector<Int>& changedInds )
+{
+    const NodeInfo* leftmost = &info;
+    while( !leftmost->children.empty() )
+        leftmost = leftmost->children.front().get();
+    auto it =
+      std::lower_bound
+      ( changedInds.begin(), changedInds.end(), leftmost->off );
+    return it != changedInds.end() && *it < info.off+info.size;
+}
 
-            auto& childU = front.children[c]->workDense;
-            const int childUSize = childU.Height();
-            for( int jChild=0; jChild<childUSize; ++jChild )
+// Rebuild the update matrix of an unchanged (factored) front from the
+// factors of its subtree rather than refactoring the subtree. The update is
+// the sum of -l_k d_k l_k^H over the columns k of the subtree, where l_k is
+// the portion of the k'th column of L lying within the lower structure of
+// the front, so the relevant rows are gathered from the fronts of the subtree
+// and the update is formed with a single Trrk. Since this is only valid for
+// unpivoted, non-block factorizations, false is returned otherwise.
+template<typename Field>
+bool RebuildUpdate( const NodeInfo& info, Front<Field>& front )
+{
+    EL_DEBUG_CSE
+    if( PivotedFactorization(front.type) || BlockFactorization(front.type) ||
+        SelInvFactorization(front.type) )
+        return false;
+    const Int updateSize = info.lowerStruct.size();
+    const Int end = info.off + info.size;
+
+    // Find the fronts of the subtree whose columns have entries within the
+    // lower structure of this front
+    vector<const NodeInfo*> nodes;
+    vector<const Front<Field>*> fronts;
+    Int numCols = 0;
+    function<void(const NodeInfo&,const Front<Field>&)> find =
+      [&]( const NodeInfo& node, const Front<Field>& subFront )
+      {
+          if( !subFront.sparseLeaf )
+          {
+              const Int numChildren = node.children.size();
+              for( Int c=0; c<numChildren; ++c )
+                  find( *node.children[c], *subFront.children[c] );
+          }
+          if( !node.lowerStruct.empty() && node.lowerStruct.back() >= end )
+          {
+              nodes.push_back( &node );
+              fronts.push_back( &subFront );
+              numCols += node.size;
+          }
+      };
+    find( info, front );
+
+    Matrix<Field> L, LD;
+    Zeros( L, updateSize, numCols );
+    Zeros( LD, updateSize, numCols );
+    Int colOff = 0;
+    for( size_t k=0; k<nodes.size(); ++k )
+    {
+        const NodeInfo& node = *nodes[k];
+        const Front<Field>& subFront = *fronts[k];
+        const Int lowerSize = node.lowerStruct.size();
+        // The dense factors of sparse leaves only contain their lower blocks
+        const Int rowOff = ( subFront.sparseLeaf ? 0 : node.size );
+        const Int sBeg =
+          std::lower_bound
+          ( node.lowerStruct.begin(), node.lowerStruct.end(), end ) -
+          node.lowerStruct.begin();
+        for( Int s=sBeg; s<lowerSize; ++s )
+        {
+            const Int i =
+              std::lower_bound
+              ( info.lowerStruct.begin(), info.lowerStruct.end(),
+                node.lowerStruct[s] ) - info.lowerStruct.begin();
+            EL_DEBUG_ONLY(
+              if( i == updateSize ||
+                  info.lowerStruct[i] != node.lowerStruct[s] )
+                  LogicError("Subtree structure was not nested");
+            )
+            for( Int t=0; t<node.size; ++t )
             {
-                const int j = info.childRelInds[c][jChild];
-                for( int iChild=jChild; iChild<childUSize; ++iChild )
-                {
-                    const int i = info.childRelInds[c][iChild];
-                    const Field value = childU(iChild,jChild);
-                    if( j < info.size )
-                        FL(i,j) += value;
-                    else
-                        FBR(i-info.size,j-info.size) += value;
-                }
+                const Field value = subFront.LDense(rowOff+s,t);
+                L(i,colOff+t) = value;
+                LD(i,colOff+t) = value*subFront.diag(t);
             }
-            childU.Empty();
+        }
+        if( subFront.storage != nullptr )
+            subFront.storage->Evict( subFront.LDense );
+        colOff += node.size;
+    }
+
+    const Orientation orientation = ( front.isHermitian ? ADJOINT : TRANSPOSE );
+    Zeros( front.workDense, updateSize, updateSize );
+    Trrk
+    ( LOWER, NORMAL, orientation,
+      Field(-1), L, LD, Field(0), front.workDense );
+    return true;
+}
+
+// Refill and refactor the given front. Children whose subtrees do not
+// depend upon the changed indices are not revisited: their update matrices
+// are either retained from a previous refactorization or rebuilt from their
+// factors. The update matrices of the unchanged children of a changed front
+// are retained after being added in.
+template<typename Field>
+void Recursion
+( const NodeInfo& info,
+  Front<Field>& front,
+  LDLFrontType factorType,
+  const vector<Int>& changedInds,
+  const function<void(const NodeInfo&,Front<Field>&)>& refill,
+  bool changed )
+{
+    EL_DEBUG_CSE
+    const int updateSize = info.lowerStruct.size();
+    refill( info, front );
+    auto& FBR = front.workDense;
+    FBR.Empty();
+    Zeros( FBR, updateSize, updateSize );
+
+    if( front.sparseLeaf )
+    {
+        ProcessSparseLeaf( info, front, factorType );
+    }
+    else
+    {
+        const int numChildren = info.children.size();
+        for( Int c=0; c<numChildren; ++c )
+        {
+            const NodeInfo& childInfo = *info.children[c];
+            Front<Field>& child = *front.children[c];
+            const bool childChanged = Depends( childInfo, changedInds );
+            const bool retained =
+              child.workDense.Height() == Int(childInfo.lowerStruct.size());
+            if( childChanged || (!retained && !RebuildUpdate(childInfo,child)) )
+                Recursion
+                ( childInfo, child, factorType, changedInds, refill,
+                  childChanged );
+            if( changed && !childChanged )
+                ExtendAdd
+                ( info.childRelInds[c], info.size, child.workDense,
+                  front.LDense, front.workDense );
+            else
+                AddChildUpdate( info, front, c );
         }
         ProcessFront( front, factorType );
     }
+    if( front.storage != nullptr )
+        front.storage->Evict( front.LDense );
+}
+
+} // namespace refactor
+
+// Refactor the fronts whose subtrees contain any of the (sorted) reordered
+// indices after 'refill' has been used to overwrite each of them with the
+// new values of the matrix
+template<typename Field>
+void Refactor
+( const NodeInfo& info,
+  Front<Field>& front,
+  LDLFrontType factorType,
+  const vector<Int>& changedInds,
+  const function<void(const NodeInfo&,Front<Field>&)>& refill )
+{
+    EL_DEBUG_CSE
+    if( refactor::Depends( info, changedInds ) )
+        refactor::Recursion
+        ( info, front, factorType, changedInds, refill, true );
+}
+
+#ifdef EL_HYBRID
+namespace traversal {
+
+// A flattened view of the sequential tree along with the estimated costs of
+// processing each subtree with the sequential 'Process'
+template<typename Field>
+struct TreeNode
+{
+    const NodeInfo* info;
+    Front<Field>* front;
+    vector<Int> children;
+
+    // The (real) flop count of the subtree
+    double flops;
+    // The number of entries in the update matrix of the root of the subtree
+    double updateEntries;
+    // The peak number of update-matrix entries simultaneously held while
+    // processing the subtree (each front allocates its update matrix before
+    // its children are processed and each child update is freed once it has
+    // been added into its parent)
+    double peakEntries;
+};
+
+template<typename Field>
+Int Flatten
+( const NodeInfo& info, Front<Field>& front, vector<TreeNode<Field>>& nodes )
+{
+    EL_DEBUG_CSE
+    const Int index = nodes.size();
+    nodes.emplace_back();
+    nodes[index].info = &info;
+    nodes[index].front = &front;
+
+    const double n = info.size;
+    const double u = info.lowerStruct.size();
+    double flops = n*n*n/3 + n*n*u + n*u*u;
+    double maxChildPeak = 0;
+    if( !front.sparseLeaf )
+    {
+        const Int numChildren = info.children.size();
+        for( Int c=0; c<numChildren; ++c )
+        {
+            const Int child =
+              Flatten( *info.children[c], *front.children[c], nodes );
+            nodes[index].children.push_back( child );
+            flops += nodes[child].flops;
+            maxChildPeak = Max( maxChildPeak, nodes[child].peakEntries );
+        }
+    }
+    nodes[index].flops = flops;
+    nodes[index].updateEntries = u*u;
+    nodes[index].peakEntries = u*u + maxChildPeak;
+    return index;
+}
+
+// Factor the independent subtrees of 'layer' concurrently. Idle threads
+// repeatedly claim the most expensive remaining subtree whose peak workspace
+// fits within the budget (or any subtree if no other is in progress), so that
+// the workspace held by running subtrees, plus the update matrices of the
+// finished ones, stays below the budget whenever that is possible. A thread
+// for which no subtree fits blocks until a running subtree finishes.
+template<typename Field>
+void ProcessLayer
+( const vector<TreeNode<Field>>& nodes,
+  const vector<Int>& layer,
+  LDLFrontType factorType,
+  const TraversalCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int layerSize = layer.size();
+    const double budget = ctrl.maxWorkspaceBytes / sizeof(Field);
+    vector<bool> started( layerSize, false );
+    Int numStarted=0, numRunning=0;
+    double entriesInUse = 0;
+    std::exception_ptr error;
+    std::mutex mutex;
+    std::condition_variable finishedSubtree;
+
+    // Claim the next subtree which fits (the mutex must be held)
+    auto claim = [&]()
+    {
+        for( Int s=0; s<layerSize; ++s )
+        {
+            if( started[s] )
+                continue;
+            const double peak = nodes[layer[s]].peakEntries;
+            if( budget <= 0 || numRunning == 0 || entriesInUse+peak <= budget )
+            {
+                started[s] = true;
+                ++numStarted;
+                ++numRunning;
+                entriesInUse += peak;
+                return s;
+            }
+        }
+        return Int(-1);
+    };
+
+    // Each thread factors its subtrees with single-threaded BLAS (and without
+    // nested OpenMP regions) so that the cores are not oversubscribed
+    const int blasThreads = blas::NumThreads();
+    const int maxActiveLevels = omp_get_max_active_levels();
+    blas::SetNumThreads( 1 );
+    omp_set_max_active_levels( 1 );
+
+    #pragma omp parallel
+    {
+        while( true )
+        {
+            Int next = -1;
+            {
+                std::unique_lock<std::mutex> lock( mutex );
+                finishedSubtree.wait
+                ( lock,
+                  [&]()
+                  {
+                      if( numStarted == layerSize )
+                          return true;
+                      next = claim();
+                      return next >= 0;
+                  } );
+            }
+            if( next < 0 )
+                break;
+
+            const auto& node = nodes[layer[next]];
+            try
+            {
+                Process( *node.info, *node.front, factorType );
+            }
+            catch( ... )
+            {
+                std::lock_guard<std::mutex> lock( mutex );
+                if( !error )
+                    error = std::current_exception();
+            }
+            {
+                std::lock_guard<std::mutex> lock( mutex );
+                entriesInUse -= node.peakEntries - node.updateEntries;
+                --numRunning;
+            }
+            finishedSubtree.notify_all();
+        }
+    }
+    omp_set_max_active_levels( maxActiveLevels );
+    blas::SetNumThreads( blasThreads );
+    if( error )
+        std::rethrow_exception( error );
+}
+
+// Process the children of the front (which have already been processed)
+// followed by the front itself
+template<typename Field>
+void ProcessAboveLayer
+( const NodeInfo& info, Front<Field>& front, LDLFrontType factorType )
+{
+    EL_DEBUG_CSE
+    const int updateSize = info.lowerStruct.size();
+    auto& FBR = front.workDense;
+    FBR.Empty();
+    Zeros( FBR, updateSize, updateSize );
+    const int numChildren = info.children.size();
+    for( Int c=0; c<numChildren; ++c )
+        AddChildUpdate( info, front, c );
+    ProcessFront( front, factorType );
+    if( front.storage != nullptr )
+        front.storage->Evict( front.LDense );
+}
+
+} // namespace traversal
+#endif // ifdef EL_HYBRID
+
+// Process the subtree rooted at the given front, factoring independent
+// subtrees concurrently when OpenMP is available.
+//
+// The tree is split (by repeatedly replacing the most expensive subtree with
+// its children) into a layer of ctrl.subtreesPerThread subtrees per thread,
+// which are dynamically scheduled over the threads. The (typically large)
+// fronts above the layer are then processed one at a time outside of the
+// parallel region so that they make use of threaded BLAS.
+template<typename Field>
+void Process
+( const NodeInfo& info,
+  Front<Field>& front,
+  LDLFrontType factorType,
+  const TraversalCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HYBRID
+    const Int numThreads = omp_get_max_threads();
+    if( !ctrl.parallel || numThreads == 1 || omp_in_parallel() )
+    {
+        Process( info, front, factorType );
+        return;
+    }
+
+    vector<traversal::TreeNode<Field>> nodes;
+    traversal::Flatten( info, front, nodes );
+
+    vector<Int> layer(1,0), top;
+    const Int targetLayerSize = Max(ctrl.subtreesPerThread,Int(1))*numThreads;
+    while( Int(layer.size()) < targetLayerSize )
+    {
+        auto costliest =
+          std::max_element
+          ( layer.begin(), layer.end(),
+            [&]( Int a, Int b ) { return nodes[a].flops < nodes[b].flops; } );
+        const Int index = *costliest;
+        if( nodes[index].children.empty() )
+            break;
+        layer.erase( costliest );
+        top.push_back( index );
+        layer.insert
+        ( layer.end(),
+          nodes[index].children.begin(), nodes[index].children.end() );
+    }
+    if( top.empty() )
+    {
+        Process( info, front, factorType );
+        return;
+    }
+    std::sort
+    ( layer.begin(), layer.end(),
+      [&]( Int a, Int b ) { return nodes[a].flops > nodes[b].flops; } );
+
+    traversal::ProcessLayer( nodes, layer, factorType, ctrl );
+
+    // Each front above the layer was split off before its children
+    for( auto it=top.rbegin(); it!=top.rend(); ++it )
+        traversal::ProcessAboveLayer
+        ( *nodes[*it].info, *nodes[*it].front, factorType );
+#else
+    Process( info, front, factorType );
+#endif
 }
 
 template<typename Field>
 void Process
-( const DistNodeInfo& info, DistFront<Field>& front, LDLFrontType factorType )
+( const DistNodeInfo& info,
+  DistFront<Field>& front,
+  LDLFrontType factorType,
+  const TraversalCtrl& ctrl )
 {
     EL_DEBUG_CSE
 
@@ -158,7 +583,7 @@ void Process
         const Grid& grid = info.Grid();
         auto& frontDup = *front.duplicate;
 
-        Process( *info.duplicate, frontDup, factorType );
+        Process( *info.duplicate, frontDup, factorType, ctrl );
 
         // Pull the relevant information up from the duplicate
         front.type = frontDup.type;
@@ -179,7 +604,7 @@ void Process
 
     const auto& childInfo = *info.child;
     auto& childFront = *front.child;
-    Process( childInfo, childFront, factorType );
+    Process( childInfo, childFront, factorType, ctrl );
 
     const Int updateSize = info.lowerStruct.size();
     front.work.Empty();
@@ -210,17 +635,23 @@ void Process
     auto offs = sendOffs;
     const Int updateLocHeight = childU.LocalHeight();
     const Int updateLocWidth = childU.LocalWidth();
+    const auto& relInds = info.childRelInds[myChild];
+    vector<int> rowOwners;
+    ChildUpdateRowOwners( front.L2D, childU, relInds, rowOwners );
+    const Int colStride = front.L2D.ColStride();
+    const Field* childUBuf = childU.LockedBuffer();
+    const Int childULDim = childU.LDim();
     for( Int jChildLoc=0; jChildLoc<updateLocWidth; ++jChildLoc )
     {
         const Int jChild = childU.GlobalCol(jChildLoc);
-        const Int j = info.childRelInds[myChild][jChild];
+        const int colOwner = front.L2D.ColOwner( relInds[jChild] );
+        const int qOff = colOwner*colStride;
         const Int iChildOff = childU.LocalRowOffset( jChild );
+        const Field* childUCol = &childUBuf[jChildLoc*childULDim];
         for( Int iChildLoc=iChildOff; iChildLoc<updateLocHeight; ++iChildLoc )
         {
-            const Int iChild = childU.GlobalRow(iChildLoc);
-            const Int i = info.childRelInds[myChild][iChild];
-            const int q = front.L2D.Owner( i, j );
-            sendBuf[offs[q]++] = childU.GetLocal(iChildLoc,jChildLoc);
+            const int q = rowOwners[iChildLoc] + qOff;
+            sendBuf[offs[q]++] = childUCol[iChildLoc];
         }
     }
     EL_DEBUG_ONLY(
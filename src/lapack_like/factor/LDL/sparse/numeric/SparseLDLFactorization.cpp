@@ -51,7 +51,7 @@ void SparseLDLFactorization<Field>::Initialize
     ldl::NestedDissection
     ( A.LockedGraph(), map_, *separator_, *info_, bisectCtrl );
     InvertMap( map_, inverseMap_ );
-    front_.reset( new ldl::Front<Field>(A,map_,*info_,hermitian) );
+    InitializeFronts( A, hermitian );
 
     initialized_ = true;
     factored_ = false;
@@ -71,8 +71,10 @@ void SparseLDLFactorization<Field>::Initialize2DGridGraph
     ldl::NaturalNestedDissection
     ( gridDim0, gridDim1, 1, A.LockedGraph(),
       map_, *separator_, *info_, bisectCtrl.cutoff );
+    if( bisectCtrl.amalgamate )
+        ldl::Amalgamate( *separator_, *info_, bisectCtrl );
     InvertMap( map_, inverseMap_ );
-    front_.reset( new ldl::Front<Field>(A,map_,*info_,hermitian) );
+    InitializeFronts( A, hermitian );
 
     initialized_ = true;
     factored_ = false;
@@ -93,15 +95,59 @@ void SparseLDLFactorization<Field>::Initialize3DGridGraph
     ldl::NaturalNestedDissection
     ( gridDim0, gridDim1, gridDim2, A.LockedGraph(),
       map_, *separator_, *info_, bisectCtrl.cutoff );
+    if( bisectCtrl.amalgamate )
+        ldl::Amalgamate( *separator_, *info_, bisectCtrl );
     InvertMap( map_, inverseMap_ );
-    front_.reset( new ldl::Front<Field>(A,map_,*info_,hermitian) );
+    InitializeFronts( A, hermitian );
 
     initialized_ = true;
     factored_ = false;
 }
 
 template<typename Field>
-void SparseLDLFactorization<Field>::Factor( LDLFrontType frontType )
+void SparseLDLFactorization<Field>::InitializeFronts
+( const SparseMatrix<Field>& A, bool hermitian )
+{
+    EL_DEBUG_CSE
+    front_.reset( new ldl::Front<Field> );
+    outOfCoreFile_.reset();
+    if( !scratchDirectory_.empty() )
+    {
+        const size_t numBytes =
+          ldl::OutOfCoreFile::FrontBytes( *info_, sizeof(Field) );
+        outOfCoreFile_.reset
+        ( new ldl::OutOfCoreFile(scratchDirectory_,numBytes) );
+        front_->storage = outOfCoreFile_.get();
+    }
+    front_->Pull( A, map_, *info_, hermitian );
+}
+
+template<typename Field>
+void SparseLDLFactorization<Field>::EnableOutOfCore
+( const string& scratchDirectory )
+{
+    EL_DEBUG_CSE
+    if( scratchDirectory.empty() )
+        LogicError("The scratch directory must be specified");
+    scratchDirectory_ = scratchDirectory;
+}
+
+template<typename Field>
+void SparseLDLFactorization<Field>::DisableOutOfCore()
+{ scratchDirectory_.clear(); }
+
+template<typename Field>
+double SparseLDLFactorization<Field>::PeakFactorMemory( bool outOfCore ) const
+{
+    EL_DEBUG_CSE
+    if( !initialized_ )
+        LogicError("Must initialize before calling 'PeakFactorMemory()'");
+    return ldl::PeakFactorMemory( *info_, sizeof(Field), outOfCore );
+}
+
+template<typename Field>
+void SparseLDLFactorization<Field>::Factor
+( LDLFrontType frontType, const ldl::TraversalCtrl& traversalCtrl )
 {
     EL_DEBUG_CSE
     if( !initialized_ )
@@ -115,7 +161,8 @@ void SparseLDLFactorization<Field>::Factor( LDLFrontType frontType )
     ChangeFrontType( SYMM_2D );
     
     // Perform the initial factorization
-    ldl::Process( *info_, *front_, InitialFactorType(frontType) );
+    ldl::Process
+    ( *info_, *front_, InitialFactorType(frontType), traversalCtrl );
     factored_ = true;
     
     // Convert the fronts from the initial factorization to the requested form
@@ -142,6 +189,36 @@ void SparseLDLFactorization<Field>::ChangeNonzeroValues
     factored_ = false;
 }
 
+template<typename Field>
+void SparseLDLFactorization<Field>::Refactor
+( const SparseMatrix<Field>& ANew, const vector<Int>& changedInds )
+{
+    EL_DEBUG_CSE
+    if( !factored_ || Unfactored(front_->type) )
+        LogicError("Must call Factor() before Refactor()");
+    const Int n = map_.size();
+    if( ANew.Height() != n || ANew.Width() != n )
+        LogicError("The new matrix was not the right size");
+
+    vector<Int> reorderedInds( changedInds.size() );
+    for( size_t k=0; k<changedInds.size(); ++k )
+    {
+        const Int i = changedInds[k];
+        if( i < 0 || i >= n )
+            LogicError("Changed index ",i," was out of bounds");
+        reorderedInds[k] = map_[i];
+    }
+    std::sort( reorderedInds.begin(), reorderedInds.end() );
+
+    function<void(const ldl::NodeInfo&,ldl::Front<Field>&)> refill =
+      [&]( const ldl::NodeInfo& node, ldl::Front<Field>& front )
+      { front.PullNode( ANew, map_, inverseMap_, node ); };
+    const LDLFrontType frontType = front_->type;
+    ldl::Refactor
+    ( *info_, *front_, InitialFactorType(frontType), reorderedInds, refill );
+    ChangeFrontType( frontType );
+}
+
 template<typename Field>
 void SparseLDLFactorization<Field>::Solve( Matrix<Field>& B ) const
 {
@@ -0,0 +1,191 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace ldl {
+
+namespace amalgamate {
+
+// The number of entries in the lower trapezoid of a front and the number of
+// (real) flops required for its partial factorization
+inline double FrontEntries( double n, double u )
+{ return n*(n+1)/2 + n*u; }
+
+inline double FrontFlops( double n, double u )
+{ return n*n*n/3 + n*n*u + n*u*u; }
+
+inline void Accumulate
+( const NodeInfo& node, double& entries, double& flops )
+{
+    for( const auto& child : node.children )
+        Accumulate( *child, entries, flops );
+    const double u = node.lowerStruct.size();
+    entries += FrontEntries( node.size, u );
+    flops += FrontFlops( node.size, u );
+}
+
+// Merge the last child of 'node' (whose indices immediately precede those of
+// 'node' in a post-ordering) into 'node'. The children of the absorbed child
+// are appended to the children of 'node', so that the last child remains
+// the one whose indices immediately precede those of the merged node.
+inline void MergeLastChild( Separator& sep, NodeInfo& node )
+{
+    EL_DEBUG_CSE
+    unique_ptr<NodeInfo> child( std::move(node.children.back()) );
+    unique_ptr<Separator> childSep( std::move(sep.children.back()) );
+    node.children.pop_back();
+    sep.children.pop_back();
+
+    // The original structure of the child which lies above the merged node
+    const Int end = node.off + node.size;
+    vector<Int> childOrigStruct;
+    for( const Int i : child->origLowerStruct )
+        if( i >= end )
+            childOrigStruct.push_back( i );
+    node.origLowerStruct = Union( childOrigStruct, node.origLowerStruct );
+
+    node.off = child->off;
+    node.size += child->size;
+    sep.off = childSep->off;
+    sep.inds.insert( sep.inds.begin(), childSep->inds.begin(),
+                     childSep->inds.end() );
+
+    for( auto& grandchild : child->children )
+    {
+        grandchild->parent = &node;
+        node.children.emplace_back( std::move(grandchild) );
+    }
+    for( auto& grandchildSep : childSep->children )
+    {
+        grandchildSep->parent = &sep;
+        sep.children.emplace_back( std::move(grandchildSep) );
+    }
+}
+
+// Returns the number of explicit zeros introduced into the front
+inline double Recursion
+( Separator& sep, NodeInfo& node, double maxFill, Int& numMerges,
+  std::map<const NodeInfo*,double>& explicitZeros )
+{
+    EL_DEBUG_CSE
+    const Int numChildren = node.children.size();
+    for( Int c=0; c<numChildren; ++c )
+        explicitZeros[node.children[c].get()] =
+          Recursion
+          ( *sep.children[c], *node.children[c], maxFill, numMerges,
+            explicitZeros );
+
+    // Since the leaves are factored with a sparse-direct method, only the
+    // (dense) interior fronts are candidates for merging
+    const double u = node.lowerStruct.size();
+    double zeros = 0;
+    while( !node.children.empty() )
+    {
+        const NodeInfo& child = *node.children.back();
+        if( child.children.empty() || child.off+child.size != node.off )
+            break;
+
+        // Each column of the child becomes dense over the merged front
+        const double childU = child.lowerStruct.size();
+        const double newZeros =
+          zeros + explicitZeros[&child] + child.size*(node.size+u-childU);
+        const double mergedEntries = FrontEntries( child.size+node.size, u );
+        if( newZeros > maxFill*mergedEntries )
+            break;
+
+        explicitZeros.erase( &child );
+        MergeLastChild( sep, node );
+        zeros = newZeros;
+        ++numMerges;
+    }
+    return zeros;
+}
+
+} // namespace amalgamate
+
+AmalgamationInfo Amalgamate
+( Separator& rootSep, NodeInfo& rootInfo, const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    AmalgamationInfo info;
+    amalgamate::Accumulate
+    ( rootInfo, info.entriesBefore, info.flopsBefore );
+
+    std::map<const NodeInfo*,double> explicitZeros;
+    amalgamate::Recursion
+    ( rootSep, rootInfo, ctrl.maxAmalgamationFill, info.numMerges,
+      explicitZeros );
+    Analysis( rootInfo );
+
+    amalgamate::Accumulate
+    ( rootInfo, info.entriesAfter, info.flopsAfter );
+    if( ctrl.printAmalgamation )
+        Output
+        (info.numMerges," fronts amalgamated: ",
+         info.flopsBefore/1.e9," -> ",info.flopsAfter/1.e9," GFlops and ",
+         info.entriesBefore," -> ",info.entriesAfter," front entries");
+    return info;
+}
+
+AmalgamationInfo Amalgamate
+( DistSeparator& rootSep, DistNodeInfo& rootInfo, const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = rootInfo.Grid();
+
+    // The distributed fronts are left intact; only the sequential subtree
+    // of this process is amalgamated
+    DistSeparator* sep = &rootSep;
+    DistNodeInfo* node = &rootInfo;
+    while( node->duplicate == nullptr )
+    {
+        if( node->child == nullptr )
+            LogicError("Node child was nullptr");
+        node = node->child.get();
+        sep = sep->child.get();
+    }
+    auto& dupNode = *node->duplicate;
+    auto& dupSep = *sep->duplicate;
+
+    AmalgamationInfo info;
+    amalgamate::Accumulate
+    ( dupNode, info.entriesBefore, info.flopsBefore );
+
+    std::map<const NodeInfo*,double> explicitZeros;
+    amalgamate::Recursion
+    ( dupSep, dupNode, ctrl.maxAmalgamationFill, info.numMerges,
+      explicitZeros );
+
+    // Pull the (possibly enlarged) root of the subtree up from the duplicates
+    node->size = dupNode.size;
+    node->off = dupNode.off;
+    node->origLowerStruct = dupNode.origLowerStruct;
+    sep->off = dupSep.off;
+    sep->inds = dupSep.inds;
+    Analysis( rootInfo, ctrl.storeFactRecvInds );
+
+    amalgamate::Accumulate
+    ( dupNode, info.entriesAfter, info.flopsAfter );
+
+    info.numMerges = mpi::AllReduce( info.numMerges, grid.Comm() );
+    info.entriesBefore = mpi::AllReduce( info.entriesBefore, grid.Comm() );
+    info.entriesAfter = mpi::AllReduce( info.entriesAfter, grid.Comm() );
+    info.flopsBefore = mpi::AllReduce( info.flopsBefore, grid.Comm() );
+    info.flopsAfter = mpi::AllReduce( info.flopsAfter, grid.Comm() );
+    if( ctrl.printAmalgamation )
+        OutputFromRoot
+        (grid.Comm(),info.numMerges," sequential fronts amalgamated: ",
+         info.flopsBefore/1.e9," -> ",info.flopsAfter/1.e9," GFlops and ",
+         info.entriesBefore," -> ",info.entriesAfter," front entries");
+    return info;
+}
+
+} // namespace ldl
+} // namespace El
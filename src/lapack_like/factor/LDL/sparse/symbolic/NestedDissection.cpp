@@ -409,6 +409,8 @@ void NestedDissection
 
     // Run the symbolic analysis
     Analysis( info );
+    if( ctrl.amalgamate )
+        Amalgamate( sep, info, ctrl );
 }
 
 void NestedDissection
@@ -435,6 +437,8 @@ void NestedDissection
 
     // Run the symbolic analysis
     Analysis( info, ctrl.storeFactRecvInds );
+    if( ctrl.amalgamate )
+        Amalgamate( sep, info, ctrl );
 }
 
 } // namespace ldl
@@ -10,6 +10,7 @@
 
 #include "./LU/Local.hpp"
 #include "./LU/Panel.hpp"
+#include "./LU/Tournament.hpp"
 #include "./LU/Full.hpp"
 #include "./LU/Mod.hpp"
 #include "./LU/SolveAfter.hpp"
@@ -60,7 +61,7 @@ void LU( AbstractDistMatrix<F>& APre )
     const Int m = A.Height();
     const Int n = A.Width();
     const Int minDim = Min(m,n);
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>( "LU", g );
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
@@ -116,6 +117,22 @@ void LU( Matrix<F>& A, Permutation& P )
 
     Permutation PB;
 
+    // Recurse on column halves when there is no BLAS for this type
+    if( !IsBlasScalar<F>::value )
+    {
+        const IR ind1( 0, minDim ), ind2( minDim, END );
+        auto AL = A( ALL, ind1 );
+        lu::RecursivePanel( AL, P, PB, 0 );
+        if( n > minDim )
+        {
+            // The matrix is wide, so only a triangular solve remains
+            auto AR = A( ALL, ind2 );
+            PB.PermuteRows( AR );
+            Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), A( ind1, ind1 ), AR );
+        }
+        return;
+    }
+
     // Temporaries for accumulating partial permutations for each block
     for( Int k=0; k<minDim; k+=bsize )
     {
@@ -152,7 +169,10 @@ void LU
 }
 
 template<typename F>
-void LU( AbstractDistMatrix<F>& APre, DistPermutation& P )
+void LU
+( AbstractDistMatrix<F>& APre,
+  DistPermutation& P,
+  const LUCtrl& ctrl )
 {
     EL_DEBUG_CSE
 
@@ -160,8 +180,6 @@ void LU( AbstractDistMatrix<F>& APre, DistPermutation& P )
     auto& A = AProx.Get();
 
     const Grid& g = A.Grid();
-    DistMatrix<F,  STAR,STAR> A11_STAR_STAR(g);
-    DistMatrix<F,  MC,  STAR> A21_MC_STAR(g);
     DistMatrix<F,  STAR,VR  > A12_STAR_VR(g);
     DistMatrix<F,  STAR,MR  > A12_STAR_MR(g);
 
@@ -173,10 +191,68 @@ void LU( AbstractDistMatrix<F>& APre, DistPermutation& P )
     P.MakeIdentity( m );
     P.ReserveSwaps( minDim );
 
-    DistPermutation PB(g);
-
-    vector<F> panelBuf, pivotBuf;
-    const Int bsize = Blocksize();
+    // With lookahead, the next panel is gathered while the current panel is
+    // still needed for the remainder of the trailing update, and so two sets
+    // of panel buffers are alternated between
+    DistMatrix<F,  STAR,STAR> A11_STAR_STAR(g), A11Next_STAR_STAR(g);
+    DistMatrix<F,  MC,  STAR> A21_MC_STAR(g), A21Next_MC_STAR(g);
+    DistMatrix<F,  MC,  STAR> AB1_MC_STAR(g);
+    DistPermutation PB(g), PBNext(g);
+    vector<F> panelBuf, panelBufNext, pivotBuf;
+    copy::PendingAllGather<F> panelGather;
+
+    const Int bsize = TunedBlocksize<F>( "LU", g );
+    auto attachPanel =
+      [&]( Int k, vector<F>& buf,
+           DistMatrix<F,STAR,STAR>& APan11, DistMatrix<F,MC,STAR>& APan21 )
+      {
+          const Int nb = Min(bsize,minDim-k);
+          auto A21 = A( IR(k+nb,END), IR(k,k+nb) );
+          const Int panelLDim = nb+A21.LocalHeight();
+          APan11.Attach( nb, nb, g, 0, 0, &buf[0], panelLDim, 0 );
+          APan21.Attach
+          ( A21.Height(), nb, g, A21.ColAlign(), 0, &buf[nb], panelLDim, 0 );
+      };
+    // Post a non-blocking AllGather of the k'th panel over the process rows
+    auto startPanel =
+      [&]( Int k )
+      {
+          const Int nb = Min(bsize,minDim-k);
+          auto AB1 = A( IR(k,END), IR(k,k+nb) );
+          copy::StartRowAllGather( AB1, panelGather );
+      };
+    // Factor the k'th panel, waiting on its AllGather if it was started
+    auto factorPanel =
+      [&]( Int k, vector<F>& buf,
+           DistMatrix<F,STAR,STAR>& APan11, DistMatrix<F,MC,STAR>& APan21,
+           DistPermutation& PPan, bool started )
+      {
+          const Int nb = Min(bsize,minDim-k);
+          auto A11 = A( IR(k,k+nb), IR(k,k+nb) );
+          auto A21 = A( IR(k+nb,END), IR(k,k+nb) );
+          FastResize( buf, (nb+A21.LocalHeight())*nb );
+          attachPanel( k, buf, APan11, APan21 );
+          if( started )
+          {
+              auto AB1 = A( IR(k,END), IR(k,k+nb) );
+              AB1_MC_STAR.AlignWith( AB1 );
+              copy::FinishRowAllGather( AB1, panelGather, AB1_MC_STAR );
+              APan11 = AB1_MC_STAR( IR(0,nb), ALL );
+              APan21 = AB1_MC_STAR( IR(nb,END), ALL );
+          }
+          else
+          {
+              APan11 = A11;
+              APan21 = A21;
+          }
+          if( ctrl.panelPivot == LU_PANEL_TOURNAMENT )
+              lu::TournamentPanel( APan11, APan21, P, PPan, k );
+          else
+              lu::Panel( APan11, APan21, P, PPan, k, pivotBuf );
+      };
+
+    if( minDim > 0 )
+        factorPanel( 0, panelBuf, A11_STAR_STAR, A21_MC_STAR, PB, false );
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
@@ -189,18 +265,6 @@ void LU( AbstractDistMatrix<F>& APre, DistPermutation& P )
 
         auto AB  = A( indB, ALL );
 
-        const Int A21Height = A21.Height();
-        const Int A21LocHeight = A21.LocalHeight();
-        const Int panelLDim = nb+A21LocHeight;
-        FastResize( panelBuf, panelLDim*nb );
-        A11_STAR_STAR.Attach
-        ( nb, nb, g, 0, 0, &panelBuf[0], panelLDim, 0 );
-        A21_MC_STAR.Attach
-        ( A21Height, nb, g, A21.ColAlign(), 0, &panelBuf[nb], panelLDim, 0 );
-        A11_STAR_STAR = A11;
-        A21_MC_STAR = A21;
-        lu::Panel( A11_STAR_STAR, A21_MC_STAR, P, PB, k, pivotBuf );
-
         PB.PermuteRows( AB );
 
         // Perhaps we should give up perfectly distributing this operation since
@@ -212,11 +276,54 @@ void LU( AbstractDistMatrix<F>& APre, DistPermutation& P )
 
         A12_STAR_MR.AlignWith( A22 );
         A12_STAR_MR = A12_STAR_VR;
-        LocalGemm( NORMAL, NORMAL, F(-1), A21_MC_STAR, A12_STAR_MR, F(1), A22 );
+
+        const Int kNext = k + nb;
+        const bool lookahead = ctrl.lookahead > 0 && kNext < minDim;
+        if( lookahead )
+        {
+            // Update the columns of the next few panels first so that the
+            // AllGather of the next panel can overlap with the bulk of the
+            // trailing update
+            const Int lookaheadWidth = Min( ctrl.lookahead*bsize, n-kNext );
+            const IR indL( 0, lookaheadWidth ), indR( lookaheadWidth, END );
+            auto A12L_STAR_MR = A12_STAR_MR( ALL, indL );
+            auto A12R_STAR_MR = A12_STAR_MR( ALL, indR );
+            auto A22L = A22( ALL, indL );
+            auto A22R = A22( ALL, indR );
+
+            LocalGemm
+            ( NORMAL, NORMAL, F(-1), A21_MC_STAR, A12L_STAR_MR, F(1), A22L );
+            startPanel( kNext );
+            LocalGemm
+            ( NORMAL, NORMAL, F(-1), A21_MC_STAR, A12R_STAR_MR, F(1), A22R );
+            factorPanel
+            ( kNext, panelBufNext, A11Next_STAR_STAR, A21Next_MC_STAR,
+              PBNext, true );
+        }
+        else
+        {
+            LocalGemm
+            ( NORMAL, NORMAL, F(-1), A21_MC_STAR, A12_STAR_MR, F(1), A22 );
+        }
 
         A11 = A11_STAR_STAR;
         A12 = A12_STAR_MR;
         A21 = A21_MC_STAR;
+
+        // The row swaps of the next panel are only applied to the rest of the
+        // matrix at the beginning of the next iteration so that the
+        // remainder of the trailing update above could use the current panel
+        if( lookahead )
+        {
+            std::swap( panelBuf, panelBufNext );
+            attachPanel( kNext, panelBuf, A11_STAR_STAR, A21_MC_STAR );
+            PB = PBNext;
+        }
+        else if( kNext < minDim )
+        {
+            factorPanel
+            ( kNext, panelBuf, A11_STAR_STAR, A21_MC_STAR, PB, false );
+        }
     }
 }
 
@@ -239,7 +346,8 @@ void LU
     Permutation& P ); \
   template void LU \
   ( AbstractDistMatrix<F>& A, \
-    DistPermutation& P ); \
+    DistPermutation& P, \
+    const LUCtrl& ctrl ); \
   template void LU \
   ( Matrix<F>& A, \
     Permutation& P, \
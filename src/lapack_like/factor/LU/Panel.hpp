@@ -59,6 +59,49 @@ void Panel( Matrix<F>& A, Permutation& P, Permutation& PB, Int offset )
     }
 }
 
+// A recursive (cache-oblivious) alternative to the above which splits the
+// panel in half by columns, so that nearly all of the work is cast into Trsm
+// and Gemm at every scale
+template<typename F>
+void RecursivePanel
+( Matrix<F>& A, Permutation& P, Permutation& PB, Int offset )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    EL_DEBUG_ONLY(
+      if( m < n )
+          LogicError("Must be a column panel");
+    )
+    if( n <= 16 )
+    {
+        Panel( A, P, PB, offset );
+        return;
+    }
+    const Int n1 = n/2;
+    const Range<Int> ind1( 0, n1 ), ind2( n1, END );
+
+    auto AL  = A( ALL,  ind1 );
+    auto AR  = A( ALL,  ind2 );
+    auto A11 = A( ind1, ind1 );
+    auto A12 = A( ind1, ind2 );
+    auto A21 = A( ind2, ind1 );
+    auto A22 = A( ind2, ind2 );
+
+    Permutation PL, PR;
+    RecursivePanel( AL, P, PL, offset );
+    PL.PermuteRows( AR );
+    Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), A11, A12 );
+    Gemm( NORMAL, NORMAL, F(-1), A21, A12, F(1), A22 );
+    RecursivePanel( A22, P, PR, offset+n1 );
+    PR.PermuteRows( A21 );
+
+    PB.MakeIdentity( m );
+    PB.ReserveSwaps( n );
+    PB.SwapSequence( PL );
+    PB.SwapSequence( PR, n1 );
+}
+
 // NOTE: It is assumed that the local buffers of A[*,*] and B[MC,*] can be
 //       verticially stacked, so that the top-left local entry of B is 
 //       the n'th local entry of A[*,*]'s local buffer.
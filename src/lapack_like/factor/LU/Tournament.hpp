@@ -0,0 +1,275 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LU_TOURNAMENT_HPP
+#define EL_LU_TOURNAMENT_HPP
+
+namespace El {
+namespace lu {
+
+// Tournament pivoting for communication-avoiding LU (CALU), following
+//
+//   L. Grigori, J. Demmel, and H. Xiang,
+//   "CALU: A communication optimal LU factorization algorithm",
+//   SIAM J. Matrix Anal. Appl., Vol. 32, No. 4, pp. 1317--1350, 2011.
+//
+// Rather than performing an allreduce and a row swap for each column of the
+// panel, each process selects nb candidate pivot rows from its local rows via
+// Gaussian elimination with partial pivoting (GEPP), and the candidate sets
+// are then merged in pairs up a binary tree over the process column. The nb
+// rows which win at the root are broadcast, swapped to the top of the panel,
+// and the panel is factored without further pivoting. This requires
+// O(log p) messages per panel rather than O(nb log p).
+
+namespace tournament {
+
+// Reorder the rows of the m x n matrix C (and the corresponding entries of
+// 'inds') so that its leading Min(m,n) rows are the pivot rows chosen by GEPP.
+// Unlike a standard LU, a column without a nonzero candidate does not abort
+// the selection. The number of selected rows is returned.
+template<typename F>
+Int Select( Matrix<F>& C, vector<Int>& inds )
+{
+    EL_DEBUG_CSE
+    const Int m = C.Height();
+    const Int n = C.Width();
+    const Int numSelected = Min(m,n);
+
+    Matrix<F> W( C );
+    F* CBuf = C.Buffer();
+    F* WBuf = W.Buffer();
+    const Int CLDim = C.LDim();
+    const Int WLDim = W.LDim();
+    for( Int k=0; k<numSelected; ++k )
+    {
+        const Int iPiv = k + blas::MaxInd( m-k, &WBuf[k+k*WLDim], 1 );
+        if( iPiv != k )
+        {
+            blas::Swap( n, &WBuf[k], WLDim, &WBuf[iPiv], WLDim );
+            blas::Swap( n, &CBuf[k], CLDim, &CBuf[iPiv], CLDim );
+            std::swap( inds[k], inds[iPiv] );
+        }
+
+        const F alpha = WBuf[k+k*WLDim];
+        if( alpha == F(0) )
+            continue;
+        blas::Scal( m-(k+1), F(1)/alpha, &WBuf[(k+1)+k*WLDim], 1 );
+        blas::Geru
+        ( m-(k+1), n-(k+1), F(-1),
+          &WBuf[(k+1)+k*WLDim], 1, &WBuf[k+(k+1)*WLDim], WLDim,
+          &WBuf[(k+1)+(k+1)*WLDim], WLDim );
+    }
+    return numSelected;
+}
+
+// Keep only the leading 'numSelected' candidates
+template<typename F>
+void Shrink( Matrix<F>& C, vector<Int>& inds, Int numSelected )
+{
+    EL_DEBUG_CSE
+    Matrix<F> CWinners;
+    CWinners = C( IR(0,numSelected), ALL );
+    C = CWinners;
+    inds.resize( numSelected );
+}
+
+// Pack the candidates as a count followed by the indices, and the values of
+// the candidate rows (stored column-major)
+template<typename F>
+void Pack
+( const Matrix<F>& C, const vector<Int>& inds,
+  vector<Int>& indBuf, vector<F>& valBuf )
+{
+    EL_DEBUG_CSE
+    const Int count = C.Height();
+    const Int n = C.Width();
+    indBuf.resize( n+1 );
+    indBuf[0] = count;
+    for( Int i=0; i<count; ++i )
+        indBuf[i+1] = inds[i];
+    valBuf.resize( count*n );
+    lapack::Copy
+    ( 'A', count, n, C.LockedBuffer(), C.LDim(), valBuf.data(), count );
+}
+
+// Merge the candidates up a binary tree whose root is process 0 of 'comm'.
+// Only the root holds the winning candidates on exit.
+template<typename F>
+void Reduce( Matrix<F>& C, vector<Int>& inds, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+    const Int n = C.Width();
+
+    vector<Int> indBuf;
+    vector<F> valBuf;
+    for( int stride=1; stride<commSize; stride*=2 )
+    {
+        if( commRank % (2*stride) == stride )
+        {
+            // Send our candidates to our parent and drop out
+            const int parent = commRank - stride;
+            Pack( C, inds, indBuf, valBuf );
+            mpi::Send( indBuf.data(), n+1, parent, comm );
+            mpi::Send( valBuf.data(), C.Height()*n, parent, comm );
+            return;
+        }
+        else if( commRank+stride < commSize )
+        {
+            // Stack our child's candidates below ours and play the match
+            const int child = commRank + stride;
+            indBuf.resize( n+1 );
+            mpi::Recv( indBuf.data(), n+1, child, comm );
+            const Int count = indBuf[0];
+            valBuf.resize( count*n );
+            mpi::Recv( valBuf.data(), count*n, child, comm );
+
+            const Int oldCount = C.Height();
+            Matrix<F> CStack( oldCount+count, n );
+            lapack::Copy
+            ( 'A', oldCount, n, C.LockedBuffer(), C.LDim(),
+              CStack.Buffer(), CStack.LDim() );
+            lapack::Copy
+            ( 'A', count, n, valBuf.data(), count,
+              CStack.Buffer(oldCount,0), CStack.LDim() );
+            inds.resize( oldCount+count );
+            for( Int i=0; i<count; ++i )
+                inds[oldCount+i] = indBuf[i+1];
+
+            const Int numSelected = Select( CStack, inds );
+            Shrink( CStack, inds, numSelected );
+            C = CStack;
+        }
+    }
+}
+
+} // namespace tournament
+
+// NOTE: The same conventions as the partially-pivoted distributed Panel are
+//       followed: A[*,*] holds the top nb x nb block of the panel and
+//       B[MC,*] holds the remainder, and on exit they respectively hold
+//       the unit-lower and upper triangular factors of the top block and
+//       the remainder of the lower-triangular factor.
+template<typename F>
+void TournamentPanel
+( DistMatrix<F,STAR,STAR>& A,
+  DistMatrix<F,MC,  STAR>& B,
+  DistPermutation& P,
+  DistPermutation& PB,
+  Int offset )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Width();
+    const Int BLocHeight = B.LocalHeight();
+    mpi::Comm colComm = B.ColComm();
+    const int colRank = B.ColRank();
+    Matrix<F>& ALoc = A.Matrix();
+    Matrix<F>& BLoc = B.Matrix();
+    EL_DEBUG_ONLY(
+      AssertSameGrids( A, B );
+      if( A.Height() != n )
+          LogicError("A must be square");
+      if( n != B.Width() )
+          LogicError("A and B must be the same width");
+    )
+
+    PB.MakeIdentity( A.Height()+B.Height() );
+    PB.ReserveSwaps( n );
+
+    // Select the local candidates. Since A is replicated, only the first
+    // process in each column enters its rows into the tournament.
+    const Int numTopRows = ( colRank == 0 ? n : 0 );
+    Matrix<F> C( numTopRows+BLocHeight, n );
+    vector<Int> inds( numTopRows+BLocHeight );
+    lapack::Copy
+    ( 'A', numTopRows, n, ALoc.LockedBuffer(), ALoc.LDim(),
+      C.Buffer(), C.LDim() );
+    lapack::Copy
+    ( 'A', BLocHeight, n, BLoc.LockedBuffer(), BLoc.LDim(),
+      C.Buffer(numTopRows,0), C.LDim() );
+    for( Int i=0; i<numTopRows; ++i )
+        inds[i] = i;
+    for( Int iLoc=0; iLoc<BLocHeight; ++iLoc )
+        inds[numTopRows+iLoc] = n + B.GlobalRow(iLoc);
+    const Int numSelected = tournament::Select( C, inds );
+    tournament::Shrink( C, inds, numSelected );
+
+    // Play the tournament and broadcast the winners
+    tournament::Reduce( C, inds, colComm );
+    vector<Int> indBuf;
+    vector<F> valBuf;
+    if( colRank == 0 )
+        tournament::Pack( C, inds, indBuf, valBuf );
+    indBuf.resize( n+1 );
+    mpi::Broadcast( indBuf.data(), n+1, 0, colComm );
+    const Int numWinners = indBuf[0];
+    if( numWinners != n )
+        LogicError("Tournament only produced ",numWinners," of ",n," pivots");
+    valBuf.resize( n*n );
+    mpi::Broadcast( valBuf.data(), n*n, 0, colComm );
+
+    // Translate the winners into a sequence of swaps, keeping track of the
+    // original row that lands in each modified position. Since row k is
+    // final after step k, the rows swapped into the bottom portion always
+    // originate from the (replicated) top portion.
+    std::map<Int,Int> origOfPos, posOfOrig;
+    auto origAt =
+      [&]( Int pos )
+      {
+          auto it = origOfPos.find( pos );
+          return it == origOfPos.end() ? pos : it->second;
+      };
+    auto posOf =
+      [&]( Int orig )
+      {
+          auto it = posOfOrig.find( orig );
+          return it == posOfOrig.end() ? orig : it->second;
+      };
+    for( Int k=0; k<n; ++k )
+    {
+        const Int iPiv = posOf( indBuf[k+1] );
+        P.Swap( k+offset, iPiv+offset );
+        PB.Swap( k, iPiv );
+
+        const Int origK = origAt( k );
+        const Int origPiv = origAt( iPiv );
+        origOfPos[k] = origPiv;
+        origOfPos[iPiv] = origK;
+        posOfOrig[origPiv] = k;
+        posOfOrig[origK] = iPiv;
+    }
+
+    // Overwrite the bottom rows that were swapped with rows of the top block
+    for( const auto& entry : origOfPos )
+    {
+        const Int pos = entry.first;
+        const Int orig = entry.second;
+        if( pos < n || pos == orig || !B.IsLocalRow(pos-n) )
+            continue;
+        EL_DEBUG_ONLY(
+          if( orig >= n )
+              LogicError("Bottom row was swapped with another bottom row");
+        )
+        const Int iLoc = B.LocalRow(pos-n);
+        blas::Copy
+        ( n, ALoc.LockedBuffer(orig,0), ALoc.LDim(),
+             BLoc.Buffer(iLoc,0), BLoc.LDim() );
+    }
+
+    // Overwrite the top block with the winners and factor without pivoting
+    lapack::Copy
+    ( 'A', n, n, valBuf.data(), n, ALoc.Buffer(), ALoc.LDim() );
+    lu::Unb( ALoc );
+    Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), ALoc, BLoc );
+}
+
+} // namespace lu
+} // namespace El
+
+#endif // ifndef EL_LU_TOURNAMENT_HPP
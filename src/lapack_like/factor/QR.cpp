@@ -75,6 +75,17 @@ void QR
     qr::Householder( A, householderScalars, signature );
 }
 
+template<typename F>
+void QR
+( AbstractDistMatrix<F>& A,
+  AbstractDistMatrix<F>& householderScalars,
+  AbstractDistMatrix<Base<F>>& signature,
+  const QRCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    qr::Householder( A, householderScalars, signature, ctrl );
+}
+
 // Variants which perform (Businger-Golub) column-pivoting
 // =======================================================
 
@@ -112,6 +123,11 @@ void QR
     AbstractDistMatrix<F>& householderScalars, \
     AbstractDistMatrix<Base<F>>& signature ); \
   template void QR \
+  ( AbstractDistMatrix<F>& A, \
+    AbstractDistMatrix<F>& householderScalars, \
+    AbstractDistMatrix<Base<F>>& signature, \
+    const QRCtrl<Base<F>>& ctrl ); \
+  template void QR \
   ( Matrix<F>& A, \
     Matrix<F>& householderScalars, \
     Matrix<Base<F>>& signature, \
@@ -11,10 +11,49 @@
 
 #include "./ApplyQ.hpp"
 #include "./PanelHouseholder.hpp"
+#include "./PanelTSQR.hpp"
 
 namespace El {
 namespace qr {
 
+// A recursive (cache-oblivious) alternative to the blocked algorithm below
+// which splits A in half by columns, so that nearly all of the work is cast
+// into the (blocked) application of the left half's reflectors
+template<typename F>
+void
+RecursiveHouseholder
+( Matrix<F>& A,
+  Matrix<F>& householderScalars,
+  Matrix<Base<F>>& signature )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    householderScalars.Resize( minDim, 1 );
+    signature.Resize( minDim, 1 );
+    if( n <= 16 )
+    {
+        PanelHouseholder( A, householderScalars, signature );
+        return;
+    }
+
+    const Int n1 = n/2;
+    auto AL = A( ALL, IR(0,n1) );
+    auto AR = A( ALL, IR(n1,END) );
+    auto householderScalars1 = householderScalars( IR(0,Min(n1,m)), ALL );
+    auto sig1 = signature( IR(0,Min(n1,m)), ALL );
+    RecursiveHouseholder( AL, householderScalars1, sig1 );
+    ApplyQ( LEFT, ADJOINT, AL, householderScalars1, sig1, AR );
+    if( m > n1 )
+    {
+        auto A22 = A( IR(n1,END), IR(n1,END) );
+        auto householderScalars2 = householderScalars( IR(n1,END), ALL );
+        auto sig2 = signature( IR(n1,END), ALL );
+        RecursiveHouseholder( A22, householderScalars2, sig2 );
+    }
+}
+
 template<typename F>
 void
 Householder
@@ -29,6 +68,13 @@ Householder
     householderScalars.Resize( minDim, 1 );
     signature.Resize( minDim, 1 );
 
+    // Non-BLAS types use the recursive variant above
+    if( !IsBlasScalar<F>::value )
+    {
+        RecursiveHouseholder( A, householderScalars, signature );
+        return;
+    }
+
     const Int bsize = Blocksize();
     for( Int k=0; k<minDim; k+=bsize )
     {
@@ -53,7 +99,8 @@ void
 Householder
 ( AbstractDistMatrix<F>& APre,
   AbstractDistMatrix<F>& householderScalarsPre,
-  AbstractDistMatrix<Base<F>>& signaturePre )
+  AbstractDistMatrix<Base<F>>& signaturePre,
+  const QRCtrl<Base<F>>& ctrl=QRCtrl<Base<F>>() )
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(AssertSameGrids( APre, householderScalarsPre, signaturePre ))
@@ -86,7 +133,10 @@ Householder
         auto householderScalars1 = householderScalars( ind1, ALL );
         auto sig1 = signature( ind1, ALL );
 
-        PanelHouseholder( AB1, householderScalars1, sig1 );
+        if( ctrl.panel == QR_PANEL_TSQR )
+            PanelTSQR( AB1, householderScalars1, sig1 );
+        else
+            PanelHouseholder( AB1, householderScalars1, sig1 );
         ApplyQ( LEFT, ADJOINT, AB1, householderScalars1, sig1, AB2 );
     }
 }
@@ -0,0 +1,119 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_QR_PANEL_TSQR_HPP
+#define EL_QR_PANEL_TSQR_HPP
+
+#include "./PanelHouseholder.hpp"
+#include "./TS.hpp"
+
+namespace El {
+namespace qr {
+
+// Communication-avoiding QR (CAQR) panel factorization: the panel is factored
+// via TSQR over the process column, which requires O(log p) messages rather
+// than the O(n log p) of the column-by-column Householder panel, and the
+// explicit orthogonal factor is then converted back into the standard
+// Householder representation so that the trailing update (and any later
+// application of Q) can proceed with the usual blocked reflectors.
+//
+// The Householder reconstruction follows
+//
+//   G. Ballard, J. Demmel, L. Grigori, M. Jacquelin, H.D. Nguyen, and
+//   E. Solomonik,
+//   "Reconstructing Householder vectors from tall-skinny QR",
+//   Proc. IEEE IPDPS, pp. 1159--1170, 2014.
+//
+// If Q is the m x n explicit orthogonal factor and S is a diagonal matrix of
+// signs chosen opposite to those of the real part of diag(Q), then the
+// unpivoted LU factorization Q - [S; 0] = Y U is stable, Y is the unit
+// lower-trapezoidal matrix of Householder vectors, and the j'th Householder
+// scalar is -S(j) conj(U(j,j)). Since A = (I - Y T Y^H)[I; 0] S R, S serves
+// as the signature and the R from TSQR is left unchanged.
+//
+// NOTE: TSQR requires a power-of-two number of process rows and at least
+//       as many rows per process as the panel has columns; otherwise we
+//       fall back to the classical panel factorization.
+
+template<typename F>
+void PanelTSQR
+( DistMatrix<F>& A,
+  AbstractDistMatrix<F>& householderScalars,
+  AbstractDistMatrix<Base<F>>& signature )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(AssertSameGrids( A, householderScalars, signature ))
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int p = g.Height();
+    if( !PowerOfTwo(p) || m < p*n || n == 0 )
+    {
+        PanelHouseholder( A, householderScalars, signature );
+        return;
+    }
+
+    if( householderScalars.Height() != n || householderScalars.Width() != 1 )
+        LogicError("Unexpected size of householderScalars");
+    if( signature.Height() != n || signature.Width() != 1 )
+        LogicError("Unexpected size of signature");
+
+    // Overwrite a copy of the panel with its explicit Q factor and
+    // redundantly store the R factor
+    DistMatrix<F,MC,STAR> Y(g);
+    Y.AlignWith( A );
+    Y = A;
+    Matrix<F> R( n, n, n );
+    {
+        auto treeData = TS( Y );
+        if( Y.ColRank() == 0 )
+        {
+            const auto& RootQR = ts::RootQR( Y, treeData );
+            lapack::Copy
+            ( 'A', n, n, RootQR.LockedBuffer(), RootQR.LDim(),
+              R.Buffer(), R.LDim() );
+        }
+        mpi::Broadcast( R.Buffer(), n*n, 0, Y.ColComm() );
+        ts::FormQ( Y, treeData );
+    }
+
+    // Compute Q1 - S = Y1 U
+    DistMatrix<F,STAR,STAR> Q1( Y(IR(0,n),ALL) );
+    Matrix<F>& Q1Loc = Q1.Matrix();
+    Matrix<Real> sgn( n, 1 );
+    for( Int j=0; j<n; ++j )
+    {
+        sgn(j) = ( RealPart(Q1Loc(j,j)) >= Real(0) ? Real(-1) : Real(1) );
+        Q1Loc(j,j) -= sgn(j);
+    }
+    LU( Q1Loc );
+
+    // Y2 := Q2 inv(U)
+    auto Y2 = Y( IR(n,END), ALL );
+    Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), Q1Loc, Y2.Matrix() );
+
+    for( Int j=0; j<n; ++j )
+    {
+        householderScalars.Set( j, 0, -sgn(j)*Conj(Q1Loc(j,j)) );
+        signature.Set( j, 0, sgn(j) );
+    }
+
+    // Pack R above the strictly lower-triangular portion of Y1
+    MakeTrapezoidal( LOWER, Q1Loc, -1 );
+    MakeTrapezoidal( UPPER, R );
+    Axpy( F(1), R, Q1Loc );
+    auto Y1 = Y( IR(0,n), ALL );
+    Y1 = Q1;
+    A = Y;
+}
+
+} // namespace qr
+} // namespace El
+
+#endif // ifndef EL_QR_PANEL_TSQR_HPP
@@ -0,0 +1,305 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#include "../../blas_like/level3/Batched/Util.hpp"
+#include "../factor/Batched/Cholesky.hpp"
+#include "../factor/Batched/LU.hpp"
+
+namespace El {
+
+namespace batched {
+
+// Overwrite the interleaved n x numRHS matrices B with inv(L) B, where L is
+// the lower triangle of the interleaved n x n matrices in A
+template<typename Field>
+void InterleavedLowerSolve
+( Int n, Int numRHS, bool unitDiag,
+  const vector<Field>& A, vector<Field>& B )
+{
+    const Int W = INTERLEAVE_WIDTH;
+    for( Int j=0; j<numRHS; ++j )
+    {
+        for( Int k=0; k<n; ++k )
+        {
+            Field* beta_k = &B[(k+j*n)*W];
+            if( !unitDiag )
+            {
+                const Field* alpha11 = &A[(k+k*n)*W];
+                EL_SIMD
+                for( Int l=0; l<W; ++l )
+                    beta_k[l] /= alpha11[l];
+            }
+            for( Int i=k+1; i<n; ++i )
+            {
+                const Field* alpha21 = &A[(i+k*n)*W];
+                Field* beta_i = &B[(i+j*n)*W];
+                EL_SIMD
+                for( Int l=0; l<W; ++l )
+                    beta_i[l] -= alpha21[l]*beta_k[l];
+            }
+        }
+    }
+}
+
+// Overwrite the interleaved n x numRHS matrices B with inv(L)^H B, where L is
+// the lower triangle of the interleaved n x n matrices in A
+template<typename Field>
+void InterleavedLowerAdjointSolve
+( Int n, Int numRHS, const vector<Field>& A, vector<Field>& B )
+{
+    const Int W = INTERLEAVE_WIDTH;
+    for( Int j=0; j<numRHS; ++j )
+    {
+        for( Int k=n-1; k>=0; --k )
+        {
+            Field* beta_k = &B[(k+j*n)*W];
+            for( Int i=k+1; i<n; ++i )
+            {
+                const Field* alpha_ik = &A[(i+k*n)*W];
+                const Field* beta_i = &B[(i+j*n)*W];
+                EL_SIMD
+                for( Int l=0; l<W; ++l )
+                    beta_k[l] -= Conj(alpha_ik[l])*beta_i[l];
+            }
+            const Field* alpha11 = &A[(k+k*n)*W];
+            EL_SIMD
+            for( Int l=0; l<W; ++l )
+                beta_k[l] /= Conj(alpha11[l]);
+        }
+    }
+}
+
+// Overwrite the interleaved n x numRHS matrices B with inv(U) B, where U is
+// the upper triangle of the interleaved n x n matrices in A
+template<typename Field>
+void InterleavedUpperSolve
+( Int n, Int numRHS, const vector<Field>& A, vector<Field>& B )
+{
+    const Int W = INTERLEAVE_WIDTH;
+    for( Int j=0; j<numRHS; ++j )
+    {
+        for( Int k=n-1; k>=0; --k )
+        {
+            Field* beta_k = &B[(k+j*n)*W];
+            const Field* alpha11 = &A[(k+k*n)*W];
+            EL_SIMD
+            for( Int l=0; l<W; ++l )
+                beta_k[l] /= alpha11[l];
+            for( Int i=0; i<k; ++i )
+            {
+                const Field* alpha01 = &A[(i+k*n)*W];
+                Field* beta_i = &B[(i+j*n)*W];
+                EL_SIMD
+                for( Int l=0; l<W; ++l )
+                    beta_i[l] -= alpha01[l]*beta_k[l];
+            }
+        }
+    }
+}
+
+// Apply the row swaps from InterleavedLU to the interleaved n x numRHS B
+template<typename Field>
+void InterleavedApplyPivots
+( Int n, Int numRHS, const vector<Int>& pivots, vector<Field>& B )
+{
+    const Int W = INTERLEAVE_WIDTH;
+    const Int minDim = pivots.size()/W;
+    for( Int k=0; k<minDim; ++k )
+        for( Int l=0; l<W; ++l )
+        {
+            const Int iPiv = pivots[k*W+l];
+            if( iPiv != k )
+                for( Int j=0; j<numRHS; ++j )
+                    std::swap( B[(k+j*n)*W+l], B[(iPiv+j*n)*W+l] );
+        }
+}
+
+template<typename Field>
+void CheckSystems
+( const vector<Matrix<Field>>& A, const vector<Matrix<Field>>& B )
+{
+    EL_DEBUG_CSE
+    const Int batchSize = A.size();
+    if( Int(B.size()) != batchSize )
+        LogicError("A and B must have the same batch size");
+    for( Int b=0; b<batchSize; ++b )
+    {
+        if( A[b].Height() != A[b].Width() )
+            LogicError("Problem ",b," of the batch was not square");
+        if( A[b].Height() != B[b].Height() )
+            LogicError("A and B of problem ",b," were not conformal");
+    }
+}
+
+} // namespace batched
+
+template<typename Field>
+void BatchedLinearSolve
+( const vector<Matrix<Field>>& A,
+        vector<Matrix<Field>>& B )
+{
+    EL_DEBUG_CSE
+    batched::CheckSystems( A, B );
+    const Int batchSize = A.size();
+    const Int W = batched::INTERLEAVE_WIDTH;
+    const Int numGroups = (batchSize+W-1)/W;
+    vector<Int> failed( batchSize, 0 );
+    vector<std::exception_ptr> errors( batchSize );
+    EL_PARALLEL_FOR
+    for( Int group=0; group<numGroups; ++group )
+    {
+        const Int offset = group*W;
+        const Int numLanes = Min(W,batchSize-offset);
+        if( batched::Interleavable( A, offset, numLanes ) &&
+            batched::SameSizes( B, offset, numLanes ) )
+        {
+            const Int n = A[offset].Height();
+            const Int numRHS = B[offset].Width();
+            vector<Field> ABuf, BBuf;
+            vector<Int> pivots;
+            Int groupFailed[batched::INTERLEAVE_WIDTH] = { 0 };
+            batched::Interleave( NORMAL, A, offset, numLanes, ABuf, Field(1) );
+            batched::Interleave( NORMAL, B, offset, numLanes, BBuf );
+            batched::InterleavedLU( n, n, ABuf, pivots, groupFailed );
+            batched::InterleavedApplyPivots( n, numRHS, pivots, BBuf );
+            batched::InterleavedLowerSolve( n, numRHS, true, ABuf, BBuf );
+            batched::InterleavedUpperSolve( n, numRHS, ABuf, BBuf );
+            batched::Deinterleave( NORMAL, BBuf, B, offset, numLanes );
+            for( Int l=0; l<numLanes; ++l )
+                failed[offset+l] = groupFailed[l];
+        }
+        else
+        {
+            for( Int b=offset; b<offset+numLanes; ++b )
+            {
+                try { LinearSolve( A[b], B[b] ); }
+                catch( const SingularMatrixException& ) { failed[b] = 1; }
+                catch( ... ) { errors[b] = std::current_exception(); }
+            }
+        }
+    }
+    batched::RethrowErrors( errors );
+    batched::ReportFailures<SingularMatrixException>( failed, "were singular" );
+}
+
+template<typename Field>
+void BatchedLinearSolve
+( const Matrix<Field>& A,
+        Matrix<Field>& B,
+  Int batchSize )
+{
+    EL_DEBUG_CSE
+    auto AViews = batched::LockedStridedViews( A, batchSize );
+    auto BViews = batched::StridedViews( B, batchSize );
+    BatchedLinearSolve( AViews, BViews );
+}
+
+template<typename Field>
+void BatchedHPDSolve
+( UpperOrLower uplo,
+  Orientation orientation,
+  const vector<Matrix<Field>>& A,
+        vector<Matrix<Field>>& B )
+{
+    EL_DEBUG_CSE
+    batched::CheckSystems( A, B );
+    const Int batchSize = A.size();
+    const Int W = batched::INTERLEAVE_WIDTH;
+    const Int numGroups = (batchSize+W-1)/W;
+    // As in cholesky::SolveAfter, a transposed solve is an untransposed solve
+    // against the conjugated right-hand sides
+    const bool conjugate = ( orientation == TRANSPOSE );
+    // The upper-triangular case is handled by factoring the adjoints
+    const Orientation AOrient = ( uplo == LOWER ? NORMAL : ADJOINT );
+    vector<Int> failed( batchSize, 0 );
+    vector<std::exception_ptr> errors( batchSize );
+    EL_PARALLEL_FOR
+    for( Int group=0; group<numGroups; ++group )
+    {
+        const Int offset = group*W;
+        const Int numLanes = Min(W,batchSize-offset);
+        if( batched::Interleavable( A, offset, numLanes ) &&
+            batched::SameSizes( B, offset, numLanes ) )
+        {
+            const Int n = A[offset].Height();
+            const Int numRHS = B[offset].Width();
+            vector<Field> ABuf, BBuf;
+            Int groupFailed[batched::INTERLEAVE_WIDTH] = { 0 };
+            batched::Interleave( AOrient, A, offset, numLanes, ABuf, Field(1) );
+            batched::Interleave( NORMAL, B, offset, numLanes, BBuf );
+            if( conjugate )
+                for( auto& beta : BBuf )
+                    beta = Conj(beta);
+            batched::InterleavedCholesky( n, ABuf, groupFailed );
+            batched::InterleavedLowerSolve( n, numRHS, false, ABuf, BBuf );
+            batched::InterleavedLowerAdjointSolve( n, numRHS, ABuf, BBuf );
+            if( conjugate )
+                for( auto& beta : BBuf )
+                    beta = Conj(beta);
+            batched::Deinterleave( NORMAL, BBuf, B, offset, numLanes );
+            for( Int l=0; l<numLanes; ++l )
+                failed[offset+l] = groupFailed[l];
+        }
+        else
+        {
+            for( Int b=offset; b<offset+numLanes; ++b )
+            {
+                try { HPDSolve( uplo, orientation, A[b], B[b] ); }
+                catch( const NonHPDMatrixException& ) { failed[b] = 1; }
+                catch( ... ) { errors[b] = std::current_exception(); }
+            }
+        }
+    }
+    batched::RethrowErrors( errors );
+    batched::ReportFailures<NonHPDMatrixException>( failed, "were not HPD" );
+}
+
+template<typename Field>
+void BatchedHPDSolve
+( UpperOrLower uplo,
+  Orientation orientation,
+  const Matrix<Field>& A,
+        Matrix<Field>& B,
+  Int batchSize )
+{
+    EL_DEBUG_CSE
+    auto AViews = batched::LockedStridedViews( A, batchSize );
+    auto BViews = batched::StridedViews( B, batchSize );
+    BatchedHPDSolve( uplo, orientation, AViews, BViews );
+}
+
+#define PROTO(Field) \
+  template void BatchedLinearSolve \
+  ( const vector<Matrix<Field>>& A, \
+          vector<Matrix<Field>>& B ); \
+  template void BatchedLinearSolve \
+  ( const Matrix<Field>& A, \
+          Matrix<Field>& B, \
+    Int batchSize ); \
+  template void BatchedHPDSolve \
+  ( UpperOrLower uplo, \
+    Orientation orientation, \
+    const vector<Matrix<Field>>& A, \
+          vector<Matrix<Field>>& B ); \
+  template void BatchedHPDSolve \
+  ( UpperOrLower uplo, \
+    Orientation orientation, \
+    const Matrix<Field>& A, \
+          Matrix<Field>& B, \
+    Int batchSize );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
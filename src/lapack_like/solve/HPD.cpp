@@ -8,6 +8,8 @@
 */
 #include <El.hpp>
 
+#include "./MixedPrecision.hpp"
+
 namespace El {
 
 namespace hpd_solve {
@@ -42,6 +44,104 @@ void Overwrite
     cholesky::SolveAfter( uplo, orientation, A, B );
 }
 
+// Factor a copy of A in the next-lower precision and refine the solution
+template<typename Field>
+bool MixedPrecision
+( UpperOrLower uplo,
+  Orientation orientation,
+  const Matrix<Field>& A,
+        Matrix<Field>& B,
+  const LinearSolveCtrl<Base<Field>>& ctrl,
+        LinearSolveInfo& info )
+{
+    EL_DEBUG_CSE
+    typedef Demote<Field> FieldLow;
+
+    Matrix<FieldLow> ALow;
+    Copy( A, ALow );
+    try { Cholesky( uplo, ALow ); }
+    catch( NonHPDMatrixException& e ) { return false; }
+
+    // Since A is Hermitian, A^T X = conj(A conj(X))
+    Matrix<Field> XConj;
+    auto applyA =
+      [&]( Field alpha, const Matrix<Field>& X, Field beta, Matrix<Field>& Y )
+      {
+          if( orientation == TRANSPOSE )
+          {
+              Conjugate( X, XConj );
+              Conjugate( Y );
+              Hemm( LEFT, uplo, Conj(alpha), A, XConj, Conj(beta), Y );
+              Conjugate( Y );
+          }
+          else
+              Hemm( LEFT, uplo, alpha, A, X, beta, Y );
+      };
+    Matrix<FieldLow> YLow;
+    auto applyAInv =
+      [&]( Matrix<Field>& Y )
+      {
+          Copy( Y, YLow );
+          cholesky::SolveAfter( uplo, orientation, ALow, YLow );
+          Copy( YLow, Y );
+      };
+    return mixed_solve::Refine<Field>
+      ( applyA, applyAInv, HermitianInfinityNorm(uplo,A), B, ctrl,
+        ctrl.progress, info.numRefineIts );
+}
+
+template<typename Field>
+bool MixedPrecision
+( UpperOrLower uplo,
+  Orientation orientation,
+  const AbstractDistMatrix<Field>& APre,
+        AbstractDistMatrix<Field>& BPre,
+  const LinearSolveCtrl<Base<Field>>& ctrl,
+        LinearSolveInfo& info )
+{
+    EL_DEBUG_CSE
+    typedef Demote<Field> FieldLow;
+
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> BProx( BPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.Get();
+    const Grid& g = A.Grid();
+
+    DistMatrix<FieldLow> ALow(g);
+    Copy( A, ALow );
+    try { Cholesky( uplo, ALow ); }
+    catch( NonHPDMatrixException& e ) { return false; }
+
+    // Since A is Hermitian, A^T X = conj(A conj(X))
+    DistMatrix<Field> XConj(g);
+    auto applyA =
+      [&]( Field alpha, const DistMatrix<Field>& X,
+           Field beta,        DistMatrix<Field>& Y )
+      {
+          if( orientation == TRANSPOSE )
+          {
+              Conjugate( X, XConj );
+              Conjugate( Y );
+              Hemm( LEFT, uplo, Conj(alpha), A, XConj, Conj(beta), Y );
+              Conjugate( Y );
+          }
+          else
+              Hemm( LEFT, uplo, alpha, A, X, beta, Y );
+      };
+    DistMatrix<FieldLow> YLow(g);
+    auto applyAInv =
+      [&]( DistMatrix<Field>& Y )
+      {
+          Copy( Y, YLow );
+          cholesky::SolveAfter( uplo, orientation, ALow, YLow );
+          Copy( YLow, Y );
+      };
+    return mixed_solve::Refine<Field>
+      ( applyA, applyAInv, HermitianInfinityNorm(uplo,A), B, ctrl,
+        ctrl.progress && g.Rank() == 0, info.numRefineIts );
+}
+
 } // namespace hpd_solve
 
 template<typename Field>
@@ -68,6 +168,56 @@ void HPDSolve
     hpd_solve::Overwrite( uplo, orientation, ACopy, B );
 }
 
+template<typename Field>
+LinearSolveInfo HPDSolve
+( UpperOrLower uplo,
+  Orientation orientation,
+  const Matrix<Field>& A,
+        Matrix<Field>& B,
+  const LinearSolveCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    LinearSolveInfo info;
+    if( ctrl.mixedPrecision && !IsSame<Demote<Field>,Field>::value )
+    {
+        if( hpd_solve::MixedPrecision( uplo, orientation, A, B, ctrl, info ) )
+        {
+            info.mixedPrecision = true;
+            return info;
+        }
+        info.fellBack = true;
+        if( ctrl.progress )
+            Output("Falling back to a working-precision factorization");
+    }
+    HPDSolve( uplo, orientation, A, B );
+    return info;
+}
+
+template<typename Field>
+LinearSolveInfo HPDSolve
+( UpperOrLower uplo,
+  Orientation orientation,
+  const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& B,
+  const LinearSolveCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    LinearSolveInfo info;
+    if( ctrl.mixedPrecision && !IsSame<Demote<Field>,Field>::value )
+    {
+        if( hpd_solve::MixedPrecision( uplo, orientation, A, B, ctrl, info ) )
+        {
+            info.mixedPrecision = true;
+            return info;
+        }
+        info.fellBack = true;
+        if( ctrl.progress && A.Grid().Rank() == 0 )
+            Output("Falling back to a working-precision factorization");
+    }
+    HPDSolve( uplo, orientation, A, B );
+    return info;
+}
+
 // TODO(poulson): Add iterative refinement parameter
 template<typename Field>
 void HPDSolve
@@ -119,6 +269,14 @@ void HPDSolve
   template void HPDSolve \
   ( UpperOrLower uplo, Orientation orientation, \
     const AbstractDistMatrix<Field>& A, AbstractDistMatrix<Field>& B ); \
+  template LinearSolveInfo HPDSolve \
+  ( UpperOrLower uplo, Orientation orientation, \
+    const Matrix<Field>& A, Matrix<Field>& B, \
+    const LinearSolveCtrl<Base<Field>>& ctrl ); \
+  template LinearSolveInfo HPDSolve \
+  ( UpperOrLower uplo, Orientation orientation, \
+    const AbstractDistMatrix<Field>& A, AbstractDistMatrix<Field>& B, \
+    const LinearSolveCtrl<Base<Field>>& ctrl ); \
   template void HPDSolve \
   ( const SparseMatrix<Field>& A, Matrix<Field>& B, const BisectCtrl& ctrl ); \
   template void HPDSolve \
@@ -8,6 +8,8 @@
 */
 #include <El.hpp>
 
+#include "./MixedPrecision.hpp"
+
 namespace El {
 
 namespace lu {
@@ -293,6 +295,132 @@ void LinearSolve
     lin_solve::Overwrite( ACopy, B );
 }
 
+namespace lin_solve {
+
+// Factor a copy of A in the next-lower precision and refine the solution
+template<typename Field>
+bool MixedPrecision
+( const Matrix<Field>& A,
+        Matrix<Field>& B,
+  const LinearSolveCtrl<Base<Field>>& ctrl,
+        LinearSolveInfo& info )
+{
+    EL_DEBUG_CSE
+    typedef Demote<Field> FieldLow;
+
+    Matrix<FieldLow> ALow;
+    Copy( A, ALow );
+    Permutation P;
+    try { LU( ALow, P ); }
+    catch( SingularMatrixException& e ) { return false; }
+    if( !limits::IsFinite(MaxNorm(ALow)) )
+        return false;
+
+    auto applyA =
+      [&]( Field alpha, const Matrix<Field>& X, Field beta, Matrix<Field>& Y )
+      { Gemm( NORMAL, NORMAL, alpha, A, X, beta, Y ); };
+    Matrix<FieldLow> YLow;
+    auto applyAInv =
+      [&]( Matrix<Field>& Y )
+      {
+          Copy( Y, YLow );
+          lu::SolveAfter( NORMAL, ALow, P, YLow );
+          Copy( YLow, Y );
+      };
+    return mixed_solve::Refine<Field>
+      ( applyA, applyAInv, InfinityNorm(A), B, ctrl, ctrl.progress,
+        info.numRefineIts );
+}
+
+template<typename Field>
+bool MixedPrecision
+( const AbstractDistMatrix<Field>& APre,
+        AbstractDistMatrix<Field>& BPre,
+  const LinearSolveCtrl<Base<Field>>& ctrl,
+        LinearSolveInfo& info )
+{
+    EL_DEBUG_CSE
+    typedef Demote<Field> FieldLow;
+
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> BProx( BPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.Get();
+    const Grid& g = A.Grid();
+
+    DistMatrix<FieldLow> ALow(g);
+    Copy( A, ALow );
+    DistPermutation P(g);
+    try { LU( ALow, P ); }
+    catch( SingularMatrixException& e ) { return false; }
+    if( !limits::IsFinite(MaxNorm(ALow)) )
+        return false;
+
+    auto applyA =
+      [&]( Field alpha, const DistMatrix<Field>& X,
+           Field beta,        DistMatrix<Field>& Y )
+      { Gemm( NORMAL, NORMAL, alpha, A, X, beta, Y ); };
+    DistMatrix<FieldLow> YLow(g);
+    auto applyAInv =
+      [&]( DistMatrix<Field>& Y )
+      {
+          Copy( Y, YLow );
+          lu::SolveAfter( NORMAL, ALow, P, YLow );
+          Copy( YLow, Y );
+      };
+    return mixed_solve::Refine<Field>
+      ( applyA, applyAInv, InfinityNorm(A), B, ctrl,
+        ctrl.progress && g.Rank() == 0, info.numRefineIts );
+}
+
+} // namespace lin_solve
+
+template<typename Field>
+LinearSolveInfo LinearSolve
+( const Matrix<Field>& A,
+        Matrix<Field>& B,
+  const LinearSolveCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    LinearSolveInfo info;
+    if( ctrl.mixedPrecision && !IsSame<Demote<Field>,Field>::value )
+    {
+        if( lin_solve::MixedPrecision( A, B, ctrl, info ) )
+        {
+            info.mixedPrecision = true;
+            return info;
+        }
+        info.fellBack = true;
+        if( ctrl.progress )
+            Output("Falling back to a working-precision factorization");
+    }
+    LinearSolve( A, B );
+    return info;
+}
+
+template<typename Field>
+LinearSolveInfo LinearSolve
+( const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& B,
+  const LinearSolveCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    LinearSolveInfo info;
+    if( ctrl.mixedPrecision && !IsSame<Demote<Field>,Field>::value )
+    {
+        if( lin_solve::MixedPrecision( A, B, ctrl, info ) )
+        {
+            info.mixedPrecision = true;
+            return info;
+        }
+        info.fellBack = true;
+        if( ctrl.progress && A.Grid().Rank() == 0 )
+            Output("Falling back to a working-precision factorization");
+    }
+    LinearSolve( A, B );
+    return info;
+}
+
 template<typename Field>
 void LinearSolve
 ( const SparseMatrix<Field>& A,
@@ -326,6 +454,14 @@ void LinearSolve
   ( const AbstractDistMatrix<Field>& A, \
           AbstractDistMatrix<Field>& B, \
     bool scalapack ); \
+  template LinearSolveInfo LinearSolve \
+  ( const Matrix<Field>& A, \
+          Matrix<Field>& B, \
+    const LinearSolveCtrl<Base<Field>>& ctrl ); \
+  template LinearSolveInfo LinearSolve \
+  ( const AbstractDistMatrix<Field>& A, \
+          AbstractDistMatrix<Field>& B, \
+    const LinearSolveCtrl<Base<Field>>& ctrl ); \
   template void LinearSolve \
   ( const SparseMatrix<Field>& A, \
           Matrix<Field>& B, \
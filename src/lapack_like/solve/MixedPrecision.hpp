@@ -0,0 +1,224 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SOLVE_MIXED_PRECISION_HPP
+#define EL_SOLVE_MIXED_PRECISION_HPP
+
+// Refinement of the solution of a dense linear system from a factorization
+// computed in a lower precision. See
+//
+//   E. Carson and N.J. Higham,
+//   "Accelerating the solution of linear systems by iterative refinement in
+//    three precisions",
+//   SIAM J. Sci. Comput., Vol. 40, No. 2, pp. A817--A847, 2018.
+//
+// for an analysis of both classical refinement and GMRES-IR.
+
+namespace El {
+namespace mixed_solve {
+
+// In what follows, 'applyA' should be a function of the form
+//
+//   void applyA
+//   ( Field alpha, const MatrixType& X, Field beta, MatrixType& Y )
+//
+// and overwrite Y := alpha A X + beta Y. However, 'applyAInv' should have the
+// form
+//
+//   void applyAInv( MatrixType& B )
+//
+// and overwrite B with the low-precision approximation of inv(A) B. Since
+// only views, norms, inner products, and updates are required, the same
+// implementation is used for both Matrix<Field> and DistMatrix<Field>.
+
+// Approximately solve A d = r using a single cycle of flexible GMRES which is
+// right-preconditioned with the low-precision solve, and overwrite r with d
+template<typename Field,class MatrixType,class ApplyAType,class ApplyAInvType>
+void GMRESCorrection
+( const ApplyAType& applyA,
+  const ApplyAInvType& applyAInv,
+        MatrixType& r,
+        Base<Field> relTol,
+        Int maxIts )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Real beta = FrobeniusNorm( r );
+    if( beta == Real(0) )
+        return;
+
+    // Each Krylov vector is stored separately (rather than as a column of a
+    // single matrix) so that all of them share the distribution of r
+    vector<MatrixType> V( 1, r ), Z;
+    MatrixType w( r );
+    Matrix<Real> cs;
+    Matrix<Field> sn, H, t;
+    Zeros( cs, maxIts, 1 );
+    Zeros( sn, maxIts, 1 );
+    Zeros( H, maxIts+1, maxIts );
+    Zeros( t, maxIts+1, 1 );
+    t(0) = beta;
+
+    V[0] *= 1/beta;
+
+    Int numIts = 0;
+    for( Int j=0; j<maxIts; ++j )
+    {
+        // w := A inv(M) v_j
+        Z.push_back( V[j] );
+        applyAInv( Z[j] );
+        applyA( Field(1), Z[j], Field(0), w );
+
+        // Modified Gram-Schmidt
+        for( Int i=0; i<=j; ++i )
+        {
+            H(i,j) = Dot( V[i], w );
+            Axpy( -H(i,j), V[i], w );
+        }
+        const Real delta = FrobeniusNorm( w );
+        if( !limits::IsFinite(delta) )
+            break;
+
+        // Apply the existing rotations to the new column of H
+        for( Int i=0; i<j; ++i )
+        {
+            const Real& c = cs(i);
+            const Field& s = sn(i);
+            const Field eta_i_j = H(i,j);
+            const Field eta_ip1_j = H(i+1,j);
+            H(i,  j) =  c      *eta_i_j + s*eta_ip1_j;
+            H(i+1,j) = -Conj(s)*eta_i_j + c*eta_ip1_j;
+        }
+
+        // Generate and apply a new rotation
+        Real c;
+        Field s;
+        const Field rho = Givens( H(j,j), Field(delta), c, s );
+        if( rho == Field(0) )
+            break;
+        H(j,j) = rho;
+        cs(j) = c;
+        sn(j) = s;
+        const Field tau_j = t(j);
+        const Field tau_jp1 = t(j+1);
+        t(j)   =  c      *tau_j + s*tau_jp1;
+        t(j+1) = -Conj(s)*tau_j + c*tau_jp1;
+        numIts = j+1;
+
+        if( delta == Real(0) || Abs(t(j+1)) <= relTol*beta )
+            break;
+        V.push_back( w );
+        V[j+1] *= 1/delta;
+    }
+
+    // d := Z y, where y minimizes the projected residual
+    auto y = t( IR(0,numIts), ALL );
+    auto HTL = H( IR(0,numIts), IR(0,numIts) );
+    Trsv( UPPER, NORMAL, NON_UNIT, HTL, y );
+    Zero( r );
+    for( Int i=0; i<numIts; ++i )
+        Axpy( y(i), Z[i], r );
+}
+
+// Overwrite B with the refined solution and return true upon convergence.
+// Otherwise, B is left unchanged and false is returned so that the caller
+// can fall back to a working-precision factorization. In either case, the
+// number of refinement steps is stored in 'numIts'. Progress is only
+// reported if 'progress' is true (e.g., on the root of the grid).
+template<typename Field,class MatrixType,class ApplyAType,class ApplyAInvType>
+bool Refine
+( const ApplyAType& applyA,
+  const ApplyAInvType& applyAInv,
+        Base<Field> ANorm,
+        MatrixType& B,
+  const LinearSolveCtrl<Base<Field>>& ctrl,
+        bool progress,
+        Int& numIts )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = B.Height();
+    const Int numRHS = B.Width();
+    const Real tol = ctrl.relTol*Sqrt(Real(n))*ANorm;
+    const Real gmresRelTol = limits::Epsilon<Base<Demote<Field>>>();
+
+    // Compute the initial guess and its residual
+    MatrixType X(B), R(B);
+    applyAInv( X );
+    applyA( Field(-1), X, Field(1), R );
+
+    vector<Real> lastResidNorms( numRHS, limits::Infinity<Real>() );
+    vector<bool> converged( numRHS, false );
+    for( Int refineIt=0; ; ++refineIt )
+    {
+        numIts = refineIt;
+        bool allConverged = true, stalled = false;
+        Real maxRelResid = 0;
+        for( Int j=0; j<numRHS; ++j )
+        {
+            const Real residNorm = MaxNorm( R(ALL,IR(j)) );
+            const Real solNorm = MaxNorm( X(ALL,IR(j)) );
+            if( !limits::IsFinite(residNorm) || !limits::IsFinite(solNorm) )
+                return false;
+            converged[j] = ( residNorm <= tol*solNorm );
+            if( !converged[j] )
+            {
+                allConverged = false;
+                if( residNorm > ctrl.stallRatio*lastResidNorms[j] )
+                    stalled = true;
+            }
+            lastResidNorms[j] = residNorm;
+            if( solNorm != Real(0) )
+                maxRelResid = Max( maxRelResid, residNorm/(ANorm*solNorm) );
+        }
+        if( progress )
+            Output
+            ("refinement iteration ",refineIt,": max || r ||_max / "
+             "(|| A ||_oo || x ||_max) = ",maxRelResid);
+        if( allConverged )
+        {
+            B = X;
+            return true;
+        }
+        if( stalled || refineIt == ctrl.maxRefineIts )
+        {
+            if( progress )
+                Output
+                (stalled ? "refinement stalled" :
+                           "refinement did not converge");
+            return false;
+        }
+
+        // Compute and apply the correction
+        if( ctrl.gmres )
+        {
+            for( Int j=0; j<numRHS; ++j )
+            {
+                auto rj = R( ALL, IR(j) );
+                if( converged[j] )
+                    Zero( rj );
+                else
+                    GMRESCorrection<Field>
+                    ( applyA, applyAInv, rj, gmresRelTol, ctrl.maxGMRESIts );
+            }
+        }
+        else
+        {
+            applyAInv( R );
+        }
+        X += R;
+
+        R = B;
+        applyA( Field(-1), X, Field(1), R );
+    }
+}
+
+} // namespace mixed_solve
+} // namespace El
+
+#endif // ifndef EL_SOLVE_MIXED_PRECISION_HPP
@@ -9,6 +9,7 @@
 #include <El.hpp>
 
 #include "./HermitianEig/SDC.hpp"
+#include "./TwoStageBand.hpp"
 
 // The targeted number of pieces to break the eigenvectors into during the
 // redistribution from the [* ,VR] distribution after PMRRR to the [MC,MR]
@@ -275,6 +276,50 @@ HermitianEig
 
 namespace herm_eig {
 
+// Reduce A to a band matrix with Gemm-rich updates and then gather the band
+// onto every process so that it can be redundantly reduced to tridiagonal form
+template<typename F>
+Int TwoStageReduceToBand
+( UpperOrLower uplo,
+  DistMatrix<F>& A,
+  DistMatrix<F,STAR,STAR>& householderScalars,
+  DistMatrix<Base<F>,STAR,STAR>& signature,
+  Matrix<F>& band,
+  const HermitianEigCtrl<F>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int bandwidth =
+      two_stage::Bandwidth( ctrl.twoStageBandwidth, A.Height() );
+    herm_tridiag::ReduceToBand
+    ( uplo, A, householderScalars, signature, bandwidth );
+    two_stage::GatherBand( LOWER, A, bandwidth, band );
+    return bandwidth;
+}
+
+template<typename F>
+void TwoStageCondense
+( UpperOrLower uplo,
+  DistMatrix<F>& A,
+  DistMatrix<Base<F>,STAR,STAR>& d,
+  DistMatrix<Base<F>,STAR,STAR>& e,
+  const HermitianEigCtrl<F>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    const Grid& g = A.Grid();
+
+    DistMatrix<F,STAR,STAR> householderScalars(g);
+    DistMatrix<Real,STAR,STAR> signature(g);
+    Matrix<F> band;
+    const Int bandwidth = TwoStageReduceToBand
+      ( uplo, A, householderScalars, signature, band, ctrl );
+
+    d.Resize( n, 1 );
+    e.Resize( Max(n-1,Int(0)), 1 );
+    herm_tridiag::BandToTridiag( bandwidth, band, d.Matrix(), e.Matrix() );
+}
+
 template<typename F>
 HermitianEigInfo
 SequentialHelper
@@ -456,7 +501,18 @@ BlackBox
     }
 
     // Tridiagonalize A
-    herm_tridiag::ExplicitCondensed( uplo, A, ctrl.tridiagCtrl );
+    DistMatrix<Real,STAR,STAR> d(A.Grid()), e(A.Grid());
+    if( ctrl.twoStage )
+    {
+        TwoStageCondense( uplo, A, d, e, ctrl );
+    }
+    else
+    {
+        herm_tridiag::ExplicitCondensed( uplo, A, ctrl.tridiagCtrl );
+        const Int subdiagonal = ( uplo==LOWER ? -1 : +1 );
+        GetRealPartOfDiagonal( A, d );
+        GetRealPartOfDiagonal( A, e, subdiagonal );
+    }
 
     if( ctrl.timeStages )
     {
@@ -469,9 +525,6 @@ BlackBox
     }
 
     // Solve the symmetric tridiagonal EVP
-    const Int subdiagonal = ( uplo==LOWER ? -1 : +1 );
-    auto d = GetRealPartOfDiagonal(A);
-    auto e = GetRealPartOfDiagonal(A,subdiagonal);
     info.tridiagEigInfo = HermitianTridiagEig( d, e, w, ctrl.tridiagEigCtrl );
 
     if( ctrl.timeStages )
@@ -838,6 +891,72 @@ ScaLAPACKHelper
 }
 #endif // ifdef EL_HAVE_SCALAPACK
 
+template<typename F>
+HermitianEigInfo
+TwoStage
+( UpperOrLower uplo,
+  AbstractDistMatrix<F>& APre,
+  AbstractDistMatrix<Base<F>>& w,
+  AbstractDistMatrix<F>& QPre,
+  const HermitianEigCtrl<F>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = APre.Height();
+    const Grid& g = APre.Grid();
+    HermitianEigInfo info;
+    RegionTimer eigRegion("HermitianEig");
+
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+
+    DistMatrix<F,STAR,STAR> householderScalars(g);
+    DistMatrix<Real,STAR,STAR> signature(g);
+    Matrix<F> band;
+    Int bandwidth;
+    {
+        RegionTimer region("ReduceToBand");
+        bandwidth = TwoStageReduceToBand
+          ( uplo, A, householderScalars, signature, band, ctrl );
+    }
+
+    // Each process redundantly chases the bulges but only accumulates the
+    // second-stage transformation into its own rows of Q2
+    DistMatrix<Real,STAR,STAR> d(g), e(g);
+    d.Resize( n, 1 );
+    e.Resize( Max(n-1,Int(0)), 1 );
+    DistMatrix<F,VC,STAR> Q2_VC_STAR(g);
+    Identity( Q2_VC_STAR, n, n );
+    {
+        RegionTimer region("BandToTridiag");
+        herm_tridiag::BandToTridiag
+        ( bandwidth, band, d.Matrix(), e.Matrix(), Q2_VC_STAR.Matrix() );
+    }
+
+    DistMatrix<Real> ZReal(g);
+    {
+        RegionTimer region("TridiagEig");
+        info.tridiagEigInfo =
+          HermitianTridiagEig( d, e, w, ZReal, ctrl.tridiagEigCtrl );
+    }
+
+    DistMatrixWriteProxy<F,F,MC,MR> QProx( QPre );
+    auto& Q = QProx.Get();
+    {
+        RegionTimer region("Backtransform");
+        DistMatrix<F> Z(g);
+        Copy( ZReal, Z );
+        ZReal.Empty();
+        DistMatrix<F> Q2( Q2_VC_STAR );
+        Q2_VC_STAR.Empty();
+        Gemm( NORMAL, NORMAL, F(1), Q2, Z, Q );
+        herm_tridiag::ApplyBandQ
+        ( A, householderScalars, signature, bandwidth, Q );
+    }
+
+    return info;
+}
+
 template<typename F>
 HermitianEigInfo
 MRRR
@@ -853,28 +972,16 @@ MRRR
     const Grid& g = APre.Grid();
     auto subset = ctrl.tridiagEigCtrl.subset;
     HermitianEigInfo info;
-    Timer timer;
+    RegionTimer eigRegion("HermitianEig");
 
     DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
     auto& A = AProx.Get();
 
     // Tridiagonalize A
-    if( ctrl.timeStages )
-    {
-        mpi::Barrier( A.DistComm() );
-        if( A.Grid().Rank() == 0 )
-            timer.Start();
-    }
     DistMatrix<F,STAR,STAR> householderScalars(g);
-    HermitianTridiag( uplo, A, householderScalars, ctrl.tridiagCtrl );
-    if( ctrl.timeStages )
     {
-        mpi::Barrier( A.DistComm() );
-        if( A.Grid().Rank() == 0 )
-        {
-            Output("  Condense time:      ",timer.Stop()," secs");
-            timer.Start();
-        }
+        RegionTimer region("Condense");
+        HermitianTridiag( uplo, A, householderScalars, ctrl.tridiagCtrl );
     }
 
     Int kEst;
@@ -927,28 +1034,23 @@ MRRR
     }
     // NOTE: We should be guaranteeing that Q_STAR_VR does not need to
     //       reallocate a buffer
-    if( subset.rangeSubset )
-        info.tridiagEigInfo = herm_tridiag_eig::MRRRPostEstimate
-        ( d_STAR_STAR, e_STAR_STAR, w, Q_STAR_VR, UNSORTED,
-          subset.lowerBound, subset.upperBound );
-    else
-        info.tridiagEigInfo = HermitianTridiagEig
-        ( d_STAR_STAR, e_STAR_STAR, w, Q_STAR_VR, ctrl.tridiagEigCtrl );
-
-    if( ctrl.timeStages )
     {
-        mpi::Barrier( A.DistComm() );
-        if( A.Grid().Rank() == 0 )
-        {
-            Output("  TridiagEig:    ",timer.Stop()," secs");
-            timer.Start();
-        }
+        RegionTimer region("TridiagEig");
+        if( subset.rangeSubset )
+            info.tridiagEigInfo = herm_tridiag_eig::MRRRPostEstimate
+            ( d_STAR_STAR, e_STAR_STAR, w, Q_STAR_VR, UNSORTED,
+              subset.lowerBound, subset.upperBound );
+        else
+            info.tridiagEigInfo = HermitianTridiagEig
+            ( d_STAR_STAR, e_STAR_STAR, w, Q_STAR_VR, ctrl.tridiagEigCtrl );
     }
 
+
     const Int k = w.Height();
     {
         // Redistribute Q piece-by-piece in place. This is to keep the
         // send/recv buffer memory usage low.
+        RegionTimer region("Redist");
         const Int p = g.Size();
         const Int numEqualPanels = K/p;
         const Int numPanelsPerComm = (numEqualPanels / TARGET_CHUNKS) + 1;
@@ -977,21 +1079,9 @@ MRRR
     Q.Resize( n, k ); // We can simply shrink matrices
 
     // Backtransform the tridiagonal eigenvectors, Q
-    if( ctrl.timeStages )
-    {
-        mpi::Barrier( A.DistComm() );
-        if( A.Grid().Rank() == 0 )
-        {
-            Output("  Redist:        ",timer.Stop()," secs");
-            timer.Start();
-        }
-    }
-    herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, householderScalars, Q );
-    if( ctrl.timeStages )
     {
-        mpi::Barrier( A.DistComm() );
-        if( A.Grid().Rank() == 0 )
-            Output("  Backtransform: ",timer.Stop()," secs");
+        RegionTimer region("Backtransform");
+        herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, householderScalars, Q );
     }
 
     return info;
@@ -1013,7 +1103,7 @@ HermitianEig
     const Int n = A.Height();
     auto subset = ctrl.tridiagEigCtrl.subset;
     HermitianEigInfo info;
-    Timer timer;
+    ScopedRegionTimers timers( ctrl.timeStages, A.Grid().Comm() );
 
     if( A.Height() != A.Width() )
         LogicError("Hermitian matrices must be square");
@@ -1084,6 +1174,10 @@ HermitianEig
         herm_eig::SDC( uplo, A, w, Q, ctrl.sdcCtrl );
         herm_eig::SortAndFilter( w, Q, ctrl.tridiagEigCtrl );
     }
+    else if( ctrl.twoStage )
+    {
+        info = herm_eig::TwoStage( uplo, A, w, Q, ctrl );
+    }
     else if( ctrl.tridiagEigCtrl.alg == HERM_TRIDIAG_EIG_MRRR )
     {
         info = herm_eig::MRRR( uplo, A, w, Q, ctrl );
@@ -1094,12 +1188,7 @@ HermitianEig
     }
 
     // Rescale the eigenvalues if necessary
-    if( ctrl.timeStages )
-    {
-        mpi::Barrier( A.DistComm() );
-        if( A.Grid().Rank() == 0 )
-            timer.Start();
-    }
+    RegionTimer region("HermitianEigScaleAndSort");
     if( scaledDown )
     {
         SafeScale( normMax, maxNormA, w );
@@ -1114,13 +1203,6 @@ HermitianEig
         w.Set( j, 0, sortPairs[j].value );
     ApplyTaggedSortToEachRow( sortPairs, Q );
 
-    if( ctrl.timeStages )
-    {
-        mpi::Barrier( A.DistComm() );
-        if( A.Grid().Rank() == 0 )
-            Output("  Scale+sort:    ",timer.Stop()," secs");
-    }
-
     return info;
 }
 
@@ -42,18 +42,18 @@ SVDInfo ChanUpper
     }
 
     SVDInfo info;
-    Timer timer;
+    ScopedRegionTimers timers( ctrl.time, mpi::COMM_SELF );
+    RegionTimer chanRegion("Chan");
     if( avoidU )
     {
         if( m > heightRatio*n )
         {
             Matrix<Field> householderScalars;
             Matrix<Real> signature;
-            if( ctrl.time )
-                timer.Start();
-            QR( A, householderScalars, signature );
-            if( ctrl.time )
-                Output("Chan QR reduction: ",timer.Stop()," seconds");
+            {
+                RegionTimer region("QR");
+                QR( A, householderScalars, signature );
+            }
 
             Matrix<Field> R;
             auto AT = A( IR(0,n), IR(0,n) );
@@ -76,11 +76,10 @@ SVDInfo ChanUpper
         {
             Matrix<Field> householderScalars;
             Matrix<Real> signature;
-            if( ctrl.time )
-                timer.Start();
-            QR( A, householderScalars, signature );
-            if( ctrl.time )
-                Output("Chan QR reduction: ",timer.Stop()," seconds");
+            {
+                RegionTimer region("QR");
+                QR( A, householderScalars, signature );
+            }
 
             Matrix<Field> R;
             auto AT = A( IR(0,n), IR(0,n) );
@@ -92,11 +91,11 @@ SVDInfo ChanUpper
                 Identity( U, m, m );
                 auto UTL = U( IR(0,n), IR(0,n) );
                 info = svd::GolubReinsch( R, UTL, s, V, ctrl );
-                if( ctrl.time )
-                    timer.Start();
-                qr::ApplyQ( LEFT, NORMAL, A, householderScalars, signature, U );
-                if( ctrl.time )
-                    Output("Chan backtransformation: ",timer.Stop()," seconds");
+                {
+                    RegionTimer region("Backtransform");
+                    qr::ApplyQ
+                    ( LEFT, NORMAL, A, householderScalars, signature, U );
+                }
             }
             else
             {
@@ -106,11 +105,11 @@ SVDInfo ChanUpper
                 const Int rank = UT.Width();
                 U.Resize( m, rank );
                 // (U,s,V) holds an SVD of the R from the QR fact. of original A
-                if( ctrl.time )
-                    timer.Start();
-                qr::ApplyQ( LEFT, NORMAL, A, householderScalars, signature, U );
-                if( ctrl.time )
-                    Output("Chan backtransformation: ",timer.Stop()," seconds");
+                {
+                    RegionTimer region("Backtransform");
+                    qr::ApplyQ
+                    ( LEFT, NORMAL, A, householderScalars, signature, U );
+                }
             }
         }
         else
@@ -160,18 +159,18 @@ SVDInfo ChanUpper
     }
 
     SVDInfo info;
-    Timer timer;
+    ScopedRegionTimers timers( ctrl.time, g.Comm() );
+    RegionTimer chanRegion("Chan");
     if( avoidU )
     {
         if( m > heightRatio*n )
         {
             DistMatrix<Field,MD,STAR> householderScalars(g);
             DistMatrix<Real,MD,STAR> signature(g);
-            if( ctrl.time && g.Rank() == 0 )
-                timer.Start();
-            QR( A, householderScalars, signature );
-            if( ctrl.time && g.Rank() == 0 )
-                Output("Chan QR reduction: ",timer.Stop()," seconds");
+            {
+                RegionTimer region("QR");
+                QR( A, householderScalars, signature );
+            }
 
             DistMatrix<Field> R(g);
             auto AT = A( IR(0,n), IR(0,n) );
@@ -194,11 +193,10 @@ SVDInfo ChanUpper
         {
             DistMatrix<Field,MD,STAR> householderScalars(g);
             DistMatrix<Real,MD,STAR> signature(g);
-            if( ctrl.time && g.Rank() == 0 )
-                timer.Start();
-            QR( A, householderScalars, signature );
-            if( ctrl.time && g.Rank() == 0 )
-                Output("Chan QR reduction: ",timer.Stop()," seconds");
+            {
+                RegionTimer region("QR");
+                QR( A, householderScalars, signature );
+            }
 
             DistMatrix<Field> R(g);
             auto AT = A( IR(0,n), IR(0,n) );
@@ -210,11 +208,11 @@ SVDInfo ChanUpper
                 Identity( U, m, m );
                 auto UTL = U( IR(0,n), IR(0,n) );
                 info = svd::GolubReinsch( R, UTL, s, V, ctrl );
-                if( ctrl.time && g.Rank() == 0 )
-                    timer.Start();
-                qr::ApplyQ( LEFT, NORMAL, A, householderScalars, signature, U );
-                if( ctrl.time && g.Rank() == 0 )
-                    Output("Chan backtransformation: ",timer.Stop()," seconds");
+                {
+                    RegionTimer region("Backtransform");
+                    qr::ApplyQ
+                    ( LEFT, NORMAL, A, householderScalars, signature, U );
+                }
             }
             else
             {
@@ -224,11 +222,11 @@ SVDInfo ChanUpper
                 const Int rank = UT.Width();
                 U.Resize( m, rank );
                 // (U,s,V) holds an SVD of the R from the QR fact. of original A
-                if( ctrl.time && g.Rank() == 0 )
-                    timer.Start();
-                qr::ApplyQ( LEFT, NORMAL, A, householderScalars, signature, U );
-                if( ctrl.time && g.Rank() == 0 )
-                    Output("Chan backtransformation: ",timer.Stop()," seconds");
+                {
+                    RegionTimer region("Backtransform");
+                    qr::ApplyQ
+                    ( LEFT, NORMAL, A, householderScalars, signature, U );
+                }
             }
         }
         else
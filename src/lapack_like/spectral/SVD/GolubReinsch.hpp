@@ -10,6 +10,7 @@
 #define EL_SVD_GOLUBREINSCH_HPP
 
 #include "./Util.hpp"
+#include "./TwoStage.hpp"
 
 namespace El {
 namespace svd {
@@ -33,14 +34,15 @@ SVDInfo GolubReinsch
     }
     SVDInfo info;
 
+    ScopedRegionTimers timers( ctrl.time, mpi::COMM_SELF );
+    RegionTimer golubReinschRegion("GolubReinsch");
+
     // Bidiagonalize A
-    Timer timer;
     Matrix<Field> householderScalarsP, householderScalarsQ;
-    if( ctrl.time )
-        timer.Start();
-    Bidiag( A, householderScalarsP, householderScalarsQ );
-    if( ctrl.time )
-        Output("Reduction to bidiagonal: ",timer.Stop()," seconds");
+    {
+        RegionTimer region("Bidiag");
+        Bidiag( A, householderScalarsP, householderScalarsQ );
+    }
 
     // Compute the SVD of the bidiagonal matrix.
     // (We can guarantee that accumulation was not requested.)
@@ -48,48 +50,50 @@ SVDInfo GolubReinsch
     const UpperOrLower uplo = ( m>=n ? UPPER : LOWER );
     auto mainDiag = GetRealPartOfDiagonal( A );
     auto offDiag = GetRealPartOfDiagonal( A, offdiagonal );
-    if( ctrl.time )
-        timer.Start();
-    if( m == n || (m > n && avoidU) || (m < n && avoidV) )
-    {
-        // There is no need to work on a subset of U or V
-        info.bidiagSVDInfo =
-          BidiagSVD( uplo, mainDiag, offDiag, U, s, V, ctrl.bidiagSVDCtrl );
-    }
-    else if( m > n )
     {
-        // We need to work on a subset of U
-        Matrix<Field> USub;
-        info.bidiagSVDInfo =
-          BidiagSVD( uplo, mainDiag, offDiag, USub, s, V, ctrl.bidiagSVDCtrl );
-        // Copy USub into U
-        const Int UWidth = USub.Width();
-        Identity( U, m, UWidth );
-        auto UTop = U( IR(0,n), ALL );
-        UTop = USub;
-    }
-    else if( m < n )
-    {
-        // We need to work on a subset of V
-        Matrix<Field> VSub;
-        info.bidiagSVDInfo =
-          BidiagSVD( uplo, mainDiag, offDiag, U, s, VSub, ctrl.bidiagSVDCtrl );
-        // Copy VSub into V
-        const Int VWidth = VSub.Width();
-        Identity( V, n, VWidth );
-        auto VTop = V( IR(0,m), ALL );
-        VTop = VSub;
+        RegionTimer region("BidiagSVD");
+        if( m == n || (m > n && avoidU) || (m < n && avoidV) )
+        {
+            // There is no need to work on a subset of U or V
+            info.bidiagSVDInfo =
+              BidiagSVD( uplo, mainDiag, offDiag, U, s, V, ctrl.bidiagSVDCtrl );
+        }
+        else if( m > n )
+        {
+            // We need to work on a subset of U
+            Matrix<Field> USub;
+            info.bidiagSVDInfo =
+              BidiagSVD
+              ( uplo, mainDiag, offDiag, USub, s, V,
+                ctrl.bidiagSVDCtrl );
+            // Copy USub into U
+            const Int UWidth = USub.Width();
+            Identity( U, m, UWidth );
+            auto UTop = U( IR(0,n), ALL );
+            UTop = USub;
+        }
+        else if( m < n )
+        {
+            // We need to work on a subset of V
+            Matrix<Field> VSub;
+            info.bidiagSVDInfo =
+              BidiagSVD
+              ( uplo, mainDiag, offDiag, U, s, VSub,
+                ctrl.bidiagSVDCtrl );
+            // Copy VSub into V
+            const Int VWidth = VSub.Width();
+            Identity( V, n, VWidth );
+            auto VTop = V( IR(0,m), ALL );
+            VTop = VSub;
+        }
     }
-    if( ctrl.time )
-        Output("Bidiag SVD: ",timer.Stop()," seconds");
 
     // Backtransform U and V
-    if( ctrl.time )
-        timer.Start();
-    if( !avoidU ) bidiag::ApplyQ( LEFT, NORMAL, A, householderScalarsQ, U );
-    if( !avoidV ) bidiag::ApplyP( LEFT, NORMAL, A, householderScalarsP, V );
-    if( ctrl.time )
-        Output("GolubReinsch backtransformation: ",timer.Stop()," seconds");
+    {
+        RegionTimer region("Backtransform");
+        if( !avoidU ) bidiag::ApplyQ( LEFT, NORMAL, A, householderScalarsQ, U );
+        if( !avoidV ) bidiag::ApplyP( LEFT, NORMAL, A, householderScalarsP, V );
+    }
 
     return info;
 }
@@ -112,16 +116,19 @@ SVDInfo GolubReinsch
     {
         return SVD( A, s, ctrl );
     }
+    if( ctrl.twoStage )
+        return TwoStage( A, U, s, V, ctrl );
     SVDInfo info;
 
+    ScopedRegionTimers timers( ctrl.time, g.Comm() );
+    RegionTimer golubReinschRegion("GolubReinsch");
+
     // Bidiagonalize A
-    Timer timer;
     DistMatrix<Field,STAR,STAR> householderScalarsP(g), householderScalarsQ(g);
-    if( ctrl.time && g.Rank() == 0 )
-        timer.Start();
-    Bidiag( A, householderScalarsP, householderScalarsQ );
-    if( ctrl.time && g.Rank() == 0 )
-        Output("Reduction to bidiagonal: ",timer.Stop()," seconds");
+    {
+        RegionTimer region("Bidiag");
+        Bidiag( A, householderScalarsP, householderScalarsQ );
+    }
 
     // Grab copies of the diagonal and sub/super-diagonal of A
     const UpperOrLower uplo = ( m>=n ? UPPER : LOWER );
@@ -130,54 +137,51 @@ SVDInfo GolubReinsch
     auto offDiag = GetRealPartOfDiagonal(A,offdiagonal);
 
     // Run the bidiagonal SVD
-    if( ctrl.time && g.Rank() == 0 )
-        timer.Start();
-    if( m == n || (m > n && avoidU) || (m < n && avoidV) )
     {
-        // There is no need to work on a subset of U or V
-        info.bidiagSVDInfo =
-          BidiagSVD( uplo, mainDiag, offDiag, U, s, V, ctrl.bidiagSVDCtrl );
-    }
-    else if( m > n )
-    {
-        // We need to work on a subset of U
-        DistMatrix<Field> USub(g);
-        info.bidiagSVDInfo =
-          BidiagSVD( uplo, mainDiag, offDiag, USub, s, V, ctrl.bidiagSVDCtrl );
-        // Copy USub into U
-        const Int UWidth = USub.Width();
-        Identity( U, m, UWidth );
-        auto UTop = U( IR(0,n), ALL );
-        UTop = USub;
-    }
-    else if( m < n )
-    {
-        // We need to work on a subset of V
-        DistMatrix<Field> VSub(g);
-        info.bidiagSVDInfo =
-          BidiagSVD( uplo, mainDiag, offDiag, U, s, VSub, ctrl.bidiagSVDCtrl );
-        // Copy VSub into V
-        const Int VWidth = VSub.Width();
-        Identity( V, n, VWidth );
-        auto VTop = V( IR(0,m), ALL );
-        VTop = VSub;
+        RegionTimer region("BidiagSVD");
+        if( m == n || (m > n && avoidU) || (m < n && avoidV) )
+        {
+            // There is no need to work on a subset of U or V
+            info.bidiagSVDInfo =
+              BidiagSVD( uplo, mainDiag, offDiag, U, s, V, ctrl.bidiagSVDCtrl );
+        }
+        else if( m > n )
+        {
+            // We need to work on a subset of U
+            DistMatrix<Field> USub(g);
+            info.bidiagSVDInfo =
+              BidiagSVD
+              ( uplo, mainDiag, offDiag, USub, s, V,
+                ctrl.bidiagSVDCtrl );
+            // Copy USub into U
+            const Int UWidth = USub.Width();
+            Identity( U, m, UWidth );
+            auto UTop = U( IR(0,n), ALL );
+            UTop = USub;
+        }
+        else if( m < n )
+        {
+            // We need to work on a subset of V
+            DistMatrix<Field> VSub(g);
+            info.bidiagSVDInfo =
+              BidiagSVD
+              ( uplo, mainDiag, offDiag, U, s, VSub,
+                ctrl.bidiagSVDCtrl );
+            // Copy VSub into V
+            const Int VWidth = VSub.Width();
+            Identity( V, n, VWidth );
+            auto VTop = V( IR(0,m), ALL );
+            VTop = VSub;
+        }
     }
 
-    if( ctrl.time )
+    // Backtransform U and V
     {
-        mpi::Barrier( g.Comm() );
-        if( g.Rank() == 0 )
-            Output("Bidiag SVD: ",timer.Stop()," seconds");
+        RegionTimer region("Backtransform");
+        if( !avoidU ) bidiag::ApplyQ( LEFT, NORMAL, A, householderScalarsQ, U );
+        if( !avoidV ) bidiag::ApplyP( LEFT, NORMAL, A, householderScalarsP, V );
     }
 
-    // Backtransform U and V
-    if( ctrl.time && g.Rank() == 0 )
-        timer.Start();
-    if( !avoidU ) bidiag::ApplyQ( LEFT, NORMAL, A, householderScalarsQ, U );
-    if( !avoidV ) bidiag::ApplyP( LEFT, NORMAL, A, householderScalarsP, V );
-    if( ctrl.time && g.Rank() == 0 )
-        Output("GolubReinsch backtransformation: ",timer.Stop()," seconds");
-
     return info;
 }
 
@@ -210,26 +214,26 @@ SVDInfo GolubReinsch
     const Int n = A.Width();
     SVDInfo info;
 
+    ScopedRegionTimers timers( ctrl.time, mpi::COMM_SELF );
+    RegionTimer golubReinschRegion("GolubReinsch");
+
     // Bidiagonalize A
-    Timer timer;
     Matrix<Field> householderScalarsP, householderScalarsQ;
-    if( ctrl.time )
-        timer.Start();
-    Bidiag( A, householderScalarsP, householderScalarsQ );
-    if( ctrl.time )
-        Output("Reduction to bidiagonal: ",timer.Stop()," seconds");
+    {
+        RegionTimer region("Bidiag");
+        Bidiag( A, householderScalarsP, householderScalarsQ );
+    }
 
     // Compute the singular values of the bidiagonal matrix
     const UpperOrLower uplo = ( m>=n ? UPPER : LOWER );
     const Int offdiagonal = ( uplo==UPPER ? 1 : -1 );
     auto mainDiag = GetRealPartOfDiagonal( A );
     auto offDiag = GetRealPartOfDiagonal( A, offdiagonal );
-    if( ctrl.time )
-        timer.Start();
-    info.bidiagSVDInfo =
-      BidiagSVD( uplo, mainDiag, offDiag, s, ctrl.bidiagSVDCtrl );
-    if( ctrl.time )
-        Output("Bidiag SVD: ",timer.Stop()," seconds");
+    {
+        RegionTimer region("BidiagSVD");
+        info.bidiagSVDInfo =
+          BidiagSVD( uplo, mainDiag, offDiag, s, ctrl.bidiagSVDCtrl );
+    }
 
     return info;
 }
@@ -244,28 +248,30 @@ SVDInfo GolubReinsch
     const Int m = A.Height();
     const Int n = A.Width();
     const Grid& g = A.Grid();
+    if( ctrl.twoStage )
+        return TwoStage( A, s, ctrl );
     SVDInfo info;
 
+    ScopedRegionTimers timers( ctrl.time, g.Comm() );
+    RegionTimer golubReinschRegion("GolubReinsch");
+
     // Bidiagonalize A
-    Timer timer;
     DistMatrix<Field,STAR,STAR> householderScalarsP(g), householderScalarsQ(g);
-    if( ctrl.time && g.Rank() == 0 )
-        timer.Start();
-    Bidiag( A, householderScalarsP, householderScalarsQ );
-    if( ctrl.time && g.Rank() == 0 )
-        Output("Reduction to bidiagonal: ",timer.Stop()," seconds");
+    {
+        RegionTimer region("Bidiag");
+        Bidiag( A, householderScalarsP, householderScalarsQ );
+    }
 
     // Grab copies of the diagonal and sub/super-diagonal of A
     const UpperOrLower uplo = ( m>=n ? UPPER : LOWER );
     const Int offdiagonal = ( uplo==UPPER ? 1 : -1 );
     auto mainDiag = GetRealPartOfDiagonal(A);
     auto offDiag = GetRealPartOfDiagonal(A,offdiagonal);
-    if( ctrl.time && g.Rank() == 0 )
-        timer.Start();
-    info.bidiagSVDInfo =
-      BidiagSVD( uplo, mainDiag, offDiag, s, ctrl.bidiagSVDCtrl );
-    if( ctrl.time && g.Rank() == 0 )
-        Output("Bidiag SVD: ",timer.Stop()," seconds");
+    {
+        RegionTimer region("BidiagSVD");
+        info.bidiagSVDInfo =
+          BidiagSVD( uplo, mainDiag, offDiag, s, ctrl.bidiagSVDCtrl );
+    }
 
     return info;
 }
@@ -0,0 +1,195 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SVD_TWOSTAGE_HPP
+#define EL_SVD_TWOSTAGE_HPP
+
+#include "../TwoStageBand.hpp"
+
+namespace El {
+namespace svd {
+
+// Reduce the tall matrix A to an upper band matrix with Gemm-rich updates
+// and then gather the band onto every process so that it can be redundantly
+// reduced to bidiagonal form
+template<typename Field>
+Int TwoStageReduceToBand
+( DistMatrix<Field>& A,
+  DistMatrix<Field,STAR,STAR>& householderScalarsQ,
+  DistMatrix<Base<Field>,STAR,STAR>& signatureQ,
+  DistMatrix<Field,STAR,STAR>& householderScalarsP,
+  DistMatrix<Base<Field>,STAR,STAR>& signatureP,
+  Matrix<Field>& band,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int bandwidth =
+      two_stage::Bandwidth( ctrl.twoStageBandwidth, A.Width() );
+    bidiag::ReduceToBand
+    ( A, householderScalarsQ, signatureQ, householderScalarsP, signatureP,
+      bandwidth );
+    two_stage::GatherBand( UPPER, A, bandwidth, band );
+    return bandwidth;
+}
+
+// Since the reduction to band form requires a matrix which is at least as
+// tall as it is wide, wide matrices are handled via their adjoints.
+template<typename Field>
+SVDInfo TwoStage
+( DistMatrix<Field>& APre,
+  AbstractDistMatrix<Base<Field>>& s,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Grid& g = APre.Grid();
+    SVDInfo info;
+
+    DistMatrix<Field> AAdj(g);
+    const bool wide = ( APre.Height() < APre.Width() );
+    if( wide )
+        Adjoint( APre, AAdj );
+    DistMatrix<Field>& A = ( wide ? AAdj : APre );
+    const Int n = A.Width();
+    if( n == 0 )
+    {
+        s.Resize( 0, 1 );
+        return info;
+    }
+
+    DistMatrix<Field,STAR,STAR> householderScalarsQ(g), householderScalarsP(g);
+    DistMatrix<Real,STAR,STAR> signatureQ(g), signatureP(g);
+    Matrix<Field> band;
+    ScopedRegionTimers timers( ctrl.time, g.Comm() );
+    RegionTimer twoStageRegion("TwoStage");
+    Int bandwidth;
+    {
+        RegionTimer region("ReduceToBand");
+        bandwidth = TwoStageReduceToBand
+          ( A, householderScalarsQ, signatureQ,
+            householderScalarsP, signatureP, band, ctrl );
+    }
+
+    DistMatrix<Real,STAR,STAR> mainDiag(g), superDiag(g);
+    mainDiag.Resize( n, 1 );
+    superDiag.Resize( Max(n-1,Int(0)), 1 );
+    {
+        RegionTimer region("BandToBidiag");
+        bidiag::BandToBidiag
+        ( bandwidth, band, mainDiag.Matrix(), superDiag.Matrix() );
+    }
+
+    {
+        RegionTimer region("BidiagSVD");
+        info.bidiagSVDInfo =
+          BidiagSVD( UPPER, mainDiag, superDiag, s, ctrl.bidiagSVDCtrl );
+    }
+
+    return info;
+}
+
+template<typename Field>
+SVDInfo TwoStage
+( DistMatrix<Field>& APre,
+  DistMatrix<Field>& UPre,
+  AbstractDistMatrix<Base<Field>>& s,
+  DistMatrix<Field>& VPre,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Grid& g = APre.Grid();
+    SVDInfo info;
+
+    // If A is wide, we compute A^H = V S U^H instead
+    DistMatrix<Field> AAdj(g);
+    const bool wide = ( APre.Height() < APre.Width() );
+    if( wide )
+        Adjoint( APre, AAdj );
+    DistMatrix<Field>& A = ( wide ? AAdj : APre );
+    DistMatrix<Field>& U = ( wide ? VPre : UPre );
+    DistMatrix<Field>& V = ( wide ? UPre : VPre );
+    auto bidiagSVDCtrl = ctrl.bidiagSVDCtrl;
+    if( wide )
+        std::swap( bidiagSVDCtrl.wantU, bidiagSVDCtrl.wantV );
+    const bool avoidU = !bidiagSVDCtrl.wantU;
+    const bool avoidV = !bidiagSVDCtrl.wantV;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    if( n == 0 )
+    {
+        s.Resize( 0, 1 );
+        if( !avoidU )
+            U.Resize( m, 0 );
+        if( !avoidV )
+            V.Resize( 0, 0 );
+        return info;
+    }
+
+    DistMatrix<Field,STAR,STAR> householderScalarsQ(g), householderScalarsP(g);
+    DistMatrix<Real,STAR,STAR> signatureQ(g), signatureP(g);
+    Matrix<Field> band;
+    ScopedRegionTimers timers( ctrl.time, g.Comm() );
+    RegionTimer twoStageRegion("TwoStage");
+    Int bandwidth;
+    {
+        RegionTimer region("ReduceToBand");
+        bandwidth = TwoStageReduceToBand
+          ( A, householderScalarsQ, signatureQ,
+            householderScalarsP, signatureP, band, ctrl );
+    }
+
+    // Each process redundantly chases the bulges but only accumulates the
+    // second-stage transformations into its own rows of U2 and V2
+    DistMatrix<Real,STAR,STAR> mainDiag(g), superDiag(g);
+    mainDiag.Resize( n, 1 );
+    superDiag.Resize( Max(n-1,Int(0)), 1 );
+    DistMatrix<Field,VC,STAR> U2_VC_STAR(g), V2_VC_STAR(g);
+    {
+        RegionTimer region("BandToBidiag");
+        Identity( U2_VC_STAR, (avoidU ? 0 : n), n );
+        Identity( V2_VC_STAR, (avoidV ? 0 : n), n );
+        bidiag::BandToBidiag
+        ( bandwidth, band, mainDiag.Matrix(), superDiag.Matrix(),
+          U2_VC_STAR.Matrix(), V2_VC_STAR.Matrix() );
+    }
+
+    DistMatrix<Field> UB(g), VB(g);
+    {
+        RegionTimer region("BidiagSVD");
+        info.bidiagSVDInfo =
+          BidiagSVD( UPPER, mainDiag, superDiag, UB, s, VB, bidiagSVDCtrl );
+    }
+
+    // Backtransform U and V through both stages
+    RegionTimer backtransformRegion("Backtransform");
+    if( !avoidU )
+    {
+        const Int UWidth = UB.Width();
+        DistMatrix<Field> U2( U2_VC_STAR );
+        U2_VC_STAR.Empty();
+        Identity( U, m, UWidth );
+        auto UTop = U( IR(0,n), ALL );
+        Gemm( NORMAL, NORMAL, Field(1), U2, UB, Field(0), UTop );
+        bidiag::ApplyBandQ( A, householderScalarsQ, signatureQ, bandwidth, U );
+    }
+    if( !avoidV )
+    {
+        DistMatrix<Field> V2( V2_VC_STAR );
+        V2_VC_STAR.Empty();
+        Gemm( NORMAL, NORMAL, Field(1), V2, VB, V );
+        bidiag::ApplyBandP( A, householderScalarsP, signatureP, bandwidth, V );
+    }
+
+    return info;
+}
+
+} // namespace svd
+} // namespace El
+
+#endif // ifndef EL_SVD_TWOSTAGE_HPP
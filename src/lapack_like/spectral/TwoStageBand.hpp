@@ -0,0 +1,52 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SPECTRAL_TWOSTAGEBAND_HPP
+#define EL_SPECTRAL_TWOSTAGEBAND_HPP
+
+// Utilities shared by the two-stage Hermitian tridiagonalization and
+// bidiagonalization drivers
+
+namespace El {
+namespace two_stage {
+
+// The bandwidth of the first stage for a matrix with n columns, where a
+// nonpositive proposal selects the algorithmic blocksize
+inline Int Bandwidth( Int bandwidthProp, Int n )
+{
+    if( bandwidthProp <= 0 )
+        bandwidthProp = Blocksize();
+    return Max( Min(bandwidthProp,n-1), Int(1) );
+}
+
+// Gather the lower (or upper) band of A onto every process such that
+// band(k,j) = A(j+k,j) (or band(k,j) = A(j,j+k)) for 0 <= k <= bandwidth
+template<typename Field>
+void GatherBand
+( UpperOrLower uplo,
+  const DistMatrix<Field>& A,
+  Int bandwidth,
+  Matrix<Field>& band )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Width();
+    const Int sign = ( uplo==LOWER ? -1 : 1 );
+    Zeros( band, bandwidth+1, n );
+    DistMatrix<Field,STAR,STAR> diag( A.Grid() );
+    for( Int offset=0; offset<Min(bandwidth+1,n); ++offset )
+    {
+        GetDiagonal( A, diag, sign*offset );
+        auto bandRow = band( IR(offset), IR(0,n-offset) );
+        Transpose( diag.Matrix(), bandRow );
+    }
+}
+
+} // namespace two_stage
+} // namespace El
+
+#endif // ifndef EL_SPECTRAL_TWOSTAGEBAND_HPP
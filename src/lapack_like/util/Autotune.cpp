@@ -0,0 +1,274 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace autotune {
+
+// Return the maximum over the grid of the fastest of 'numReps' runs of
+// 'kernel', each of which is preceded by an (untimed) call to 'setup'
+template<class SetupType,class KernelType>
+double Time
+( const Grid& grid, Int numReps,
+  const SetupType& setup, const KernelType& kernel )
+{
+    EL_DEBUG_CSE
+    Timer timer;
+    double minTime = limits::Max<double>();
+    for( Int rep=0; rep<numReps; ++rep )
+    {
+        setup();
+        mpi::Barrier( grid.Comm() );
+        timer.Start();
+        kernel();
+        minTime = Min( minTime, timer.Stop() );
+    }
+    return mpi::AllReduce( minTime, mpi::MAX, grid.Comm() );
+}
+
+// Time the kernel with each of the candidate values of the given parameter
+// and record the fastest
+template<class SetupType,class KernelType>
+Int SweepParameter
+( const string& kernelName, const string& param, const string& typeName,
+  Int gridHeight, Int gridWidth,
+  const vector<Int>& candidates,
+  const Grid& grid,
+  const AutotuneCtrl& ctrl,
+  const SetupType& setup, const KernelType& kernel )
+{
+    EL_DEBUG_CSE
+    Int bestValue = -1;
+    double bestTime = limits::Max<double>();
+    for( const Int value : candidates )
+    {
+        SetTunedParameter
+        ( kernelName, param, typeName, gridHeight, gridWidth, double(value) );
+        const double runTime = Time( grid, ctrl.numReps, setup, kernel );
+        if( ctrl.progress )
+            OutputFromRoot
+            (grid.Comm(),kernelName," with ",param,"=",value,": ",runTime,
+             " seconds");
+        if( runTime < bestTime )
+        {
+            bestTime = runTime;
+            bestValue = value;
+        }
+    }
+    if( bestValue > 0 )
+        SetTunedParameter
+        ( kernelName, param, typeName, gridHeight, gridWidth,
+          double(bestValue) );
+    return bestValue;
+}
+
+// Find the smallest of the (sorted) ratios such that 'faster' holds for it
+// and for every larger ratio. If 'faster' does not even hold for the largest
+// ratio then no crossover was measured and false is returned.
+inline bool Crossover
+( const vector<double>& ratios, const vector<bool>& faster,
+  double& crossover )
+{
+    crossover = ratios.back();
+    if( !faster.back() )
+        return false;
+    for( Int j=ratios.size()-2; j>=0; --j )
+    {
+        if( !faster[j] )
+            break;
+        crossover = ratios[j];
+    }
+    return true;
+}
+
+template<typename Field>
+void TuneGemm( const Grid& grid, const AutotuneCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const string typeName = TypeName<Field>();
+    const Int gridHeight = grid.Height();
+    const Int gridWidth = grid.Width();
+    const Int n = ctrl.size;
+    auto noSetup = [](){};
+
+    // The blocksize of the (square, and therefore stationary C) product
+    DistMatrix<Field> A(grid), B(grid), C(grid);
+    Uniform( A, n, n );
+    Uniform( B, n, n );
+    Zeros( C, n, n );
+    SweepParameter
+    ( "Gemm", "blocksize", typeName, gridHeight, gridWidth,
+      ctrl.blocksizes, grid, ctrl, noSetup,
+      [&]() { Gemm( NORMAL, NORMAL, Field(1), A, B, Field(0), C ); } );
+
+    if( ctrl.gemmAspectRatios.empty() )
+        return;
+    vector<double> ratios( ctrl.gemmAspectRatios );
+    std::sort( ratios.begin(), ratios.end() );
+
+    // The blocksize of the dot-product variant at the largest aspect ratio
+    {
+        const Int outer = Max( Int(n/ratios.back()), Int(1) );
+        Uniform( A, outer, n );
+        Uniform( B, n, outer );
+        Zeros( C, outer, outer );
+        SweepParameter
+        ( "Gemm", "dotBlocksize", typeName, gridHeight, gridWidth,
+          ctrl.dotBlocksizes, grid, ctrl, noSetup,
+          [&]()
+          { Gemm( NORMAL, NORMAL, Field(1), A, B, Field(0), C,
+                  GEMM_SUMMA_DOT ); } );
+    }
+
+    // The crossovers between the variants as the inner dimension grows
+    // relative to the outer dimensions
+    const Int numRatios = ratios.size();
+    vector<bool> stationaryFaster(numRatios), dotFaster(numRatios);
+    for( Int j=0; j<numRatios; ++j )
+    {
+        const Int outer = Max( Int(n/ratios[j]), Int(1) );
+        Uniform( A, outer, n );
+        Uniform( B, n, outer );
+        Zeros( C, outer, outer );
+        auto timeVariant =
+          [&]( GemmAlgorithm alg )
+          {
+              return Time
+              ( grid, ctrl.numReps, noSetup,
+                [&]()
+                { Gemm( NORMAL, NORMAL, Field(1), A, B, Field(0), C, alg ); } );
+          };
+        const double timeA = timeVariant( GEMM_SUMMA_A );
+        const double timeB = timeVariant( GEMM_SUMMA_B );
+        const double timeC = timeVariant( GEMM_SUMMA_C );
+        const double timeDot = timeVariant( GEMM_SUMMA_DOT );
+        if( ctrl.progress )
+            OutputFromRoot
+            (grid.Comm(),"Gemm with inner/outer ratio ",ratios[j],": A=",timeA,
+             ", B=",timeB,", C=",timeC,", Dot=",timeDot," seconds");
+        const double timeStationary = Min(timeA,timeB);
+        stationaryFaster[j] = ( timeStationary < timeC );
+        dotFaster[j] = ( timeDot < Min(timeStationary,timeC) );
+    }
+    // The default heuristics are kept for any variant which was never faster
+    double crossover;
+    if( Crossover( ratios, stationaryFaster, crossover ) )
+        SetTunedParameter
+        ( "Gemm", "weightTowardsC", typeName, gridHeight, gridWidth,
+          crossover );
+    if( Crossover( ratios, dotFaster, crossover ) )
+        SetTunedParameter
+        ( "Gemm", "weightAwayFromDot", typeName, gridHeight, gridWidth,
+          crossover );
+}
+
+template<typename Field>
+void TuneTrsm( const Grid& grid, const AutotuneCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = ctrl.size;
+    DistMatrix<Field> L(grid), X(grid), B(grid);
+    Uniform( L, n, n );
+    MakeTrapezoidal( LOWER, L );
+    ShiftDiagonal( L, Field(n) );
+    Uniform( B, n, n );
+    SweepParameter
+    ( "Trsm", "blocksize", TypeName<Field>(), grid.Height(), grid.Width(),
+      ctrl.blocksizes, grid, ctrl,
+      [&]() { X = B; },
+      [&]()
+      { Trsm( LEFT, LOWER, NORMAL, NON_UNIT, Field(1), L, X ); } );
+}
+
+template<typename Field>
+void TuneLU( const Grid& grid, const AutotuneCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = ctrl.size;
+    DistMatrix<Field> A(grid), AOrig(grid);
+    DistPermutation P(grid);
+    Uniform( AOrig, n, n );
+    SweepParameter
+    ( "LU", "blocksize", TypeName<Field>(), grid.Height(), grid.Width(),
+      ctrl.blocksizes, grid, ctrl,
+      [&]() { A = AOrig; },
+      [&]() { LU( A, P ); } );
+}
+
+template<typename Field>
+void TuneCholesky( const Grid& grid, const AutotuneCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const string typeName = TypeName<Field>();
+    const Int n = ctrl.size;
+    DistMatrix<Field> A(grid), AOrig(grid);
+    HermitianUniformSpectrum( AOrig, n, Base<Field>(1), Base<Field>(10) );
+    auto setup = [&]() { A = AOrig; };
+    auto kernel = [&]() { Cholesky( LOWER, A ); };
+    SweepParameter
+    ( "Cholesky", "blocksize", typeName, grid.Height(), grid.Width(),
+      ctrl.blocksizes, grid, ctrl, setup, kernel );
+    SweepParameter
+    ( "LocalTrrk", "blocksize", typeName, 0, 0,
+      ctrl.localBlocksizes, grid, ctrl, setup, kernel );
+}
+
+template<typename Field>
+void TuneHermitianTridiag( const Grid& grid, const AutotuneCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const string typeName = TypeName<Field>();
+    const Int n = ctrl.size;
+    DistMatrix<Field> A(grid), AOrig(grid);
+    DistMatrix<Field,STAR,STAR> householderScalars(grid);
+    HermitianUniformSpectrum( AOrig, n, Base<Field>(1), Base<Field>(10) );
+    auto setup = [&]() { A = AOrig; };
+    // The control structure is built within the kernel so that it picks up
+    // the current local Symv blocksize
+    auto kernel =
+      [&]()
+      {
+          HermitianTridiagCtrl<Field> tridiagCtrl;
+          HermitianTridiag( LOWER, A, householderScalars, tridiagCtrl );
+      };
+    SweepParameter
+    ( "HermitianTridiag", "blocksize", typeName, grid.Height(), grid.Width(),
+      ctrl.blocksizes, grid, ctrl, setup, kernel );
+    SweepParameter
+    ( "LocalSymv", "blocksize", typeName, 0, 0,
+      ctrl.localBlocksizes, grid, ctrl, setup, kernel );
+}
+
+} // namespace autotune
+
+template<typename Field>
+void Autotune( const Grid& grid, const AutotuneCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.progress )
+        OutputFromRoot
+        (grid.Comm(),"Autotuning ",TypeName<Field>()," on a ",grid.Height(),
+         " x ",grid.Width()," grid");
+    autotune::TuneGemm<Field>( grid, ctrl );
+    autotune::TuneTrsm<Field>( grid, ctrl );
+    autotune::TuneLU<Field>( grid, ctrl );
+    autotune::TuneCholesky<Field>( grid, ctrl );
+    autotune::TuneHermitianTridiag<Field>( grid, ctrl );
+    if( !ctrl.filename.empty() && grid.Rank() == 0 )
+        SaveTuningProfile( ctrl.filename );
+}
+
+#define PROTO(Field) \
+  template void Autotune<Field>( const Grid& grid, const AutotuneCtrl& ctrl );
+
+#define EL_NO_INT_PROTO
+#include <El/macros/Instantiate.h>
+
+} // namespace El
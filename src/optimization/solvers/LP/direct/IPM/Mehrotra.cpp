@@ -1951,7 +1951,8 @@ void EquilibratedMehrotra
     const Int degree = n;
     const Grid& grid = problem.A.Grid();
     const int commRank = grid.Rank();
-    Timer timer;
+    ScopedRegionTimers timers( ctrl.time, grid.Comm() );
+    RegionTimer mehrotraRegion("LP::Mehrotra");
 
     // TODO(poulson): Move these into the control structure
     Real gammaPerm, deltaPerm, betaPerm, gammaTmp, deltaTmp, betaTmp;
@@ -1989,25 +1990,24 @@ void EquilibratedMehrotra
     // The initialization involves an augmented KKT system, and so we can
     // only reuse the factorization metadata if the this IPM is using the
     // augmented formulation
-    if( commRank == 0 && ctrl.time )
-        timer.Start();
-    if( ctrl.system == AUGMENTED_KKT )
-    {
-        Initialize
-        ( problem, solution, sparseLDLFact,
-          ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift,
-          ctrl.solveCtrl );
-    }
-    else
     {
-        DistSparseLDLFactorization<Real> augmentedSparseLDLFact;
-        Initialize
-        ( problem, solution, augmentedSparseLDLFact,
-          ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift,
-          ctrl.solveCtrl );
+        RegionTimer region("Init");
+        if( ctrl.system == AUGMENTED_KKT )
+        {
+            Initialize
+            ( problem, solution, sparseLDLFact,
+              ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift,
+              ctrl.solveCtrl );
+        }
+        else
+        {
+            DistSparseLDLFactorization<Real> augmentedSparseLDLFact;
+            Initialize
+            ( problem, solution, augmentedSparseLDLFact,
+              ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift,
+              ctrl.solveCtrl );
+        }
     }
-    if( commRank == 0 && ctrl.time )
-        Output("Init: ",timer.Stop()," secs");
 
     DistMultiVec<Real> regTmp(grid);
     if( ctrl.system == FULL_KKT )
@@ -2186,60 +2186,57 @@ void EquilibratedMehrotra
             // -----------------------
             try
             {
-                if( commRank == 0 && ctrl.time )
-                    timer.Start();
-                if( wMaxNorm >= ctrl.ruizEquilTol )
-                {
-                    if( ctrl.print && commRank == 0 )
-                        Output("Running SymmetricRuizEquil");
-                    SymmetricRuizEquil
-                    ( J, dInner, ctrl.ruizMaxIter, ctrl.print );
-                }
-                else if( wMaxNorm >= ctrl.diagEquilTol )
                 {
-                    if( ctrl.print && commRank == 0 )
-                        Output("Running SymmetricDiagonalEquil");
-                    SymmetricDiagonalEquil( J, dInner, ctrl.print );
+                    RegionTimer region("Equilibration");
+                    if( wMaxNorm >= ctrl.ruizEquilTol )
+                    {
+                        if( ctrl.print && commRank == 0 )
+                            Output("Running SymmetricRuizEquil");
+                        SymmetricRuizEquil
+                        ( J, dInner, ctrl.ruizMaxIter, ctrl.print );
+                    }
+                    else if( wMaxNorm >= ctrl.diagEquilTol )
+                    {
+                        if( ctrl.print && commRank == 0 )
+                            Output("Running SymmetricDiagonalEquil");
+                        SymmetricDiagonalEquil( J, dInner, ctrl.print );
+                    }
+                    else
+                        Ones( dInner, J.Height(), 1 );
                 }
-                else
-                    Ones( dInner, J.Height(), 1 );
-                if( commRank == 0 && ctrl.time )
-                    Output("Equilibration: ",timer.Stop()," secs");
 
                 if( numIts == 0 &&
                     (ctrl.system != AUGMENTED_KKT ||
                      (ctrl.primalInit && ctrl.dualInit)) )
                 {
-                    if( commRank == 0 && ctrl.time )
-                        timer.Start();
-                    const bool hermitian = true;
-                    const BisectCtrl bisectCtrl;
-                    sparseLDLFact.Initialize( J, hermitian, bisectCtrl );
-                    if( commRank == 0 && ctrl.time )
-                        Output("Analysis: ",timer.Stop()," secs");
+                    {
+                        RegionTimer region("Analysis");
+                        const bool hermitian = true;
+                        const BisectCtrl bisectCtrl;
+                        sparseLDLFact.Initialize( J, hermitian, bisectCtrl );
+                    }
                 }
                 else
                     sparseLDLFact.ChangeNonzeroValues( J );
 
-                if( commRank == 0 && ctrl.time )
-                    timer.Start();
-                sparseLDLFact.Factor( LDL_2D );
-                if( commRank == 0 && ctrl.time )
-                    Output("LDL: ",timer.Stop()," secs");
+                {
+                    RegionTimer region("LDL");
+                    sparseLDLFact.Factor( LDL_2D );
+                }
 
-                if( commRank == 0 && ctrl.time )
-                    timer.Start();
-                if( ctrl.resolveReg )
-                    reg_ldl::SolveAfter
-                    ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
-                else
-                    reg_ldl::RegularizedSolveAfter
-                    ( JOrig, regTmp, dInner, sparseLDLFact, d,
-                      ctrl.solveCtrl.relTol,
-                      ctrl.solveCtrl.maxRefineIts,
-                      ctrl.solveCtrl.progress );
-                if( commRank == 0 && ctrl.time )
-                    Output("Affine: ",timer.Stop()," secs");
+                {
+                    RegionTimer region("Affine");
+                    if( ctrl.resolveReg )
+                        reg_ldl::SolveAfter
+                        ( JOrig, regTmp, dInner, sparseLDLFact, d,
+                          ctrl.solveCtrl );
+                    else
+                        reg_ldl::RegularizedSolveAfter
+                        ( JOrig, regTmp, dInner, sparseLDLFact, d,
+                          ctrl.solveCtrl.relTol,
+                          ctrl.solveCtrl.maxRefineIts,
+                          ctrl.solveCtrl.progress );
+                }
             }
             catch(...)
             {
@@ -2292,35 +2289,32 @@ void EquilibratedMehrotra
             {
                 if( numIts == 0 )
                 {
-                    if( commRank == 0 && ctrl.time )
-                        timer.Start();
-                    const bool hermitian = true;
-                    const BisectCtrl bisectCtrl;
-                    sparseLDLFact.Initialize( J, hermitian, bisectCtrl );
-                    if( commRank == 0 && ctrl.time )
-                        Output("Analysis: ",timer.Stop()," secs");
+                    {
+                        RegionTimer region("Analysis");
+                        const bool hermitian = true;
+                        const BisectCtrl bisectCtrl;
+                        sparseLDLFact.Initialize( J, hermitian, bisectCtrl );
+                    }
                 }
                 else
                 {
                     sparseLDLFact.ChangeNonzeroValues( J );
                 }
 
-                if( commRank == 0 && ctrl.time )
-                    timer.Start();
-                sparseLDLFact.Factor( LDL_2D );
-                if( commRank == 0 && ctrl.time )
-                    Output("LDL: ",timer.Stop()," secs");
+                {
+                    RegionTimer region("LDL");
+                    sparseLDLFact.Factor( LDL_2D );
+                }
 
-                if( commRank == 0 && ctrl.time )
-                    timer.Start();
-                reg_ldl::RegularizedSolveAfter
-                ( J, regTmp, sparseLDLFact, affineCorrection.y,
-                  ctrl.solveCtrl.relTol,
-                  ctrl.solveCtrl.maxRefineIts,
-                  ctrl.solveCtrl.progress,
-                  ctrl.solveCtrl.time );
-                if( commRank == 0 && ctrl.time )
-                    Output("Affine: ",timer.Stop()," secs");
+                {
+                    RegionTimer region("Affine");
+                    reg_ldl::RegularizedSolveAfter
+                    ( J, regTmp, sparseLDLFact, affineCorrection.y,
+                      ctrl.solveCtrl.relTol,
+                      ctrl.solveCtrl.maxRefineIts,
+                      ctrl.solveCtrl.progress,
+                      ctrl.solveCtrl.time );
+                }
             }
             catch(...)
             {
@@ -2420,19 +2414,19 @@ void EquilibratedMehrotra
               residual.dualConic, solution.z, d );
             try
             {
-                if( commRank == 0 && ctrl.time )
-                    timer.Start();
-                if( ctrl.resolveReg )
-                    reg_ldl::SolveAfter
-                    ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
-                else
-                    reg_ldl::RegularizedSolveAfter
-                    ( JOrig, regTmp, dInner, sparseLDLFact, d,
-                      ctrl.solveCtrl.relTol,
-                      ctrl.solveCtrl.maxRefineIts,
-                      ctrl.solveCtrl.progress );
-                if( commRank == 0 && ctrl.time )
-                    Output("Corrector: ",timer.Stop()," secs");
+                {
+                    RegionTimer region("Corrector");
+                    if( ctrl.resolveReg )
+                        reg_ldl::SolveAfter
+                        ( JOrig, regTmp, dInner, sparseLDLFact, d,
+                          ctrl.solveCtrl );
+                    else
+                        reg_ldl::RegularizedSolveAfter
+                        ( JOrig, regTmp, dInner, sparseLDLFact, d,
+                          ctrl.solveCtrl.relTol,
+                          ctrl.solveCtrl.maxRefineIts,
+                          ctrl.solveCtrl.progress );
+                }
             }
             catch(...)
             {
@@ -2451,19 +2445,19 @@ void EquilibratedMehrotra
               residual.dualConic, d );
             try
             {
-                if( commRank == 0 && ctrl.time )
-                    timer.Start();
-                if( ctrl.resolveReg )
-                    reg_ldl::SolveAfter
-                    ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
-                else
-                    reg_ldl::RegularizedSolveAfter
-                    ( JOrig, regTmp, dInner, sparseLDLFact, d,
-                      ctrl.solveCtrl.relTol,
-                      ctrl.solveCtrl.maxRefineIts,
-                      ctrl.solveCtrl.progress );
-                if( commRank == 0 && ctrl.time )
-                    Output("Corrector: ",timer.Stop()," secs");
+                {
+                    RegionTimer region("Corrector");
+                    if( ctrl.resolveReg )
+                        reg_ldl::SolveAfter
+                        ( JOrig, regTmp, dInner, sparseLDLFact, d,
+                          ctrl.solveCtrl );
+                    else
+                        reg_ldl::RegularizedSolveAfter
+                        ( JOrig, regTmp, dInner, sparseLDLFact, d,
+                          ctrl.solveCtrl.relTol,
+                          ctrl.solveCtrl.maxRefineIts,
+                          ctrl.solveCtrl.progress );
+                }
             }
             catch(...)
             {
@@ -2485,16 +2479,15 @@ void EquilibratedMehrotra
               residual.dualConic, correction.y );
             try
             {
-                if( commRank == 0 && ctrl.time )
-                    timer.Start();
-                reg_ldl::RegularizedSolveAfter
-                ( J, regTmp, sparseLDLFact, correction.y,
-                  ctrl.solveCtrl.relTol,
-                  ctrl.solveCtrl.maxRefineIts,
-                  ctrl.solveCtrl.progress,
-                  ctrl.solveCtrl.time );
-                if( commRank == 0 && ctrl.time )
-                    Output("Corrector: ",timer.Stop()," secs");
+                {
+                    RegionTimer region("Corrector");
+                    reg_ldl::RegularizedSolveAfter
+                    ( J, regTmp, sparseLDLFact, correction.y,
+                      ctrl.solveCtrl.relTol,
+                      ctrl.solveCtrl.maxRefineIts,
+                      ctrl.solveCtrl.progress,
+                      ctrl.solveCtrl.time );
+                }
             }
             catch(...)
             {
@@ -91,7 +91,9 @@ void TestGemm
     PushIndent();
     mpi::Barrier( g.Comm() );
     timer.Start();
+    mpi::PushProfileScope("Gemm (Stationary A)");
     Gemm( orientA, orientB, alpha, A, B, beta, C, GEMM_SUMMA_A );
+    mpi::PopProfileScope();
     mpi::Barrier( g.Comm() );
     runTime = timer.Stop();
     realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
@@ -110,7 +112,9 @@ void TestGemm
     PushIndent();
     mpi::Barrier( g.Comm() );
     timer.Start();
+    mpi::PushProfileScope("Gemm (Stationary B)");
     Gemm( orientA, orientB, alpha, A, B, beta, C, GEMM_SUMMA_B );
+    mpi::PopProfileScope();
     mpi::Barrier( g.Comm() );
     runTime = timer.Stop();
     realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
@@ -129,7 +133,9 @@ void TestGemm
     PushIndent();
     mpi::Barrier( g.Comm() );
     timer.Start();
+    mpi::PushProfileScope("Gemm (Stationary C)");
     Gemm( orientA, orientB, alpha, A, B, beta, C, GEMM_SUMMA_C );
+    mpi::PopProfileScope();
     mpi::Barrier( g.Comm() );
     runTime = timer.Stop();
     realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
@@ -143,6 +149,88 @@ void TestGemm
         ( orientA, orientB, alpha, A, B, beta, COrig, C, print );
     PopIndent();
 
+    // Test the variant of Gemm that keeps C stationary and overlaps the
+    // panel communication with the local updates
+    C = COrig;
+    OutputFromRoot(g.Comm(),"Pipelined stationary C Algorithm:");
+    PushIndent();
+    mpi::Barrier( g.Comm() );
+    timer.Start();
+    mpi::PushProfileScope("Gemm (Pipelined stationary C)");
+    Gemm( orientA, orientB, alpha, A, B, beta, C, GEMM_SUMMA_PIPELINED );
+    mpi::PopProfileScope();
+    mpi::Barrier( g.Comm() );
+    runTime = timer.Stop();
+    realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+    gFlops = ( IsComplex<T>::value ? 4*realGFlops : realGFlops );
+    OutputFromRoot
+    (g.Comm(),"Finished in ",runTime," seconds (",gFlops," GFlop/s)");
+    if( print )
+        Print( C, BuildString("C := ",alpha," A B + ",beta," C") );
+    if( correctness )
+        TestAssociativity
+        ( orientA, orientB, alpha, A, B, beta, COrig, C, print );
+    PopIndent();
+
+    // Test the variant of Gemm which replicates C over layers of processes
+    // which each handle a slice of the summation dimension
+    C = COrig;
+    OutputFromRoot(g.Comm(),"2.5D Algorithm:");
+    PushIndent();
+    mpi::Barrier( g.Comm() );
+    timer.Start();
+    mpi::PushProfileScope("Gemm (2.5D)");
+    Gemm( orientA, orientB, alpha, A, B, beta, C, GEMM_25D );
+    mpi::PopProfileScope();
+    mpi::Barrier( g.Comm() );
+    runTime = timer.Stop();
+    realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+    gFlops = ( IsComplex<T>::value ? 4*realGFlops : realGFlops );
+    OutputFromRoot
+    (g.Comm(),"Finished in ",runTime," seconds (",gFlops," GFlop/s)");
+    if( print )
+        Print( C, BuildString("C := ",alpha," A B + ",beta," C") );
+    if( correctness )
+        TestAssociativity
+        ( orientA, orientB, alpha, A, B, beta, COrig, C, print );
+    PopIndent();
+
+    // Unless the number of layers was specified, also force the layered
+    // algorithm to run (with multiple layers if the grid size allows)
+    if( Gemm25DLayers() == 0 )
+    {
+        const Int p = g.Size();
+        Int numLayers = 1;
+        for( Int c=2; c<=p; ++c )
+        {
+            if( p % c == 0 )
+            {
+                numLayers = c;
+                break;
+            }
+        }
+        SetGemm25DLayers( numLayers );
+        C = COrig;
+        OutputFromRoot(g.Comm(),"2.5D Algorithm with ",numLayers," layers:");
+        PushIndent();
+        mpi::Barrier( g.Comm() );
+        timer.Start();
+        Gemm( orientA, orientB, alpha, A, B, beta, C, GEMM_25D );
+        mpi::Barrier( g.Comm() );
+        runTime = timer.Stop();
+        realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+        gFlops = ( IsComplex<T>::value ? 4*realGFlops : realGFlops );
+        OutputFromRoot
+        (g.Comm(),"Finished in ",runTime," seconds (",gFlops," GFlop/s)");
+        if( print )
+            Print( C, BuildString("C := ",alpha," A B + ",beta," C") );
+        if( correctness )
+            TestAssociativity
+            ( orientA, orientB, alpha, A, B, beta, COrig, C, print );
+        PopIndent();
+        SetGemm25DLayers( 0 );
+    }
+
     if( orientA == NORMAL && orientB == NORMAL )
     {
         // Test the variant of Gemm for panel-panel dot products
@@ -151,7 +239,9 @@ void TestGemm
         C = COrig;
         mpi::Barrier( g.Comm() );
         timer.Start();
+        mpi::PushProfileScope("Gemm (Dot product)");
         Gemm( NORMAL, NORMAL, alpha, A, B, beta, C, GEMM_SUMMA_DOT );
+        mpi::PopProfileScope();
         mpi::Barrier( g.Comm() );
         runTime = timer.Stop();
         realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
@@ -192,9 +282,16 @@ main( int argc, char* argv[] )
         const Int rowAlignA = Input("--rowAlignA","row align of A",0);
         const Int rowAlignB = Input("--rowAlignB","row align of B",0);
         const Int rowAlignC = Input("--rowAlignC","row align of C",0);
+        const Int numLayers =
+          Input("--numLayers","number of 2.5D layers (0 for auto)",0);
+        const bool profileComm =
+          Input("--profileComm","profile the communication?",false);
         ProcessInput();
         PrintInputReport();
 
+        if( profileComm )
+            mpi::EnableProfiling();
+
         if( gridHeight == 0 )
             gridHeight = Grid::DefaultHeight( mpi::Size(comm) );
         const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
@@ -202,6 +299,7 @@ main( int argc, char* argv[] )
         const Orientation orientA = CharToOrientation( transA );
         const Orientation orientB = CharToOrientation( transB );
         SetBlocksize( nb );
+        SetGemm25DLayers( numLayers );
 
         ComplainIfDebug();
         OutputFromRoot(comm,"Will test Gemm",transA,transB);
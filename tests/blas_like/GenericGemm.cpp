@@ -0,0 +1,282 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Compare the packed generic Gemm (used for datatypes without a vendor BLAS)
+// against the naive triple loop
+template<typename T>
+void TestGenericGemm
+( char transA, char transB, Int m, Int n, Int k, bool print )
+{
+    Output("Testing with ",TypeName<T>());
+    PushIndent();
+
+    Matrix<T> A, B, COrig;
+    if( transA == 'N' )
+        Uniform( A, m, k );
+    else
+        Uniform( A, k, m );
+    if( transB == 'N' )
+        Uniform( B, k, n );
+    else
+        Uniform( B, n, k );
+    Uniform( COrig, m, n );
+    const T alpha = T(3);
+    const T beta = T(4);
+
+    Timer timer;
+    auto CNaive( COrig );
+    timer.Start();
+    blas::NaiveGemm
+    ( transA, transB, m, n, k,
+      alpha, A.LockedBuffer(), A.LDim(),
+             B.LockedBuffer(), B.LDim(),
+      beta,  CNaive.Buffer(),  CNaive.LDim() );
+    const double naiveTime = timer.Stop();
+    Output("Naive: ",naiveTime," seconds");
+
+    auto C( COrig );
+    timer.Start();
+    blas::Gemm
+    ( transA, transB, m, n, k,
+      alpha, A.LockedBuffer(), A.LDim(),
+             B.LockedBuffer(), B.LDim(),
+      beta,  C.Buffer(),       C.LDim() );
+    const double packedTime = timer.Stop();
+    Output
+    ("Packed: ",packedTime," seconds (speedup of ",naiveTime/packedTime,")");
+    if( print )
+    {
+        Print( CNaive, "CNaive" );
+        Print( C, "C" );
+    }
+
+    Base<T> maxDiff = 0, maxNaive = 0;
+    for( Int j=0; j<n; ++j )
+    {
+        for( Int i=0; i<m; ++i )
+        {
+            maxDiff = Max( maxDiff, Abs(C(i,j)-CNaive(i,j)) );
+            maxNaive = Max( maxNaive, Abs(CNaive(i,j)) );
+        }
+    }
+    Output("|| C - CNaive ||_max = ",maxDiff," (|| CNaive ||_max = ",
+      maxNaive,")");
+    if( maxDiff > Base<T>(k)*limits::Epsilon<Base<T>>()*maxNaive )
+        LogicError("Packed and naive generic Gemm results differ");
+    PopIndent();
+}
+
+template<typename T>
+void CheckAgainstNaive
+( const Matrix<T>& X, const Matrix<T>& XNaive, Int k, const string& label )
+{
+    Base<T> maxDiff = 0, maxNaive = 0;
+    for( Int j=0; j<X.Width(); ++j )
+    {
+        for( Int i=0; i<X.Height(); ++i )
+        {
+            maxDiff = Max( maxDiff, Abs(X(i,j)-XNaive(i,j)) );
+            maxNaive = Max( maxNaive, Abs(XNaive(i,j)) );
+        }
+    }
+    if( maxDiff > Base<T>(k)*limits::Epsilon<Base<T>>()*maxNaive )
+        LogicError
+        ("Blocked and unblocked generic ",label," results differ: ",maxDiff,
+         " (|| XNaive ||_max = ",maxNaive,")");
+}
+
+// A triangular matrix whose strictly triangular part is small enough for the
+// solves with it to be well-conditioned
+template<typename T>
+void TriangularOperand( Int n, Matrix<T>& A )
+{
+    Uniform( A, n, n );
+    A *= T(1)/T(n);
+    ShiftDiagonal( A, T(2) );
+}
+
+// Compare the blocked generic Trmm, Herk and Syrk against their unblocked
+// loops for every side, triangle and orientation, with triangles larger
+// than the diagonal blocks
+template<typename T>
+void TestGenericTriangular( Int n, Int k )
+{
+    Output("Testing triangular routines with ",TypeName<T>());
+    PushIndent();
+    const T alpha = T(3);
+    const T beta = T(4);
+    const string sides = "LR", uplos = "LU", orients = "NTC", units = "NU";
+
+    Matrix<T> A, BOrig;
+    for( const char side : sides )
+    {
+        const Int m = ( side == 'L' ? n : k );
+        const Int width = ( side == 'L' ? k : n );
+        Uniform( BOrig, m, width );
+        for( const char uplo : uplos )
+        for( const char orient : orients )
+        for( const char unit : units )
+        {
+            Uniform( A, n, n );
+            auto B( BOrig ), BNaive( BOrig );
+            blas::NaiveTrmm
+            ( side, uplo, orient, unit, m, width,
+              alpha, A.LockedBuffer(), A.LDim(),
+                     BNaive.Buffer(),  BNaive.LDim() );
+            blas::Trmm
+            ( side, uplo, orient, unit, m, width,
+              alpha, A.LockedBuffer(), A.LDim(),
+                     B.Buffer(),       B.LDim() );
+            CheckAgainstNaive
+            ( B, BNaive, n, BuildString("Trmm(",side,uplo,orient,unit,")") );
+        }
+    }
+
+    Matrix<T> COrig;
+    Uniform( COrig, n, n );
+    for( const char uplo : uplos )
+    {
+        for( const char orient : string("NT") )
+        {
+            if( orient == 'N' )
+                Uniform( A, n, k );
+            else
+                Uniform( A, k, n );
+            auto C( COrig ), CNaive( COrig );
+            blas::NaiveSyrk
+            ( uplo, orient, n, k,
+              alpha, A.LockedBuffer(), A.LDim(),
+              beta,  CNaive.Buffer(),  CNaive.LDim() );
+            blas::Syrk
+            ( uplo, orient, n, k,
+              alpha, A.LockedBuffer(), A.LDim(),
+              beta,  C.Buffer(),       C.LDim() );
+            // Only the referenced triangle of C is specified
+            MakeTrapezoidal( CharToUpperOrLower(uplo), C );
+            MakeTrapezoidal( CharToUpperOrLower(uplo), CNaive );
+            CheckAgainstNaive
+            ( C, CNaive, k, BuildString("Syrk(",uplo,orient,")") );
+        }
+        for( const char orient : string("NC") )
+        {
+            if( orient == 'N' )
+                Uniform( A, n, k );
+            else
+                Uniform( A, k, n );
+            auto C( COrig ), CNaive( COrig );
+            blas::NaiveHerk
+            ( uplo, orient, n, k,
+              RealPart(alpha), A.LockedBuffer(), A.LDim(),
+              RealPart(beta),  CNaive.Buffer(),  CNaive.LDim() );
+            blas::Herk
+            ( uplo, orient, n, k,
+              RealPart(alpha), A.LockedBuffer(), A.LDim(),
+              RealPart(beta),  C.Buffer(),       C.LDim() );
+            MakeTrapezoidal( CharToUpperOrLower(uplo), C );
+            MakeTrapezoidal( CharToUpperOrLower(uplo), CNaive );
+            CheckAgainstNaive
+            ( C, CNaive, k, BuildString("Herk(",uplo,orient,")") );
+        }
+    }
+    Output("Trmm, Syrk and Herk agree with their unblocked versions");
+    PopIndent();
+}
+
+// The generic Trsm is only available for fields
+template<typename F>
+void TestGenericTrsm( Int n, Int k )
+{
+    Output("Testing Trsm with ",TypeName<F>());
+    PushIndent();
+    const F alpha = F(3);
+    const string sides = "LR", uplos = "LU", orients = "NTC", units = "NU";
+
+    Matrix<F> A, BOrig;
+    for( const char side : sides )
+    {
+        const Int m = ( side == 'L' ? n : k );
+        const Int width = ( side == 'L' ? k : n );
+        Uniform( BOrig, m, width );
+        for( const char uplo : uplos )
+        for( const char orient : orients )
+        for( const char unit : units )
+        {
+            TriangularOperand( n, A );
+            auto B( BOrig ), BNaive( BOrig );
+            blas::NaiveTrsm
+            ( side, uplo, orient, unit, m, width,
+              alpha, A.LockedBuffer(), A.LDim(),
+                     BNaive.Buffer(),  BNaive.LDim() );
+            blas::Trsm
+            ( side, uplo, orient, unit, m, width,
+              alpha, A.LockedBuffer(), A.LDim(),
+                     B.Buffer(),       B.LDim() );
+            CheckAgainstNaive
+            ( B, BNaive, n, BuildString("Trsm(",side,uplo,orient,unit,")") );
+        }
+    }
+    Output("Trsm agrees with its unblocked version");
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const char transA = Input("--transA","orientation of A: N/T/C",'N');
+        const char transB = Input("--transB","orientation of B: N/T/C",'N');
+        const Int m = Input("--m","height of result",300);
+        const Int n = Input("--n","width of result",300);
+        const Int k = Input("--k","inner dimension",300);
+        const Int triSize =
+          Input("--triSize","triangle size for Trsm/Trmm/Herk/Syrk",150);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        // The generic BLAS is purely sequential, so only the root is used
+        if( mpi::Rank(comm) == 0 )
+        {
+            TestGenericGemm<Int>( transA, transB, m, n, k, print );
+            TestGenericTriangular<Int>( triSize, k );
+#ifdef EL_HAVE_QD
+            TestGenericGemm<DoubleDouble>( transA, transB, m, n, k, print );
+            TestGenericGemm<QuadDouble>( transA, transB, m, n, k, print );
+            TestGenericGemm<Complex<DoubleDouble>>
+            ( transA, transB, m, n, k, print );
+            TestGenericTriangular<DoubleDouble>( triSize, k );
+            TestGenericTriangular<Complex<DoubleDouble>>( triSize, k );
+            TestGenericTrsm<DoubleDouble>( triSize, k );
+            TestGenericTrsm<Complex<DoubleDouble>>( triSize, k );
+#endif
+#ifdef EL_HAVE_QUAD
+            TestGenericGemm<Quad>( transA, transB, m, n, k, print );
+            TestGenericGemm<Complex<Quad>>( transA, transB, m, n, k, print );
+            TestGenericTriangular<Quad>( triSize, k );
+            TestGenericTriangular<Complex<Quad>>( triSize, k );
+            TestGenericTrsm<Quad>( triSize, k );
+            TestGenericTrsm<Complex<Quad>>( triSize, k );
+#endif
+#ifdef EL_HAVE_MPC
+            TestGenericGemm<BigFloat>( transA, transB, m, n, k, print );
+            TestGenericTriangular<BigFloat>( triSize, k );
+            TestGenericTrsm<BigFloat>( triSize, k );
+#endif
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,342 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Compares the CSR and SELL-C-sigma sparse products, for both a single and
+// multiple right-hand sides, and reports their timings. Both are also
+// checked against a dense Gemm with a smaller, densified matrix.
+
+template<typename T>
+void RandomSparse( SparseMatrix<T>& A, Int n, Int nnzPerRow )
+{
+    Zeros( A, n, n );
+    A.Reserve( n*(nnzPerRow+1) );
+    for( Int i=0; i<n; ++i )
+    {
+        A.QueueUpdate( i, i, T(nnzPerRow) );
+        for( Int t=0; t<nnzPerRow; ++t )
+            A.QueueUpdate( i, SampleUniform<Int>(0,n), SampleUniform<T>() );
+    }
+    A.ProcessQueues();
+}
+
+template<typename T>
+void RandomSparse( DistSparseMatrix<T>& A, Int n, Int nnzPerRow )
+{
+    Zeros( A, n, n );
+    const Int localHeight = A.LocalHeight();
+    A.Reserve( localHeight*(nnzPerRow+1) );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = A.GlobalRow(iLoc);
+        A.QueueLocalUpdate( iLoc, i, T(nnzPerRow) );
+        // Mostly reference nearby columns so that most entries are interior
+        for( Int t=0; t<nnzPerRow; ++t )
+        {
+            const Int j =
+              ( t % 4 == 0 ? SampleUniform<Int>(0,n)
+                           : Max(Min(i+SampleUniform<Int>(-20,21),n-1),
+                                 Int(0)) );
+            A.QueueLocalUpdate( iLoc, j, SampleUniform<T>() );
+        }
+    }
+    A.ProcessLocalQueues();
+}
+
+template<typename T>
+void CheckAgainstDense
+( const Matrix<T>& Y, const Matrix<T>& YRef, const string& label )
+{
+    typedef Base<T> Real;
+    Matrix<T> E( Y );
+    E -= YRef;
+    const Real relError = FrobeniusNorm( E ) / FrobeniusNorm( YRef );
+    Output(label,": || Y - Y_dense ||_F / || Y_dense ||_F = ",relError);
+    if( relError > Sqrt(limits::Epsilon<Real>()) )
+        LogicError(label," did not match the dense product");
+}
+
+template<typename T>
+void CheckAgainstDense
+( const DistMultiVec<T>& Y, const DistMatrix<T>& YRef, const string& label )
+{
+    typedef Base<T> Real;
+    DistMatrix<T> E( YRef.Grid() );
+    Copy( Y, E );
+    E -= YRef;
+    const Real relError = FrobeniusNorm( E ) / FrobeniusNorm( YRef );
+    OutputFromRoot
+    (YRef.Grid().Comm(),
+     label,": || Y - Y_dense ||_F / || Y_dense ||_F = ",relError);
+    if( relError > Sqrt(limits::Epsilon<Real>()) )
+        LogicError(label," did not match the dense product");
+}
+
+template<typename T>
+void TestSequentialDense
+( Int n, Int nnzPerRow, Int numRHS, Int chunkSize, Int sigma )
+{
+    Output("Testing sequential products against Gemm with ",TypeName<T>());
+    PushIndent();
+
+    SparseMatrix<T> A;
+    RandomSparse( A, n, nnzPerRow );
+    SellCSigmaMatrix<T> ASell;
+    SparseToSell( A, ASell, chunkSize, sigma );
+    Matrix<T> ADense;
+    Copy( A, ADense );
+
+    const Orientation orientations[] = { NORMAL, TRANSPOSE, ADJOINT };
+    const Int widths[] = { 1, numRHS };
+    for( const Orientation orientation : orientations )
+    {
+        for( const Int width : widths )
+        {
+            Matrix<T> X, YOrig;
+            Uniform( X, n, width );
+            Uniform( YOrig, n, width );
+            const T alpha = SampleUniform<T>();
+            const T beta = SampleUniform<T>();
+
+            auto YRef = YOrig;
+            Gemm( orientation, NORMAL, alpha, ADense, X, beta, YRef );
+            auto YCSR = YOrig;
+            Multiply( orientation, alpha, A, X, beta, YCSR );
+            auto YSell = YOrig;
+            Multiply( orientation, alpha, ASell, X, beta, YSell );
+
+            const string label =
+              BuildString(OrientationToChar(orientation)," with ",width,
+                          " vectors");
+            CheckAgainstDense( YCSR, YRef, label+" (CSR)" );
+            CheckAgainstDense( YSell, YRef, label+" (SELL)" );
+        }
+    }
+    PopIndent();
+}
+
+template<typename T>
+void TestDistributedDense
+( Int n, Int nnzPerRow, Int numRHS, Int chunkSize, Int sigma,
+  const Grid& grid )
+{
+    OutputFromRoot
+    (grid.Comm(),"Testing distributed products against Gemm with ",
+     TypeName<T>());
+    PushIndent();
+
+    DistSparseMatrix<T> A(grid);
+    RandomSparse( A, n, nnzPerRow );
+    DistSellCSigmaMatrix<T> ASell;
+    SparseToSell( A, ASell, chunkSize, sigma );
+    DistMatrix<T> ADense(grid);
+    Copy( A, ADense );
+
+    const Orientation orientations[] = { NORMAL, TRANSPOSE, ADJOINT };
+    const Int widths[] = { 1, numRHS };
+    for( const Orientation orientation : orientations )
+    {
+        for( const Int width : widths )
+        {
+            DistMultiVec<T> X(grid), YOrig(grid);
+            Uniform( X, n, width );
+            Uniform( YOrig, n, width );
+            T alpha = SampleUniform<T>();
+            T beta = SampleUniform<T>();
+            mpi::Broadcast( alpha, 0, grid.Comm() );
+            mpi::Broadcast( beta, 0, grid.Comm() );
+
+            DistMatrix<T> XDense(grid), YRef(grid);
+            Copy( X, XDense );
+            Copy( YOrig, YRef );
+            Gemm( orientation, NORMAL, alpha, ADense, XDense, beta, YRef );
+            DistMultiVec<T> YCSR(grid), YSell(grid);
+            YCSR = YOrig;
+            Multiply( orientation, alpha, A, X, beta, YCSR );
+            YSell = YOrig;
+            Multiply( orientation, alpha, A, ASell, X, beta, YSell );
+
+            const string label =
+              BuildString(OrientationToChar(orientation)," with ",width,
+                          " vectors");
+            CheckAgainstDense( YCSR, YRef, label+" (CSR)" );
+            CheckAgainstDense( YSell, YRef, label+" (SELL)" );
+        }
+    }
+    PopIndent();
+}
+
+template<typename T>
+void TestSequential
+( Int n, Int nnzPerRow, Int numRHS, Int chunkSize, Int sigma, Int numReps )
+{
+    typedef Base<T> Real;
+    Output("Testing sequential products with ",TypeName<T>());
+    PushIndent();
+
+    SparseMatrix<T> A;
+    RandomSparse( A, n, nnzPerRow );
+    SellCSigmaMatrix<T> ASell;
+    Timer timer;
+    timer.Start();
+    SparseToSell( A, ASell, chunkSize, sigma );
+    Output("SELL conversion: ",timer.Stop()," seconds");
+    Output
+    ("SELL padding: ",ASell.values.size()," stored entries for ",
+     A.NumEntries()," nonzeros");
+
+    const Orientation orientations[] = { NORMAL, TRANSPOSE, ADJOINT };
+    const Int widths[] = { 1, numRHS };
+    for( const Orientation orientation : orientations )
+    {
+        for( const Int width : widths )
+        {
+            Matrix<T> X, YCSR, YSell;
+            Uniform( X, n, width );
+            Uniform( YCSR, n, width );
+            YSell = YCSR;
+            const T alpha = SampleUniform<T>();
+            const T beta = SampleUniform<T>();
+
+            timer.Start();
+            for( Int rep=0; rep<numReps; ++rep )
+                Multiply( orientation, alpha, A, X, beta, YCSR );
+            const double csrTime = timer.Stop() / numReps;
+
+            timer.Start();
+            for( Int rep=0; rep<numReps; ++rep )
+                Multiply( orientation, alpha, ASell, X, beta, YSell );
+            const double sellTime = timer.Stop() / numReps;
+
+            const Real YNorm = FrobeniusNorm( YCSR );
+            YSell -= YCSR;
+            const Real relError = FrobeniusNorm( YSell ) / YNorm;
+            Output
+            (OrientationToChar(orientation)," with ",width," vectors: CSR=",
+             csrTime,", SELL=",sellTime," seconds, || Y_SELL - Y_CSR ||_F / "
+             "|| Y_CSR ||_F = ",relError);
+            if( relError > Sqrt(limits::Epsilon<Real>()) )
+                LogicError("SELL and CSR products did not match");
+        }
+    }
+    PopIndent();
+}
+
+template<typename T>
+void TestDistributed
+( Int n, Int nnzPerRow, Int numRHS, Int chunkSize, Int sigma, Int numReps,
+  const Grid& grid )
+{
+    typedef Base<T> Real;
+    OutputFromRoot
+    (grid.Comm(),"Testing distributed products with ",TypeName<T>());
+    PushIndent();
+
+    DistSparseMatrix<T> A(grid);
+    RandomSparse( A, n, nnzPerRow );
+    DistSellCSigmaMatrix<T> ASell;
+    Timer timer;
+    timer.Start();
+    SparseToSell( A, ASell, chunkSize, sigma );
+    OutputFromRoot(grid.Comm(),"SELL conversion: ",timer.Stop()," seconds");
+
+    const Orientation orientations[] = { NORMAL, TRANSPOSE, ADJOINT };
+    const Int widths[] = { 1, numRHS };
+    for( const Orientation orientation : orientations )
+    {
+        for( const Int width : widths )
+        {
+            DistMultiVec<T> X(grid), YCSR(grid), YSell(grid);
+            Uniform( X, n, width );
+            Uniform( YCSR, n, width );
+            YSell = YCSR;
+            T alpha = SampleUniform<T>();
+            T beta = SampleUniform<T>();
+            mpi::Broadcast( alpha, 0, grid.Comm() );
+            mpi::Broadcast( beta, 0, grid.Comm() );
+
+            mpi::Barrier( grid.Comm() );
+            timer.Start();
+            for( Int rep=0; rep<numReps; ++rep )
+                Multiply( orientation, alpha, A, X, beta, YCSR );
+            mpi::Barrier( grid.Comm() );
+            const double csrTime = timer.Stop() / numReps;
+
+            timer.Start();
+            for( Int rep=0; rep<numReps; ++rep )
+                Multiply( orientation, alpha, A, ASell, X, beta, YSell );
+            mpi::Barrier( grid.Comm() );
+            const double sellTime = timer.Stop() / numReps;
+
+            const Real YNorm = FrobeniusNorm( YCSR );
+            YSell -= YCSR;
+            const Real relError = FrobeniusNorm( YSell ) / YNorm;
+            OutputFromRoot
+            (grid.Comm(),
+             OrientationToChar(orientation)," with ",width," vectors: CSR=",
+             csrTime,", SELL=",sellTime," seconds, || Y_SELL - Y_CSR ||_F / "
+             "|| Y_CSR ||_F = ",relError);
+            if( relError > Sqrt(limits::Epsilon<Real>()) )
+                LogicError("SELL and CSR products did not match");
+        }
+    }
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","matrix size",20000);
+        const Int nnzPerRow = Input("--nnzPerRow","nonzeros per row",16);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",8);
+        const Int chunkSize = Input("--chunkSize","SELL chunk size",8);
+        const Int sigma = Input("--sigma","SELL sorting window",128);
+        const Int numReps = Input("--numReps","number of repetitions",5);
+        const Int nDense =
+          Input("--nDense","matrix size for the dense comparison",300);
+        const bool sequential = Input("--sequential","test sequential?",true);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        if( sequential && mpi::Rank(comm) == 0 )
+        {
+            TestSequentialDense<float>
+            ( nDense, nnzPerRow, numRHS, chunkSize, sigma );
+            TestSequentialDense<Complex<double>>
+            ( nDense, nnzPerRow, numRHS, chunkSize, sigma );
+
+            TestSequential<float>
+            ( n, nnzPerRow, numRHS, chunkSize, sigma, numReps );
+            TestSequential<double>
+            ( n, nnzPerRow, numRHS, chunkSize, sigma, numReps );
+            TestSequential<Complex<double>>
+            ( n, nnzPerRow, numRHS, chunkSize, sigma, numReps );
+        }
+        TestDistributedDense<float>
+        ( nDense, nnzPerRow, numRHS, chunkSize, sigma, grid );
+        TestDistributedDense<Complex<double>>
+        ( nDense, nnzPerRow, numRHS, chunkSize, sigma, grid );
+
+        TestDistributed<float>
+        ( n, nnzPerRow, numRHS, chunkSize, sigma, numReps, grid );
+        TestDistributed<double>
+        ( n, nnzPerRow, numRHS, chunkSize, sigma, numReps, grid );
+        TestDistributed<Complex<double>>
+        ( n, nnzPerRow, numRHS, chunkSize, sigma, numReps, grid );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
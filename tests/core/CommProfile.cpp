@@ -0,0 +1,108 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// A routine outside of El::mpi whose parameter list nonetheless mentions
+// El::mpi, so that (in debug builds) its communication must be attributed to
+// it rather than to its caller
+double SumOverProcesses( double value, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    return mpi::AllReduce( value, comm );
+}
+
+// The expected scope of communication issued by 'routine' within the given
+// profile scope
+string ExpectedScope( const string& scope, const string& routine )
+{
+#ifdef EL_RELEASE
+    return scope;
+#else
+    return scope + " / " + routine;
+#endif
+}
+
+void TestAttribution( Int n )
+{
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commSize = mpi::Size( comm );
+
+    mpi::ResetProfile();
+    mpi::EnableProfiling();
+    {
+        mpi::ProfileScope scope("Sum");
+        const double sum = SumOverProcesses( 1., comm );
+        if( sum != double(commSize) )
+            LogicError("Sum was ",sum," rather than ",commSize);
+    }
+    const Grid grid( comm );
+    DistMatrix<double> A(grid);
+    Uniform( A, n, n );
+    {
+        mpi::ProfileScope scope("Redistribute");
+        DistMatrix<double,STAR,STAR> A_STAR_STAR( A );
+    }
+    mpi::DisableProfiling();
+
+    const auto scopes = mpi::ProfiledScopes();
+    for( const auto& scope : scopes )
+        OutputFromRoot
+        (comm,"Profiled scope: ",scope," (",mpi::ProfiledCalls(scope),
+         " calls)");
+
+    const string sumScope = ExpectedScope( "Sum", "SumOverProcesses" );
+    if( mpi::ProfiledCalls(sumScope) != 1 )
+        LogicError
+        ("Expected one call attributed to ",sumScope," but found ",
+         mpi::ProfiledCalls(sumScope));
+
+    // Every redistribution call must be attributed to a routine outside of
+    // El::mpi (in debug builds)
+    Int numRedistCalls = 0;
+    for( const auto& scope : scopes )
+    {
+        if( scope.compare(0,12,"Redistribute") != 0 )
+            continue;
+        numRedistCalls += mpi::ProfiledCalls( scope );
+#ifndef EL_RELEASE
+        if( scope.find(" / El::") == string::npos ||
+            scope.find("El::mpi::") != string::npos )
+            LogicError("Communication was attributed to ",scope);
+#endif
+    }
+    if( commSize > 1 && numRedistCalls == 0 )
+        LogicError("The redistribution was not profiled");
+
+    // Nothing is recorded while profiling is disabled
+    SumOverProcesses( 1., comm );
+    if( mpi::ProfiledScopes() != scopes || mpi::ProfiledCalls(sumScope) != 1 )
+        LogicError("Communication was recorded while profiling was disabled");
+    mpi::ResetProfile();
+    if( !mpi::ProfiledScopes().empty() )
+        LogicError("The profile was not reset");
+    OutputFromRoot(comm,"Profile attribution tests passed");
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int n = Input("--n","matrix size",100);
+        ProcessInput();
+        PrintInputReport();
+
+        TestAttribution( n );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -34,13 +34,27 @@ Check( DistMatrix<T,AColDist,ARowDist>& A,
         LogicError
         ("A ~ ",A.Height()," x ",A.Width(),", B ~ ",B.Height()," x ",B.Width());
 
-    DistMatrix<T,STAR,STAR> A_STAR_STAR(A), B_STAR_STAR(B);
+    // Also redistribute through a plan which is reused (without being
+    // rebuilt) for a second copy into the zeroed result
+    DistMatrix<T,AColDist,ARowDist> APlan(g);
+    APlan.Align( colAlign, rowAlign );
+    RedistributionPlan plan;
+    copy::GeneralPurpose( B, APlan, plan );
+    Zero( APlan );
+    copy::GeneralPurpose( B, APlan, plan );
+    if( plan.NumBuilds() != 1 )
+        LogicError
+        ("The redistribution plan was built ",plan.NumBuilds()," times");
+
+    DistMatrix<T,STAR,STAR> A_STAR_STAR(A), B_STAR_STAR(B),
+                            APlan_STAR_STAR(APlan);
     Int myErrorFlag = 0;
     for( Int j=0; j<width; ++j )
     {
         for( Int i=0; i<height; ++i )
         {
-            if( A_STAR_STAR.GetLocal(i,j) != B_STAR_STAR.GetLocal(i,j) )
+            if( A_STAR_STAR.GetLocal(i,j) != B_STAR_STAR.GetLocal(i,j) ||
+                APlan_STAR_STAR.GetLocal(i,j) != B_STAR_STAR.GetLocal(i,j) )
             {
                 myErrorFlag = 1;
                 break;
@@ -0,0 +1,195 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Lower the maximum message count so that the chunked and pairwise paths of
+// the large-count wrappers are exercised by modestly-sized messages. The
+// counts are passed as 'long long', which is never 'int', so that the
+// large-count overloads are selected regardless of EL_USE_64BIT_INTS.
+typedef long long Count;
+
+double Value( int q, Int i ) { return 1000.*q + i; }
+
+void CheckEqual
+( const vector<double>& x, const vector<double>& xRef, const string& label )
+{
+    if( x.size() != xRef.size() )
+        LogicError(label," produced ",x.size()," entries instead of ",
+                   xRef.size());
+    for( size_t i=0; i<x.size(); ++i )
+        if( x[i] != xRef[i] )
+            LogicError(label," produced ",x[i]," instead of ",xRef[i],
+                       " in entry ",i);
+}
+
+void TestBroadcast( Int n, mpi::Comm comm )
+{
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    const int root = commSize-1;
+    vector<double> x(n), xRef(n);
+    for( Int i=0; i<n; ++i )
+    {
+        xRef[i] = Value(root,i);
+        x[i] = ( commRank == root ? xRef[i] : -1 );
+    }
+    mpi::Broadcast( x.data(), Count(n), root, comm );
+    CheckEqual( x, xRef, "Broadcast" );
+}
+
+void TestAllGather( Int n, mpi::Comm comm )
+{
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    vector<double> x(n), y(n*commSize), yRef(n*commSize);
+    for( Int i=0; i<n; ++i )
+        x[i] = Value(commRank,i);
+    for( int q=0; q<commSize; ++q )
+        for( Int i=0; i<n; ++i )
+            yRef[q*n+i] = Value(q,i);
+    mpi::AllGather( x.data(), Count(n), y.data(), Count(n), comm );
+    CheckEqual( y, yRef, "AllGather" );
+
+    // Process q contributes n+q entries
+    vector<Count> recvCounts(commSize), recvOffs(commSize);
+    Count totalRecv = 0;
+    for( int q=0; q<commSize; ++q )
+    {
+        recvCounts[q] = n+q;
+        recvOffs[q] = totalRecv;
+        totalRecv += recvCounts[q];
+    }
+    vector<double> z(n+commRank), w(totalRecv), wRef(totalRecv);
+    for( Int i=0; i<n+commRank; ++i )
+        z[i] = Value(commRank,i);
+    for( int q=0; q<commSize; ++q )
+        for( Int i=0; i<n+q; ++i )
+            wRef[recvOffs[q]+i] = Value(q,i);
+    mpi::AllGather
+    ( z.data(), Count(n+commRank),
+      w.data(), recvCounts.data(), recvOffs.data(), comm );
+    CheckEqual( w, wRef, "Variable-size AllGather" );
+}
+
+void TestAllToAll( Int n, mpi::Comm comm )
+{
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+
+    // Entry i of the block sent from process p to process q is
+    // Value(p,q*n+i)
+    vector<double> x(n*commSize), y(n*commSize), yRef(n*commSize);
+    for( int q=0; q<commSize; ++q )
+        for( Int i=0; i<n; ++i )
+        {
+            x[q*n+i] = Value(commRank,q*n+i);
+            yRef[q*n+i] = Value(q,commRank*n+i);
+        }
+    mpi::AllToAll( x.data(), Count(n), y.data(), Count(n), comm );
+    CheckEqual( y, yRef, "AllToAll" );
+
+    // Process p sends n+p+q entries to process q
+    vector<Count> sendCounts(commSize), sendOffs(commSize),
+                  recvCounts(commSize), recvOffs(commSize);
+    Count totalSend=0, totalRecv=0;
+    for( int q=0; q<commSize; ++q )
+    {
+        sendCounts[q] = n+commRank+q;
+        sendOffs[q] = totalSend;
+        totalSend += sendCounts[q];
+        recvCounts[q] = n+q+commRank;
+        recvOffs[q] = totalRecv;
+        totalRecv += recvCounts[q];
+    }
+    vector<double> z(totalSend), w(totalRecv), wRef(totalRecv);
+    for( int q=0; q<commSize; ++q )
+    {
+        for( Count i=0; i<sendCounts[q]; ++i )
+            z[sendOffs[q]+i] = Value(commRank,q*(n+commSize)+i);
+        for( Count i=0; i<recvCounts[q]; ++i )
+            wRef[recvOffs[q]+i] = Value(q,commRank*(n+commSize)+i);
+    }
+    mpi::AllToAll
+    ( z.data(), sendCounts.data(), sendOffs.data(),
+      w.data(), recvCounts.data(), recvOffs.data(), comm );
+    CheckEqual( w, wRef, "Variable-size AllToAll" );
+}
+
+void TestNonblocking( Int n, mpi::Comm comm )
+{
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    const int to = Mod( commRank+1, commSize );
+    const int from = Mod( commRank-1, commSize );
+
+    // A message which fits within the limit is sent as a single request
+    const Int maxCount = mpi::MaxMessageCount();
+    const Int count = Min( n, maxCount );
+    vector<double> x(count), y(count,-1), yRef(count);
+    for( Int i=0; i<count; ++i )
+    {
+        x[i] = Value(commRank,i);
+        yRef[i] = Value(from,i);
+    }
+    mpi::Request<double> requests[2];
+    mpi::IRecv( y.data(), Count(count), from, comm, requests[0] );
+    mpi::ISend( x.data(), Count(count), to, comm, requests[1] );
+    mpi::WaitAll( 2, requests );
+    CheckEqual( y, yRef, "ISend/IRecv" );
+
+    // ...whereas one which does not must be rejected rather than truncated
+    vector<double> z(maxCount+1);
+    bool sendThrew=false, recvThrew=false;
+    try
+    {
+        mpi::Request<double> request;
+        mpi::ISend( z.data(), Count(maxCount+1), to, comm, request );
+    }
+    catch( std::exception& ) { sendThrew = true; }
+    try
+    {
+        mpi::Request<double> request;
+        mpi::IRecv( z.data(), Count(maxCount+1), from, comm, request );
+    }
+    catch( std::exception& ) { recvThrew = true; }
+    if( !sendThrew || !recvThrew )
+        LogicError("Oversized non-blocking messages were not rejected");
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","number of entries per message",100);
+        const Int maxCount =
+          Input("--maxCount","maximum entries per MPI call",7);
+        ProcessInput();
+        PrintInputReport();
+
+        const Int oldMaxCount = mpi::MaxMessageCount();
+        mpi::SetMaxMessageCount( maxCount );
+
+        TestBroadcast( n, comm );
+        TestAllGather( n, comm );
+        TestAllToAll( n, comm );
+        TestNonblocking( n, comm );
+
+        mpi::SetMaxMessageCount( oldMaxCount );
+        OutputFromRoot
+        (comm,"Large-count tests passed with messages of ",n,
+         " entries split into chunks of at most ",maxCount);
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
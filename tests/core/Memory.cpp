@@ -0,0 +1,114 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T>
+void TestMemory( Int numBuffers, Int maxSize, size_t alignment )
+{
+    Output("Testing with ",TypeName<T>());
+
+    const MemoryStats origStats = GetMemoryStats();
+    {
+        vector<Matrix<T>> matrices(numBuffers);
+        for( Int k=0; k<numBuffers; ++k )
+        {
+            const Int m = SampleUniform<Int>(1,maxSize);
+            matrices[k].Resize( m, m );
+            const size_t address = size_t(matrices[k].Buffer());
+            if( address % alignment != 0 )
+                LogicError("Buffer ",k," was not ",alignment,"-byte aligned");
+            Ones( matrices[k], m, m );
+        }
+        const MemoryStats liveStats = GetMemoryStats();
+        if( liveStats.liveBytes <= origStats.liveBytes )
+            LogicError("Live bytes did not increase");
+        if( liveStats.peakBytes < liveStats.liveBytes )
+            LogicError("Peak bytes were smaller than live bytes");
+    }
+    const MemoryStats finalStats = GetMemoryStats();
+    if( finalStats.liveBytes != origStats.liveBytes )
+        LogicError
+        ("Live bytes changed from ",origStats.liveBytes," to ",
+         finalStats.liveBytes);
+    if( finalStats.numAllocations-origStats.numAllocations !=
+        finalStats.numFrees-origStats.numFrees )
+        LogicError("Allocation and free counts did not match");
+
+    // Freeing and then requiring a buffer of the same size should be served
+    // from the pool
+    auto pool = std::dynamic_pointer_cast<PoolAllocator>( GetAllocator() );
+    if( pool && pool->Ctrl().pool )
+    {
+        const Int m = SampleUniform<Int>(1,maxSize);
+        { Matrix<T> A( m, m ); }
+        const size_t origHits = pool->NumPoolHits();
+        { Matrix<T> A( m, m ); }
+        if( pool->NumPoolHits() != origHits+1 )
+            LogicError
+            ("Pool hits changed from ",origHits," to ",pool->NumPoolHits(),
+             " rather than being incremented");
+    }
+
+    Output("passed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    try
+    {
+        const Int numBuffers = Input("--numBuffers","number of buffers",100);
+        const Int maxSize = Input("--maxSize","max matrix dimension",200);
+        const Int alignment = Input("--alignment","byte alignment",64);
+        const bool pool = Input("--pool","pool buffers?",true);
+        const bool hugePages = Input("--hugePages","use huge pages?",false);
+        const bool firstTouch = Input("--firstTouch","first-touch?",false);
+        const bool print = Input("--print","print statistics?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        AllocatorCtrl ctrl;
+        ctrl.alignment = alignment;
+        ctrl.pool = pool;
+        ctrl.hugePages = hugePages;
+        ctrl.firstTouch = firstTouch;
+        SetAllocatorCtrl( ctrl );
+
+        if( mpi::Rank(mpi::COMM_WORLD) == 0 )
+        {
+            TestMemory<float>( numBuffers, maxSize, alignment );
+            TestMemory<Complex<float>>( numBuffers, maxSize, alignment );
+
+            TestMemory<double>( numBuffers, maxSize, alignment );
+            TestMemory<Complex<double>>( numBuffers, maxSize, alignment );
+
+#ifdef EL_HAVE_QD
+            TestMemory<DoubleDouble>( numBuffers, maxSize, alignment );
+            TestMemory<QuadDouble>( numBuffers, maxSize, alignment );
+#endif
+
+#ifdef EL_HAVE_QUAD
+            TestMemory<Quad>( numBuffers, maxSize, alignment );
+            TestMemory<Complex<Quad>>( numBuffers, maxSize, alignment );
+#endif
+
+#ifdef EL_HAVE_MPC
+            TestMemory<BigFloat>( numBuffers, maxSize, alignment );
+            TestMemory<Complex<BigFloat>>( numBuffers, maxSize, alignment );
+#endif
+            if( print )
+                PrintMemoryStats();
+        }
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
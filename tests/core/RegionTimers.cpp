@@ -0,0 +1,201 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include <cstdio>
+#include <fstream>
+using namespace El;
+
+// Enter 'Outer' once, with 'numInner' nested entries into 'Inner', and then
+// enter a separate top-level 'Inner' once
+void RunRegions( Int numInner )
+{
+    {
+        RegionTimer outer("Outer");
+        for( Int k=0; k<numInner; ++k )
+        {
+            RegionTimer inner("Inner");
+            Matrix<double> A;
+            Uniform( A, 50, 50 );
+            Matrix<double> B( A );
+            Gemm( NORMAL, NORMAL, 1., A, B, 0., A );
+        }
+    }
+    RegionTimer inner("Inner");
+}
+
+Int CountOccurrences( const string& str, const string& pattern )
+{
+    Int count = 0;
+    for( size_t pos=str.find(pattern); pos!=string::npos;
+         pos=str.find(pattern,pos+pattern.size()) )
+        ++count;
+    return count;
+}
+
+void TestNesting( Int numInner )
+{
+    ResetRegionTimers();
+    EnableRegionTimers();
+    RunRegions( numInner );
+    if( RegionCalls("Outer") != 1 )
+        LogicError("Outer was entered ",RegionCalls("Outer")," times");
+    if( RegionCalls("Outer/Inner") != numInner )
+        LogicError
+        ("Outer/Inner was entered ",RegionCalls("Outer/Inner")," times");
+    if( RegionCalls("Inner") != 1 )
+        LogicError("Inner was entered ",RegionCalls("Inner")," times");
+    if( RegionCalls("Outer/Missing") != 0 || RegionTime("Missing") != 0. )
+        LogicError("A region which was never entered had statistics");
+    if( RegionTime("Outer/Inner") <= 0. ||
+        RegionTime("Outer") < RegionTime("Outer/Inner") )
+        LogicError
+        ("Inclusive times were not nested: Outer took ",RegionTime("Outer"),
+         " and Outer/Inner took ",RegionTime("Outer/Inner"));
+
+    // Nothing is recorded while the timers are disabled
+    DisableRegionTimers();
+    RunRegions( numInner );
+    if( RegionCalls("Outer") != 1 || RegionCalls("Outer/Inner") != numInner )
+        LogicError("Disabled region timers recorded entries");
+
+    // ScopedRegionTimers owns the timers only if they were disabled
+    {
+        ScopedRegionTimers timers( true, mpi::COMM_WORLD );
+        if( !RegionTimersEnabled() || RegionCalls("Outer") != 0 )
+            LogicError("ScopedRegionTimers did not reset and enable");
+        RunRegions( numInner );
+    }
+    if( RegionTimersEnabled() || RegionCalls("Outer") != 0 )
+        LogicError("ScopedRegionTimers did not disable and reset");
+    OutputFromRoot(mpi::COMM_WORLD,"Nesting tests passed");
+}
+
+void TestAggregation( Int numInner )
+{
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+
+    // Only the root enters 'RootOnly', so its minimum time is zero
+    ResetRegionTimers();
+    EnableRegionTimers();
+    RunRegions( numInner );
+    if( commRank == 0 )
+    {
+        RegionTimer region("RootOnly");
+    }
+    std::ostringstream os;
+    PrintRegionTimers( comm, os );
+    DisableRegionTimers();
+    if( commRank != 0 )
+        return;
+
+    const string summary = os.str();
+    if( summary.find("over "+std::to_string(commSize)+" processes") ==
+        string::npos )
+        LogicError("Summary did not report ",commSize," processes");
+    std::istringstream summaryStream( summary );
+    string line;
+    std::getline( summaryStream, line ); // Title
+    std::getline( summaryStream, line ); // Column headers
+    vector<string> names;
+    vector<Int> calls;
+    vector<double> minTimes;
+    while( std::getline( summaryStream, line ) )
+    {
+        // Preserve the indentation of the names
+        const size_t nameBeg = line.find_first_not_of(' ');
+        const size_t nameEnd = line.find_first_of(' ',nameBeg);
+        names.push_back( line.substr(0,nameEnd) );
+        std::istringstream lineStream( line.substr(nameEnd) );
+        Int numCalls;
+        double minTime;
+        lineStream >> numCalls >> minTime;
+        calls.push_back( numCalls );
+        minTimes.push_back( minTime );
+    }
+    // The paths are sorted, so each region precedes its subregions
+    const vector<string> expectedNames = { "Inner", "Outer", "  Inner",
+                                           "RootOnly" };
+    const vector<Int> expectedCalls = { 1, 1, numInner, 1 };
+    if( names != expectedNames )
+        LogicError("Unexpected summary:\n",summary);
+    for( size_t k=0; k<names.size(); ++k )
+        if( calls[k] != expectedCalls[k] )
+            LogicError
+            ("Region ",names[k]," reported ",calls[k]," calls instead of ",
+             expectedCalls[k]);
+    if( commSize > 1 && minTimes[3] != 0. )
+        LogicError("Region entered by one process had a nonzero minimum");
+    Output("Aggregation tests passed");
+}
+
+void TestTrace( Int numInner, const string& filename )
+{
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+
+    ResetRegionTimers();
+    EnableRegionTrace();
+    RunRegions( numInner );
+    WriteRegionTrace( filename, comm );
+    DisableRegionTrace();
+    DisableRegionTimers();
+    ResetRegionTimers();
+    if( commRank != 0 )
+        return;
+
+    std::ifstream file( filename.c_str() );
+    if( !file.is_open() )
+        LogicError("Could not open ",filename);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    file.close();
+    std::remove( filename.c_str() );
+    const string trace = contents.str();
+
+    if( trace.compare(0,15,"{\"traceEvents\":") != 0 ||
+        trace.find("\n]}") == string::npos )
+        LogicError("The trace was not a traceEvents JSON object");
+    const Int numEvents = CountOccurrences( trace, "\"ph\":\"X\"" );
+    if( numEvents != commSize*(numInner+2) )
+        LogicError
+        ("The trace contained ",numEvents," events instead of ",
+         commSize*(numInner+2));
+    if( CountOccurrences( trace, "\"path\":\"Outer/Inner\"" ) !=
+        commSize*numInner )
+        LogicError("The trace did not record the nested paths");
+    for( int q=0; q<commSize; ++q )
+        if( CountOccurrences( trace, "\"pid\":"+std::to_string(q)+"," ) !=
+            numInner+2 )
+            LogicError("The trace did not record the events of rank ",q);
+    Output("Trace tests passed");
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int numInner = Input("--numInner","number of nested regions",3);
+        const string filename =
+          Input("--trace","trace filename",string("RegionTimersTrace.json"));
+        ProcessInput();
+        PrintInputReport();
+
+        TestNesting( numInner );
+        TestAggregation( numInner );
+        TestTrace( numInner, filename );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
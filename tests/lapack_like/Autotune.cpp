@@ -0,0 +1,116 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename F>
+void TestAutotune( const Grid& g, const AutotuneCtrl& ctrl )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<F>());
+    PushIndent();
+
+    typedef Base<F> Real;
+    ClearTunedParameters();
+    const Int localTrrkBlocksize = LocalTrrkBlocksize<F>();
+    const Int localSymvBlocksize = LocalSymvBlocksize<F>();
+    Autotune<F>( g, ctrl );
+    const Int gemmBlocksize = TunedBlocksize<F>( "Gemm", g );
+    const Int luBlocksize = TunedBlocksize<F>( "LU", g );
+    const GemmHeuristics heuristics = TunedGemmHeuristics<F>( g );
+    OutputFromRoot
+    (g.Comm(),"Gemm blocksize: ",gemmBlocksize,", LU blocksize: ",luBlocksize,
+     ", weightTowardsC: ",heuristics.weightTowardsC,
+     ", weightAwayFromDot: ",heuristics.weightAwayFromDot,
+     ", dotBlocksize: ",heuristics.dotBlocksize);
+
+    // Ensure that the saved profile reproduces the tuned parameters
+    mpi::Barrier( g.Comm() );
+    ClearTunedParameters();
+    if( HaveTunedParameters() )
+        LogicError("Tuned parameters were not cleared");
+    LoadTuningProfile( ctrl.filename );
+    if( TunedBlocksize<F>( "Gemm", g ) != gemmBlocksize ||
+        TunedBlocksize<F>( "LU", g ) != luBlocksize ||
+        TunedGemmHeuristics<F>( g ).weightTowardsC !=
+        heuristics.weightTowardsC ||
+        TunedGemmHeuristics<F>( g ).weightAwayFromDot !=
+        heuristics.weightAwayFromDot ||
+        TunedGemmHeuristics<F>( g ).dotBlocksize != heuristics.dotBlocksize )
+        LogicError("Loaded tuning profile did not match the tuned parameters");
+
+    // Parameters for other grid shapes should fall back to the default
+    const Grid gOther( g.Comm(), 1 );
+    if( g.Height() != 1 && TunedBlocksize<F>( "Gemm", gOther ) != Blocksize() )
+        LogicError("Tuned blocksize was not specific to the grid shape");
+
+    // Ensure that the distributed kernels are still correct with the tuned
+    // values
+    const Int n = ctrl.size;
+    DistMatrix<F> A(g), AOrig(g), B(g), X(g);
+    DistPermutation P(g);
+    Uniform( AOrig, n, n );
+    A = AOrig;
+    LU( A, P );
+    Uniform( B, n, 1 );
+    X = B;
+    lu::SolveAfter( NORMAL, A, P, X );
+    Gemm( NORMAL, NORMAL, F(-1), AOrig, X, F(1), B );
+    const Real relResid =
+      FrobeniusNorm( B ) / (FrobeniusNorm( AOrig )*FrobeniusNorm( X ));
+    OutputFromRoot(g.Comm(),"|| B - A X ||_F / (|| A ||_F || X ||_F) = ",
+      relResid);
+    if( relResid > Real(n)*limits::Epsilon<Real>() )
+        LogicError("LU with the tuned parameters was inaccurate");
+
+    // Clearing the tuned parameters restores the local blocksizes
+    ClearTunedParameters();
+    if( LocalTrrkBlocksize<F>() != localTrrkBlocksize ||
+        LocalSymvBlocksize<F>() != localSymvBlocksize )
+        LogicError("Local blocksizes were not restored");
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        Int gridHeight = Input("--gridHeight","process grid height",0);
+        const Int n = Input("--n","size of the tuning problems",200);
+        const string filename =
+          Input("--filename","tuning profile","autotune.txt");
+        const bool progress = Input("--progress","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( gridHeight == 0 )
+            gridHeight = Grid::DefaultHeight( mpi::Size(comm) );
+        const Grid g( comm, gridHeight );
+        ComplainIfDebug();
+
+        AutotuneCtrl ctrl;
+        ctrl.size = n;
+        ctrl.blocksizes = {16,32,64};
+        ctrl.localBlocksizes = {16,64};
+        ctrl.dotBlocksizes = {50,100};
+        ctrl.gemmAspectRatios = {1,4};
+        ctrl.progress = progress;
+        ctrl.filename = filename;
+
+        TestAutotune<float>( g, ctrl );
+        TestAutotune<double>( g, ctrl );
+        TestAutotune<Complex<double>>( g, ctrl );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,227 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename F>
+void CheckDifference
+( const Matrix<F>& A, const Matrix<F>& AExpected, const string& label )
+{
+    typedef Base<F> Real;
+    Matrix<F> E( A );
+    E -= AExpected;
+    const Real relDiff = MaxNorm( E ) / Max( MaxNorm( AExpected ), Real(1) );
+    const Real tol = 1000*limits::Epsilon<Real>();
+    if( relDiff > tol )
+        LogicError(label," differed from the unbatched result by ",relDiff);
+}
+
+// The solutions of the (possibly ill-conditioned) systems are compared by
+// their residuals rather than directly
+template<typename F>
+void CheckResidual
+( const Matrix<F>& A, const Matrix<F>& X, const Matrix<F>& B,
+  const string& label )
+{
+    typedef Base<F> Real;
+    Matrix<F> R( B );
+    Gemm( NORMAL, NORMAL, F(-1), A, X, F(1), R );
+    const Real relResid =
+      InfinityNorm( R ) /
+      (A.Height()*limits::Epsilon<Real>()*InfinityNorm(A)*InfinityNorm(X));
+    if( relResid > Real(10) )
+        LogicError(label," had a relative residual of ",relResid);
+}
+
+template<typename F>
+void TestBatched( Int batchSize, Int n, Int numRHS )
+{
+    Output("Testing ",batchSize," problems of size ",n," with ",TypeName<F>());
+    PushIndent();
+    Timer timer;
+
+    // Gemm (in the strided format)
+    Matrix<F> A, B, C, CBatch;
+    Uniform( A, n, n*batchSize );
+    Uniform( B, n, n*batchSize );
+    Uniform( C, n, n*batchSize );
+    CBatch = C;
+    timer.Start();
+    BatchedGemm( NORMAL, ADJOINT, F(2), A, B, F(-1), CBatch, batchSize );
+    Output("BatchedGemm: ",timer.Stop()," seconds");
+    for( Int b=0; b<batchSize; ++b )
+    {
+        const IR ind( b*n, (b+1)*n );
+        auto Cb = C( ALL, ind );
+        Gemm( NORMAL, ADJOINT, F(2), A(ALL,ind), B(ALL,ind), F(-1), Cb );
+    }
+    CheckDifference( CBatch, C, "BatchedGemm" );
+
+    // Cholesky
+    vector<Matrix<F>> HPD( batchSize ), HPDBatch;
+    for( Int b=0; b<batchSize; ++b )
+        HermitianUniformSpectrum( HPD[b], n, Base<F>(1), Base<F>(10) );
+    for( auto uplo : { LOWER, UPPER } )
+    {
+        HPDBatch = HPD;
+        timer.Start();
+        BatchedCholesky( uplo, HPDBatch );
+        Output("BatchedCholesky: ",timer.Stop()," seconds");
+        for( Int b=0; b<batchSize; ++b )
+        {
+            Matrix<F> L( HPD[b] );
+            Cholesky( uplo, L );
+            MakeTrapezoidal( uplo, L );
+            MakeTrapezoidal( uplo, HPDBatch[b] );
+            CheckDifference( HPDBatch[b], L, "BatchedCholesky" );
+        }
+    }
+
+    // LU
+    vector<Matrix<F>> ALU( batchSize ), ALUBatch;
+    vector<Permutation> P;
+    for( Int b=0; b<batchSize; ++b )
+        Gaussian( ALU[b], n, n );
+    ALUBatch = ALU;
+    timer.Start();
+    BatchedLU( ALUBatch, P );
+    Output("BatchedLU: ",timer.Stop()," seconds");
+    for( Int b=0; b<batchSize; ++b )
+    {
+        Matrix<F> LU_b( ALU[b] );
+        Permutation P_b;
+        LU( LU_b, P_b );
+        CheckDifference( ALUBatch[b], LU_b, "BatchedLU" );
+        Matrix<Int> p, pBatch;
+        P_b.ExplicitVector( p );
+        P[b].ExplicitVector( pBatch );
+        for( Int i=0; i<n; ++i )
+            if( p(i) != pBatch(i) )
+                LogicError("BatchedLU chose different pivots");
+    }
+
+    // Solves
+    vector<Matrix<F>> X( batchSize ), XBatch;
+    for( Int b=0; b<batchSize; ++b )
+        Uniform( X[b], n, numRHS );
+    XBatch = X;
+    timer.Start();
+    BatchedLinearSolve( ALU, XBatch );
+    Output("BatchedLinearSolve: ",timer.Stop()," seconds");
+    for( Int b=0; b<batchSize; ++b )
+        CheckResidual( ALU[b], XBatch[b], X[b], "BatchedLinearSolve" );
+    for( auto uplo : { LOWER, UPPER } )
+    {
+        for( auto orientation : { NORMAL, TRANSPOSE } )
+        {
+            XBatch = X;
+            timer.Start();
+            BatchedHPDSolve( uplo, orientation, HPD, XBatch );
+            Output("BatchedHPDSolve: ",timer.Stop()," seconds");
+            for( Int b=0; b<batchSize; ++b )
+            {
+                Matrix<F> X_b( X[b] );
+                HPDSolve( uplo, orientation, HPD[b], X_b );
+                CheckDifference( XBatch[b], X_b, "BatchedHPDSolve" );
+            }
+        }
+    }
+
+    // Ensure that failures are reported without aborting the rest of the
+    // batch
+    const Int failure = batchSize/2;
+    HPDBatch = HPD;
+    Zero( HPDBatch[failure] );
+    try
+    {
+        BatchedCholesky( LOWER, HPDBatch );
+        LogicError("BatchedCholesky did not detect a non-HPD matrix");
+    }
+    catch( const NonHPDMatrixException& e )
+    { Output("Caught expected exception: ",e.what()); }
+    for( Int b=0; b<batchSize; ++b )
+    {
+        if( b == failure )
+            continue;
+        Matrix<F> L( HPD[b] );
+        Cholesky( LOWER, L );
+        MakeTrapezoidal( LOWER, L );
+        MakeTrapezoidal( LOWER, HPDBatch[b] );
+        CheckDifference( HPDBatch[b], L, "BatchedCholesky with a failure" );
+    }
+
+    ALUBatch = ALU;
+    Zero( ALUBatch[failure] );
+    try
+    {
+        BatchedLU( ALUBatch, P );
+        LogicError("BatchedLU did not detect a singular matrix");
+    }
+    catch( const SingularMatrixException& e )
+    { Output("Caught expected exception: ",e.what()); }
+    for( Int b=0; b<batchSize; ++b )
+    {
+        if( b == failure )
+            continue;
+        Matrix<F> LU_b( ALU[b] );
+        Permutation P_b;
+        LU( LU_b, P_b );
+        CheckDifference( ALUBatch[b], LU_b, "BatchedLU with a failure" );
+    }
+
+    vector<Matrix<F>> ASingular( ALU );
+    Zero( ASingular[failure] );
+    XBatch = X;
+    try
+    {
+        BatchedLinearSolve( ASingular, XBatch );
+        LogicError("BatchedLinearSolve did not detect a singular matrix");
+    }
+    catch( const SingularMatrixException& e )
+    { Output("Caught expected exception: ",e.what()); }
+    for( Int b=0; b<batchSize; ++b )
+        if( b != failure )
+            CheckResidual
+            ( ALU[b], XBatch[b], X[b], "BatchedLinearSolve with a failure" );
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int batchSize = Input("--batchSize","number of problems",100);
+        const Int n = Input("--n","size of each problem",16);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",4);
+        ProcessInput();
+        PrintInputReport();
+
+        // The batched routines are purely sequential (and threaded), so only
+        // the root is used
+        if( mpi::Rank(comm) == 0 )
+        {
+            // The second size exceeds the interleaving cutoff and exercises
+            // the unblocked fallback
+            for( const Int size : { n, 3*n } )
+            {
+                TestBatched<float>( batchSize, size, numRHS );
+                TestBatched<double>( batchSize, size, numRHS );
+                TestBatched<Complex<double>>( batchSize, size, numRHS );
+            }
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
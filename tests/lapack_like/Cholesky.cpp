@@ -139,7 +139,7 @@ void TestCholesky
   bool print,
   bool printDiag,
   bool correctness,
-  bool scalapack )
+  const CholeskyCtrl& ctrl )
 {
     OutputFromRoot(g.Comm(),"Testing distributed Cholesky with ",TypeName<F>());
     PushIndent();
@@ -154,7 +154,7 @@ void TestCholesky
     if( print )
         Print( A, "A" );
 
-    if( scalapack && !pivot )
+    if( ctrl.scalapack && !pivot )
         OutputFromRoot
         (g.Comm(),"ScaLAPACK Cholesky (including round-trip conversion)...");
     else
@@ -165,7 +165,7 @@ void TestCholesky
     if( pivot )
         Cholesky( uplo, A, p );
     else
-        Cholesky( uplo, A, scalapack );
+        Cholesky( uplo, A, ctrl );
     mpi::Barrier( g.Comm() );
     const double runTime = timer.Stop();
     const double realGFlops = 1./3.*Pow(double(m),3.)/(1.e9*runTime);
@@ -213,6 +213,7 @@ main( int argc, char* argv[] )
 #else
         const bool scalapack = false;
 #endif
+        const Int lookahead = Input("--lookahead","lookahead depth",1);
 #ifdef EL_HAVE_MPC
         const mpfr_prec_t prec = Input("--prec","MPFR precision",256);
 #endif
@@ -229,6 +230,9 @@ main( int argc, char* argv[] )
         const Grid g( comm, gridHeight, order );
         const UpperOrLower uplo = CharToUpperOrLower( uploChar );
         SetBlocksize( nb );
+        CholeskyCtrl ctrl;
+        ctrl.scalapack = scalapack;
+        ctrl.lookahead = lookahead;
 
         ComplainIfDebug();
 
@@ -272,49 +276,63 @@ main( int argc, char* argv[] )
 
         TestCholesky<float>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, ctrl );
         TestCholesky<Complex<float>>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, ctrl );
         TestCholesky<double>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, ctrl );
         TestCholesky<Complex<double>>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, ctrl );
+        if( !pivot && !scalapack )
+        {
+            // Also cover the factorization with(out) lookahead
+            CholeskyCtrl otherCtrl( ctrl );
+            otherCtrl.lookahead = ( lookahead > 0 ? 0 : 1 );
+            OutputFromRoot
+            (g.Comm(),"Testing with a lookahead of ",otherCtrl.lookahead);
+            TestCholesky<double>
+            ( g, uplo, pivot, m, nbLocal,
+              print, printDiag, correctness, otherCtrl );
+            TestCholesky<Complex<double>>
+            ( g, uplo, pivot, m, nbLocal,
+              print, printDiag, correctness, otherCtrl );
+        }
 
 #ifdef EL_HAVE_QD
         TestCholesky<DoubleDouble>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, ctrl );
         TestCholesky<QuadDouble>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, ctrl );
 
         TestCholesky<Complex<DoubleDouble>>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, ctrl );
         TestCholesky<Complex<QuadDouble>>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, ctrl );
 #endif
 
 #ifdef EL_HAVE_QUAD
         TestCholesky<Quad>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, ctrl );
         TestCholesky<Complex<Quad>>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, ctrl );
 #endif
 
 #ifdef EL_HAVE_MPC
         TestCholesky<BigFloat>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, ctrl );
         TestCholesky<Complex<BigFloat>>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, ctrl );
 #endif
     }
     catch( exception& e ) { ReportException(e); }
@@ -224,6 +224,7 @@ void TestSuite
     ctrl.tridiagEigCtrl.alg = ctrlDbl.tridiagEigCtrl.alg;
     ctrl.tridiagEigCtrl.subset = subset;
     ctrl.tridiagEigCtrl.progress = ctrlDbl.tridiagEigCtrl.progress;
+    ctrl.twoStageBandwidth = ctrlDbl.twoStageBandwidth;
 
     if( sequential && g.Rank() == 0 )
     {
@@ -253,6 +254,14 @@ void TestSuite
         OutputFromRoot(g.Comm(),"Nonstandard distributions:");
         TestHermitianEig<F,MR,MC,MC>
         ( m, uplo, onlyEigvals, clustered, correctness, print, g, ctrl );
+
+        if( ctrlDbl.twoStage )
+        {
+            OutputFromRoot(g.Comm(),"Two-stage tridiag algorithm:");
+            ctrl.twoStage = true;
+            TestHermitianEig<F>
+            ( m, uplo, onlyEigvals, clustered, correctness, print, g, ctrl );
+        }
     }
 
     PopIndent();
@@ -285,6 +294,10 @@ main( int argc, char* argv[] )
         const Int m = Input("--height","height of matrix",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
         const Int nbLocal = Input("--nbLocal","local blocksize",32);
+        const bool twoStage =
+          Input("--twoStage","test two-stage tridiagonalization?",true);
+        const Int bandwidth =
+          Input("--bandwidth","two-stage bandwidth (0 for nb)",0);
         const bool avoidTrmv =
           Input("--avoidTrmv","avoid Trmv based Symv",true);
         const bool useScaLAPACK =
@@ -344,6 +357,8 @@ main( int argc, char* argv[] )
         ctrl.tridiagEigCtrl.alg = alg;
         ctrl.tridiagEigCtrl.subset = subset;
         ctrl.tridiagEigCtrl.progress = progress;
+        ctrl.twoStage = twoStage;
+        ctrl.twoStageBandwidth = bandwidth;
 
         if( testReal )
         {
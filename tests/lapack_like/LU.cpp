@@ -28,6 +28,21 @@ void TestCorrectness
     Output("Testing error...");
     PushIndent();
 
+    if( pivoting == 1 || pivoting == 3 )
+    {
+        // Form L U - P A, where L is unit lower triangular
+        auto E( A );
+        MakeTrapezoidal( UPPER, E );
+        Trmm( LEFT, LOWER, NORMAL, UNIT, Field(1), A, E );
+        auto PA( AOrig );
+        P.PermuteRows( PA );
+        E -= PA;
+        const Real factError = FrobeniusNorm( E ) / FrobeniusNorm( AOrig );
+        Output("|| P A - L U ||_F / || A ||_F = ",factError);
+        if( factError > Sqrt(eps) )
+            LogicError("Factorization residual was unacceptably large");
+    }
+
     // Generate random right-hand sides
     Matrix<Field> X;
     Uniform( X, m, numRHS );
@@ -35,7 +50,7 @@ void TestCorrectness
     const Real oneNormY = OneNorm( Y );
     if( pivoting == 0 )
         lu::SolveAfter( NORMAL, A, Y );
-    else if( pivoting == 1 )
+    else if( pivoting == 1 || pivoting == 3 )
         lu::SolveAfter( NORMAL, A, P, Y );
     else
         lu::SolveAfter( NORMAL, A, P, Q, Y );
@@ -82,7 +97,7 @@ void TestCorrectness
     const Real oneNormY = OneNorm( Y );
     if( pivoting == 0 )
         lu::SolveAfter( NORMAL, A, Y );
-    else if( pivoting == 1 )
+    else if( pivoting == 1 || pivoting == 3 )
         lu::SolveAfter( NORMAL, A, P, Y );
     else
         lu::SolveAfter( NORMAL, A, P, Q, Y );
@@ -131,7 +146,7 @@ void TestLU
     timer.Start();
     if( pivoting == 0 )
         LU( A );
-    else if( pivoting == 1 )
+    else if( pivoting == 1 || pivoting == 3 )
         LU( A, P );
     else if( pivoting == 2 )
         LU( A, P, Q );
@@ -179,6 +194,7 @@ void TestLU
 ( const Grid& grid,
   Int m,
   Int pivoting,
+  Int lookahead,
   bool correctness,
   bool forceGrowth,
   bool print )
@@ -204,8 +220,14 @@ void TestLU
     timer.Start();
     if( pivoting == 0 )
         LU( A );
-    else if( pivoting == 1 )
-        LU( A, P );
+    else if( pivoting == 1 || pivoting == 3 )
+    {
+        LUCtrl ctrl;
+        if( pivoting == 3 )
+            ctrl.panelPivot = LU_PANEL_TOURNAMENT;
+        ctrl.lookahead = lookahead;
+        LU( A, P, ctrl );
+    }
     else if( pivoting == 2 )
         LU( A, P, Q );
     mpi::Barrier( grid.Comm() );
@@ -260,7 +282,11 @@ main( int argc, char* argv[] )
         const bool colMajor = Input("--colMajor","column-major ordering?",true);
         const Int m = Input("--height","height of matrix",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
-        const Int pivot = Input("--pivot","0: none, 1: partial, 2: full",1);
+        const Int pivot =
+          Input("--pivot","0: none, 1: partial, 2: full, 3: tournament",1);
+        const Int lookahead = Input("--lookahead","lookahead depth",1);
+        const bool tournament =
+          Input("--tournament","also test tournament pivoting?",true);
         const bool forceGrowth = Input
             ("--forceGrowth","force element growth?",false);
         const bool sequential = Input("--sequential","test sequential?",true);
@@ -272,7 +298,7 @@ main( int argc, char* argv[] )
 #endif
         ProcessInput();
         PrintInputReport();
-        if( pivot < 0 || pivot > 2 )
+        if( pivot < 0 || pivot > 3 )
             LogicError("Invalid pivot value");
 
 #ifdef EL_HAVE_MPC
@@ -291,6 +317,9 @@ main( int argc, char* argv[] )
             OutputFromRoot(grid.Comm(),"Testing LU with partial pivoting");
         else if( pivot == 2 )
             OutputFromRoot(grid.Comm(),"Testing LU with full pivoting");
+        else if( pivot == 3 )
+            OutputFromRoot
+            (grid.Comm(),"Testing LU with tournament pivoting");
 
         if( sequential && mpi::Rank() == 0 )
         {
@@ -332,39 +361,58 @@ main( int argc, char* argv[] )
         }
 
         TestLU<float>
-        ( grid, m, pivot, correctness, forceGrowth, print );
+        ( grid, m, pivot, lookahead, correctness, forceGrowth, print );
         TestLU<Complex<float>>
-        ( grid, m, pivot, correctness, forceGrowth, print );
+        ( grid, m, pivot, lookahead, correctness, forceGrowth, print );
 
         TestLU<double>
-        ( grid, m, pivot, correctness, forceGrowth, print );
+        ( grid, m, pivot, lookahead, correctness, forceGrowth, print );
         TestLU<Complex<double>>
-        ( grid, m, pivot, correctness, forceGrowth, print );
+        ( grid, m, pivot, lookahead, correctness, forceGrowth, print );
+        if( tournament && pivot != 3 )
+        {
+            OutputFromRoot(grid.Comm(),"Testing LU with tournament pivoting");
+            TestLU<double>
+            ( grid, m, 3, lookahead, correctness, forceGrowth, print );
+            TestLU<Complex<double>>
+            ( grid, m, 3, lookahead, correctness, forceGrowth, print );
+        }
+        if( pivot == 1 || pivot == 3 )
+        {
+            // Also cover the factorization with(out) lookahead
+            const Int otherLookahead = ( lookahead > 0 ? 0 : 1 );
+            OutputFromRoot
+            (grid.Comm(),"Testing LU with a lookahead of ",otherLookahead);
+            TestLU<double>
+            ( grid, m, pivot, otherLookahead, correctness, forceGrowth, print );
+            TestLU<Complex<double>>
+            ( grid, m, pivot, otherLookahead, correctness, forceGrowth, print );
+        }
 
 #ifdef EL_HAVE_QD
         TestLU<DoubleDouble>
-        ( grid, m, pivot, correctness, forceGrowth, print );
+        ( grid, m, pivot, lookahead, correctness, forceGrowth, print );
         TestLU<QuadDouble>
-        ( grid, m, pivot, correctness, forceGrowth, print );
+        ( grid, m, pivot, lookahead, correctness, forceGrowth, print );
 
         TestLU<Complex<DoubleDouble>>
-        ( grid, m, pivot, correctness, forceGrowth, print );
+        ( grid, m, pivot, lookahead, correctness, forceGrowth, print );
         TestLU<Complex<QuadDouble>>
-        ( grid, m, pivot, correctness, forceGrowth, print );
+        ( grid, m, pivot, lookahead, correctness, forceGrowth, print );
 #endif
 
 #ifdef EL_HAVE_QUAD
         TestLU<Quad>
-        ( grid, m, pivot, correctness, forceGrowth, print );
+        ( grid, m, pivot, lookahead, correctness, forceGrowth, print );
         TestLU<Complex<Quad>>
-        ( grid, m, pivot, correctness, forceGrowth, print );
+        ( grid, m, pivot, lookahead, correctness, forceGrowth, print );
 #endif
 
 #ifdef EL_HAVE_MPC
         TestLU<BigFloat>
-        ( grid, m, pivot, correctness, forceGrowth, print );
+        ( grid, m, pivot, lookahead, correctness, forceGrowth, print );
         TestLU<Complex<BigFloat>>
-        ( grid, m, pivot, correctness, forceGrowth, print );
+        ( grid, m, pivot, lookahead, correctness, forceGrowth, print );
 #endif
     }
     catch( exception& e ) { ReportException(e); }
@@ -0,0 +1,249 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename F,class MatrixType>
+void CheckResidual
+( mpi::Comm comm,
+  bool hpd,
+  const MatrixType& A,
+  const MatrixType& B,
+  const MatrixType& X )
+{
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    const Real eps = limits::Epsilon<Real>();
+
+    MatrixType R( B );
+    if( hpd )
+        Hemm( LEFT, LOWER, F(-1), A, X, F(1), R );
+    else
+        Gemm( NORMAL, NORMAL, F(-1), A, X, F(1), R );
+    const Real ANorm = InfinityNorm( A );
+    const Real XNorm = InfinityNorm( X );
+    const Real RNorm = InfinityNorm( R );
+    const Real relResid = RNorm / (eps*n*ANorm*XNorm);
+    OutputFromRoot
+    (comm,"|| B - A X ||_oo / (eps n || A ||_oo || X ||_oo) = ",relResid);
+    if( relResid > Real(1) )
+        LogicError("Relative residual was unacceptably large");
+}
+
+void CheckInfo
+( mpi::Comm comm,
+  const LinearSolveInfo& info,
+  bool expectFallback,
+  Int maxRefineIts )
+{
+    OutputFromRoot
+    (comm,(info.mixedPrecision?"mixed":"working")," precision after ",
+     info.numRefineIts," refinement steps",
+     (info.fellBack?" (fell back)":""));
+    if( info.fellBack != expectFallback )
+        LogicError
+        ("The solve ",(info.fellBack?"fell back":"did not fall back"),
+         " but was expected ",(expectFallback?"to":"not to"));
+    if( info.mixedPrecision == info.fellBack )
+        LogicError("The mixed-precision and fallback flags were inconsistent");
+    if( info.numRefineIts < 0 || info.numRefineIts > maxRefineIts )
+        LogicError("Took an invalid number of refinement steps");
+    if( info.mixedPrecision && info.numRefineIts == 0 )
+        LogicError("A low-precision solution was returned without refinement");
+}
+
+template<typename F>
+void TestSolve
+( const Grid& g,
+  bool hpd,
+  Int n,
+  Int numRHS,
+  Base<F> condition,
+  bool expectFallback,
+  const LinearSolveCtrl<Base<F>>& ctrl )
+{
+    OutputFromRoot
+    (g.Comm(),"Testing ",(hpd?"HPD":"linear")," solve with ",TypeName<F>(),
+     " and condition number ",condition);
+    PushIndent();
+
+    // Build a matrix with geometrically distributed singular values and the
+    // requested condition number
+    typedef Base<F> Real;
+    DistMatrix<F> A(g), B(g), X(g);
+    DistMatrix<F> U(g), V(g), UScaled(g);
+    DistMatrix<Real,STAR,STAR> s(g);
+    s.Resize( n, 1 );
+    for( Int i=0; i<n; ++i )
+        s.Set( i, 0, Pow(condition,-Real(i)/Real(Max(n-1,Int(1)))) );
+    Haar( U, n );
+    if( hpd )
+        V = U;
+    else
+        Haar( V, n );
+    UScaled = U;
+    DiagonalScale( RIGHT, NORMAL, s, UScaled );
+    Gemm( NORMAL, ADJOINT, F(1), UScaled, V, A );
+    Uniform( B, n, numRHS );
+
+    Timer timer;
+
+    OutputFromRoot(g.Comm(),"Working-precision factorization:");
+    PushIndent();
+    X = B;
+    mpi::Barrier( g.Comm() );
+    timer.Start();
+    if( hpd )
+        HPDSolve( LOWER, NORMAL, A, X );
+    else
+        LinearSolve( A, X );
+    mpi::Barrier( g.Comm() );
+    OutputFromRoot(g.Comm(),timer.Stop()," seconds");
+    CheckResidual<F>( g.Comm(), hpd, A, B, X );
+    PopIndent();
+
+    OutputFromRoot
+    (g.Comm(),"Mixed-precision factorization with ",
+     (ctrl.gmres?"GMRES-IR":"classical refinement"),":");
+    PushIndent();
+    X = B;
+    mpi::Barrier( g.Comm() );
+    timer.Start();
+    LinearSolveInfo info;
+    if( hpd )
+        info = HPDSolve( LOWER, NORMAL, A, X, ctrl );
+    else
+        info = LinearSolve( A, X, ctrl );
+    mpi::Barrier( g.Comm() );
+    OutputFromRoot(g.Comm(),timer.Stop()," seconds");
+    CheckInfo( g.Comm(), info, expectFallback, ctrl.maxRefineIts );
+    CheckResidual<F>( g.Comm(), hpd, A, B, X );
+    PopIndent();
+
+    OutputFromRoot(g.Comm(),"Sequential mixed-precision factorization:");
+    PushIndent();
+    DistMatrix<F,STAR,STAR> A_STAR_STAR( A ), B_STAR_STAR( B );
+    const Matrix<F>& ALoc = A_STAR_STAR.LockedMatrix();
+    const Matrix<F>& BLoc = B_STAR_STAR.LockedMatrix();
+    Matrix<F> XLoc( BLoc );
+    LinearSolveCtrl<Base<F>> seqCtrl( ctrl );
+    seqCtrl.progress = ctrl.progress && g.Rank() == 0;
+    if( hpd )
+        info = HPDSolve( LOWER, NORMAL, ALoc, XLoc, seqCtrl );
+    else
+        info = LinearSolve( ALoc, XLoc, seqCtrl );
+    CheckInfo( g.Comm(), info, expectFallback, ctrl.maxRefineIts );
+    CheckResidual<F>( g.Comm(), hpd, ALoc, BLoc, XLoc );
+    PopIndent();
+
+    PopIndent();
+}
+
+// The leading block [1, 1; 1, 1+2^-30] of an otherwise identity matrix is
+// nonsingular in double precision but rounds to an exactly singular block in
+// single precision, so that the low-precision LU must report a zero pivot
+template<typename F>
+void TestLowPrecisionSingular
+( const Grid& g,
+  Int n,
+  Int numRHS,
+  const LinearSolveCtrl<Base<F>>& ctrl )
+{
+    typedef Base<F> Real;
+    OutputFromRoot
+    (g.Comm(),"Testing linear solve with ",TypeName<F>(),
+     " and a matrix which is singular in single precision");
+    PushIndent();
+
+    DistMatrix<F> A(g), B(g), X(g);
+    Identity( A, n, n );
+    A.Set( 0, 1, F(1) );
+    A.Set( 1, 0, F(1) );
+    A.Set( 1, 1, F(1+Pow(Real(2),Real(-30))) );
+    Uniform( B, n, numRHS );
+
+    X = B;
+    LinearSolveInfo info = LinearSolve( A, X, ctrl );
+    CheckInfo( g.Comm(), info, true, ctrl.maxRefineIts );
+    CheckResidual<F>( g.Comm(), false, A, B, X );
+
+    DistMatrix<F,STAR,STAR> A_STAR_STAR( A ), B_STAR_STAR( B );
+    const Matrix<F>& ALoc = A_STAR_STAR.LockedMatrix();
+    const Matrix<F>& BLoc = B_STAR_STAR.LockedMatrix();
+    Matrix<F> XLoc( BLoc );
+    LinearSolveCtrl<Base<F>> seqCtrl( ctrl );
+    seqCtrl.progress = ctrl.progress && g.Rank() == 0;
+    info = LinearSolve( ALoc, XLoc, seqCtrl );
+    CheckInfo( g.Comm(), info, true, ctrl.maxRefineIts );
+    CheckResidual<F>( g.Comm(), false, ALoc, BLoc, XLoc );
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        Int gridHeight = Input("--gridHeight","process grid height",0);
+        const Int n = Input("--n","size of matrix",500);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",10);
+        const double condition =
+          Input("--condition","condition number of the matrix",1e3);
+        const double illCondition =
+          Input
+          ("--illCondition","condition number requiring a fallback",1e12);
+        const bool gmres = Input("--gmres","use GMRES-IR?",false);
+        const Int maxRefineIts =
+          Input("--maxRefineIts","max number of refinement its",30);
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const bool progress = Input("--progress","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( gridHeight == 0 )
+            gridHeight = Grid::DefaultHeight( mpi::Size(comm) );
+        const Grid g( comm, gridHeight );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        LinearSolveCtrl<double> ctrl;
+        ctrl.mixedPrecision = true;
+        ctrl.gmres = gmres;
+        ctrl.maxRefineIts = maxRefineIts;
+        ctrl.progress = progress;
+
+        TestSolve<double>( g, false, n, numRHS, condition, false, ctrl );
+        TestSolve<Complex<double>>
+        ( g, false, n, numRHS, condition, false, ctrl );
+        TestSolve<double>( g, true, n, numRHS, condition, false, ctrl );
+        TestSolve<Complex<double>>
+        ( g, true, n, numRHS, condition, false, ctrl );
+
+        // A single-precision factorization cannot make progress once the
+        // condition number greatly exceeds the inverse of its unit roundoff
+        LinearSolveCtrl<double> classicalCtrl( ctrl );
+        classicalCtrl.gmres = false;
+        TestSolve<double>
+        ( g, false, n, numRHS, illCondition, true, classicalCtrl );
+        TestSolve<double>
+        ( g, true, n, numRHS, illCondition, true, classicalCtrl );
+        if( n >= 2 )
+        {
+            TestLowPrecisionSingular<double>( g, n, numRHS, ctrl );
+            TestLowPrecisionSingular<Complex<double>>( g, n, numRHS, ctrl );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -169,6 +169,7 @@ void TestQR
 ( const Grid& grid,
   Int m,
   Int n,
+  bool tsqrPanels,
   bool correctness,
   bool print )
 {
@@ -189,7 +190,9 @@ void TestQR
     OutputFromRoot(grid.Comm(),"Starting QR factorization...");
     mpi::Barrier( grid.Comm() );
     const double startTime = mpi::Time();
-    QR( A, householderScalars, signature );
+    QRCtrl<Base<Field>> ctrl;
+    ctrl.panel = ( tsqrPanels ? QR_PANEL_TSQR : QR_PANEL_HOUSEHOLDER );
+    QR( A, householderScalars, signature, ctrl );
     mpi::Barrier( grid.Comm() );
     const double runTime = mpi::Time() - startTime;
     const double realGFlops = (2.*mD*nD*nD - 2./3.*nD*nD*nD)/(1.e9*runTime);
@@ -221,6 +224,8 @@ main( int argc, char* argv[] )
         const Int n = Input("--width","width of matrix",100);
         const Int nb = Input("--nb","algorithmic blocksize",64);
         const bool sequential = Input("--sequential","test sequential?",true);
+        const bool tsqrPanels =
+          Input("--tsqrPanels","also test distributed TSQR panels?",true);
         const bool correctness =
           Input("--correctness","test correctness?",true);
 #ifdef EL_HAVE_MPC
@@ -281,39 +286,55 @@ main( int argc, char* argv[] )
         }
 
         TestQR<float>
-        ( grid, m, n, correctness, print );
+        ( grid, m, n, false, correctness, print );
         TestQR<Complex<float>>
-        ( grid, m, n, correctness, print );
+        ( grid, m, n, false, correctness, print );
 
         TestQR<double>
-        ( grid, m, n, correctness, print );
+        ( grid, m, n, false, correctness, print );
         TestQR<Complex<double>>
-        ( grid, m, n, correctness, print );
+        ( grid, m, n, false, correctness, print );
+        if( tsqrPanels )
+        {
+            // The TSQR panels require a power-of-two number of process rows,
+            // each of which owns at least as many rows as there are columns
+            const int commSize = mpi::Size( comm );
+            const int tsqrGridHeight = commSize & -commSize;
+            const Grid tsqrGrid( comm, tsqrGridHeight, order );
+            const Int tsqrHeight = Max( m, tsqrGridHeight*n );
+            OutputFromRoot
+            (comm,"Testing TSQR panels with a ",tsqrHeight," x ",n,
+             " matrix on a ",tsqrGrid.Height()," x ",tsqrGrid.Width()," grid");
+            TestQR<double>
+            ( tsqrGrid, tsqrHeight, n, true, correctness, print );
+            TestQR<Complex<double>>
+            ( tsqrGrid, tsqrHeight, n, true, correctness, print );
+        }
 
 #ifdef EL_HAVE_QD
         TestQR<DoubleDouble>
-        ( grid, m, n, correctness, print );
+        ( grid, m, n, false, correctness, print );
         TestQR<QuadDouble>
-        ( grid, m, n, correctness, print );
+        ( grid, m, n, false, correctness, print );
 
         TestQR<Complex<DoubleDouble>>
-        ( grid, m, n, correctness, print );
+        ( grid, m, n, false, correctness, print );
         TestQR<Complex<QuadDouble>>
-        ( grid, m, n, correctness, print );
+        ( grid, m, n, false, correctness, print );
 #endif
 
 #ifdef EL_HAVE_QUAD
         TestQR<Quad>
-        ( grid, m, n, correctness, print );
+        ( grid, m, n, false, correctness, print );
         TestQR<Complex<Quad>>
-        ( grid, m, n, correctness, print );
+        ( grid, m, n, false, correctness, print );
 #endif
 
 #ifdef EL_HAVE_MPC
         TestQR<BigFloat>
-        ( grid, m, n, correctness, print );
+        ( grid, m, n, false, correctness, print );
         TestQR<Complex<BigFloat>>
-        ( grid, m, n, correctness, print );
+        ( grid, m, n, false, correctness, print );
 #endif
     }
     catch( exception& e ) { ReportException(e); }
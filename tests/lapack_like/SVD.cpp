@@ -163,6 +163,8 @@ void TestDistributedSVD
   bool time,
   bool progress,
   bool scalapack,
+  bool twoStage,
+  Int bandwidth,
   bool wantU,
   bool wantV,
   bool useQR,
@@ -203,6 +205,8 @@ void TestDistributedSVD
 
     ctrl.time = time;
     ctrl.useScaLAPACK = scalapack;
+    ctrl.twoStage = twoStage;
+    ctrl.twoStageBandwidth = bandwidth;
     mpi::Barrier( mpi::COMM_WORLD );
     if( commRank == 0 )
         timer.Start();
@@ -330,6 +334,39 @@ void TestDistributedSVD
         Output("");
 }
 
+// The two-stage reduction must handle matrices with no rows or columns
+template<typename F>
+void TestEmptyTwoStageSVD()
+{
+    typedef Base<F> Real;
+    Grid grid( mpi::COMM_WORLD );
+    SVDCtrl<Real> ctrl;
+    ctrl.twoStage = true;
+    const vector<pair<Int,Int>> dimensions = { {0,0}, {5,0}, {0,5} };
+    for( const auto& dims : dimensions )
+    {
+        const Int m = dims.first;
+        const Int n = dims.second;
+        DistMatrix<F> A(grid), U(grid), V(grid);
+        DistMatrix<Real,STAR,STAR> s(grid);
+
+        Zeros( A, m, n );
+        SVD( A, s, ctrl );
+        if( s.Height() != 0 )
+            LogicError("Singular values of a ",m," x ",n," matrix were found");
+
+        Zeros( A, m, n );
+        SVD( A, U, s, V, ctrl );
+        if( s.Height() != 0 || U.Height() != m || U.Width() != 0 ||
+            V.Height() != n || V.Width() != 0 )
+            LogicError
+            ("SVD of a ",m," x ",n," matrix returned a ",U.Height()," x ",
+             U.Width()," U and a ",V.Height()," x ",V.Width()," V");
+    }
+    if( mpi::Rank() == 0 )
+        Output("Empty two-stage SVDs passed");
+}
+
 template<typename F>
 void TestSVD
 ( Int m, Int n, Int rank,
@@ -339,6 +376,8 @@ void TestSVD
   bool time,
   bool progress,
   bool scalapack,
+  bool twoStage,
+  Int bandwidth,
   bool testSeq,
   bool testDist,
   bool wantU,
@@ -359,7 +398,18 @@ void TestSVD
     {
         TestDistributedSVD<F> 
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
+          false, bandwidth,
           wantU, wantV, useQR, penalizeDerivative, divideCutoff, print );
+        if( twoStage )
+        {
+            if( commRank == 0 )
+                Output("Two-stage bidiagonalization:");
+            TestDistributedSVD<F> 
+            ( m, n, rank, approach, tolType, tol, time, progress, false,
+              true, bandwidth,
+              wantU, wantV, useQR, penalizeDerivative, divideCutoff, print );
+            TestEmptyTwoStageSVD<F>();
+        }
     }
 }
 
@@ -384,6 +434,10 @@ main( int argc, char* argv[] )
         const Int mb = 32;
         const Int nb = 32;
 #endif
+        const bool twoStage =
+          Input("--twoStage","test two-stage bidiagonalization?",true);
+        const Int bandwidth =
+          Input("--bandwidth","two-stage bandwidth (0 for blocksize)",0);
         const bool time = Input("--time","time SVD components?",true);
         const bool progress = Input("--progress","print progress?",false);
         const Int tolTypeInt = Input("--tolTypeInt","tolerance type int",1);
@@ -421,38 +475,46 @@ main( int argc, char* argv[] )
 
         TestSVD<float>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
+          twoStage, bandwidth,
           testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
           divideCutoff, print );
         TestSVD<Complex<float>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
+          twoStage, bandwidth,
           testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
           divideCutoff, print );
 
         TestSVD<double>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
+          twoStage, bandwidth,
           testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
           divideCutoff, print );
         TestSVD<Complex<double>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
+          twoStage, bandwidth,
           testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
           divideCutoff, print );
 
 #ifdef EL_HAVE_QD
         TestSVD<DoubleDouble>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
+          twoStage, bandwidth,
           testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
           divideCutoff, print );
         TestSVD<Complex<DoubleDouble>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
+          twoStage, bandwidth,
           testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
           divideCutoff, print );
 
         TestSVD<QuadDouble>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
+          twoStage, bandwidth,
           testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
           divideCutoff, print );
         TestSVD<Complex<QuadDouble>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
+          twoStage, bandwidth,
           testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
           divideCutoff, print );
 #endif
@@ -460,10 +522,12 @@ main( int argc, char* argv[] )
 #ifdef EL_HAVE_QUAD
         TestSVD<Quad>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
+          twoStage, bandwidth,
           testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
           divideCutoff, print );
         TestSVD<Complex<Quad>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
+          twoStage, bandwidth,
           testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
           divideCutoff, print );
 #endif
@@ -471,10 +535,12 @@ main( int argc, char* argv[] )
 #ifdef EL_HAVE_MPC
         TestSVD<BigFloat>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
+          twoStage, bandwidth,
           testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
           divideCutoff, print );
         TestSVD<Complex<BigFloat>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
+          twoStage, bandwidth,
           testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
           divideCutoff, print );
 #endif
@@ -0,0 +1,273 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Each variant of the sequential sparse-direct solver is compared against a
+// reference solve using the default (serial, in-core) factorization of the
+// same matrix
+
+template<typename Field>
+void CheckDifference
+( const Matrix<Field>& X, const Matrix<Field>& XRef, const string& label )
+{
+    typedef Base<Field> Real;
+    Matrix<Field> E( X );
+    E -= XRef;
+    const Real relDiff = MaxNorm( E ) / MaxNorm( XRef );
+    const Real tol = Sqrt( limits::Epsilon<Real>() );
+    Output(label,": || X - XRef ||_max / || XRef ||_max = ",relDiff);
+    if( !(relDiff <= tol) )
+        LogicError(label," differed from the reference solution");
+}
+
+template<typename Field>
+void ReferenceSolve
+( const SparseMatrix<Field>& A,
+  Int n1, Int n2, Int n3,
+  const BisectCtrl& ctrl,
+  const Matrix<Field>& B,
+        Matrix<Field>& X )
+{
+    SparseLDLFactorization<Field> sparseLDLFact;
+    sparseLDLFact.Initialize3DGridGraph( n1, n2, n3, A, true, ctrl );
+    ldl::TraversalCtrl traversalCtrl;
+    traversalCtrl.parallel = false;
+    sparseLDLFact.Factor( LDL_2D, traversalCtrl );
+    X = B;
+    sparseLDLFact.Solve( X );
+}
+
+template<typename Field>
+void TestTraversal
+( const SparseMatrix<Field>& A,
+  Int n1, Int n2, Int n3,
+  const BisectCtrl& ctrl,
+  const Matrix<Field>& B,
+  const Matrix<Field>& XRef )
+{
+    // A budget far smaller than any subtree forces the concurrent traversal
+    // to wait for running subtrees to finish before starting new ones
+    for( const double maxWorkspaceBytes : { 0., 1. } )
+    {
+        ldl::TraversalCtrl traversalCtrl;
+        traversalCtrl.parallel = true;
+        traversalCtrl.subtreesPerThread = 8;
+        traversalCtrl.maxWorkspaceBytes = maxWorkspaceBytes;
+
+        SparseLDLFactorization<Field> sparseLDLFact;
+        sparseLDLFact.Initialize3DGridGraph( n1, n2, n3, A, true, ctrl );
+        sparseLDLFact.Factor( LDL_2D, traversalCtrl );
+        Matrix<Field> X( B );
+        sparseLDLFact.Solve( X );
+        CheckDifference
+        ( X, XRef,
+          BuildString
+          ("Parallel traversal with a budget of ",maxWorkspaceBytes,
+           " bytes") );
+    }
+}
+
+Int NumFronts( const ldl::NodeInfo& info )
+{
+    Int numFronts = 1;
+    for( const auto& child : info.children )
+        numFronts += NumFronts( *child );
+    return numFronts;
+}
+
+template<typename Field>
+void TestAmalgamation
+( const SparseMatrix<Field>& A,
+  Int n1, Int n2, Int n3,
+  const BisectCtrl& ctrl,
+  const Matrix<Field>& B,
+  const Matrix<Field>& XRef )
+{
+    BisectCtrl amalgamateCtrl( ctrl );
+    amalgamateCtrl.amalgamate = true;
+
+    // Check the statistics against the tree before and after amalgamation
+    vector<Int> map;
+    ldl::Separator sep;
+    ldl::NodeInfo info;
+    ldl::NaturalNestedDissection
+    ( n1, n2, n3, A.LockedGraph(), map, sep, info, ctrl.cutoff );
+    const Int numFrontsBefore = NumFronts( info );
+    const auto amalgamationInfo = ldl::Amalgamate( sep, info, amalgamateCtrl );
+    const Int numFrontsAfter = NumFronts( info );
+    Output
+    (amalgamationInfo.numMerges," merges: ",numFrontsBefore," -> ",
+     numFrontsAfter," fronts, ",amalgamationInfo.entriesBefore," -> ",
+     amalgamationInfo.entriesAfter," entries, and ",
+     amalgamationInfo.flopsBefore," -> ",amalgamationInfo.flopsAfter,
+     " flops");
+    if( amalgamationInfo.numMerges <= 0 )
+        LogicError("No fronts were amalgamated");
+    if( numFrontsBefore-numFrontsAfter != amalgamationInfo.numMerges )
+        LogicError("The number of merges did not match the tree");
+    // The growth in the number of entries is due to the explicit zeros
+    const double explicitZeros =
+      amalgamationInfo.entriesAfter - amalgamationInfo.entriesBefore;
+    if( explicitZeros < 0 ||
+        explicitZeros >
+        amalgamateCtrl.maxAmalgamationFill*amalgamationInfo.entriesAfter )
+        LogicError("The amalgamated fronts exceeded the allowed fill");
+    if( info.off+info.size != A.Height() )
+        LogicError("The amalgamated root did not end the reordering");
+
+    // Check the factorization of the amalgamated tree
+    SparseLDLFactorization<Field> sparseLDLFact;
+    sparseLDLFact.Initialize3DGridGraph
+    ( n1, n2, n3, A, true, amalgamateCtrl );
+    if( NumFronts(sparseLDLFact.NodeInfo()) != numFrontsAfter )
+        LogicError("The factorization was not amalgamated");
+    sparseLDLFact.Factor();
+    Matrix<Field> X( B );
+    sparseLDLFact.Solve( X );
+    CheckDifference( X, XRef, "Amalgamated factorization" );
+}
+
+template<typename Field>
+void TestOutOfCore
+( const SparseMatrix<Field>& A,
+  Int n1, Int n2, Int n3,
+  const BisectCtrl& ctrl,
+  const string& scratchDirectory,
+  const Matrix<Field>& B,
+  const Matrix<Field>& XRef )
+{
+    SparseLDLFactorization<Field> sparseLDLFact;
+    sparseLDLFact.EnableOutOfCore( scratchDirectory );
+    sparseLDLFact.Initialize3DGridGraph( n1, n2, n3, A, true, ctrl );
+
+    // Backing the dense factors with the scratch file should lower the
+    // estimated peak memory
+    const double inCorePeak = sparseLDLFact.PeakFactorMemory( false );
+    const double outOfCorePeak = sparseLDLFact.PeakFactorMemory( true );
+    Output
+    ("Peak factorization memory: ",inCorePeak," bytes in core and ",
+     outOfCorePeak," bytes out of core");
+    if( !(outOfCorePeak > 0) || !(outOfCorePeak < inCorePeak) )
+        LogicError("The out-of-core peak memory was not below the in-core");
+
+    sparseLDLFact.Factor();
+    Matrix<Field> X( B );
+    sparseLDLFact.Solve( X );
+    CheckDifference( X, XRef, "Out-of-core factorization" );
+
+    // The fronts are read back from the scratch file by a second solve
+    X = B;
+    sparseLDLFact.Solve( X );
+    CheckDifference( X, XRef, "Repeated out-of-core solve" );
+}
+
+// Add 'shift' to the diagonal entries of the given (original) indices
+template<typename Field>
+void ShiftDiagonal
+( SparseMatrix<Field>& A, const vector<Int>& inds, Base<Field> shift )
+{
+    for( const Int i : inds )
+        A.QueueUpdate( i, i, Field(shift) );
+    A.ProcessQueues();
+}
+
+template<typename Field>
+void TestRefactor
+( const SparseMatrix<Field>& A,
+  Int n1, Int n2, Int n3,
+  const BisectCtrl& ctrl,
+  const Matrix<Field>& B )
+{
+    const Int n = A.Height();
+    SparseLDLFactorization<Field> sparseLDLFact;
+    sparseLDLFact.Initialize3DGridGraph( n1, n2, n3, A, true, ctrl );
+    sparseLDLFact.Factor();
+
+    // Each refactorization is compared against a fresh factorization
+    SparseMatrix<Field> ANew( A );
+    auto refactorAndCheck =
+      [&]( const vector<Int>& changedInds, const string& label )
+      {
+          sparseLDLFact.Refactor( ANew, changedInds );
+          Matrix<Field> X( B );
+          sparseLDLFact.Solve( X );
+
+          Matrix<Field> XRef;
+          ReferenceSolve( ANew, n1, n2, n3, ctrl, B, XRef );
+          CheckDifference( X, XRef, label );
+      };
+
+    // The first refactorization must rebuild the updates of the unchanged
+    // subtrees, whereas the repeated one reuses them
+    const vector<Int> firstInds = { 0, 1, n1 };
+    ShiftDiagonal( ANew, firstInds, Base<Field>(1) );
+    refactorAndCheck( firstInds, "Refactorization" );
+    ShiftDiagonal( ANew, firstInds, Base<Field>(2) );
+    refactorAndCheck( firstInds, "Repeated refactorization" );
+
+    // A different set of indices is changed in an opposite corner (and in
+    // the middle of the grid, which typically lies within the root)
+    const vector<Int> secondInds = { n/2, n-n1-1, n-1 };
+    ShiftDiagonal( ANew, secondInds, Base<Field>(3) );
+    refactorAndCheck( secondInds, "Refactorization of different indices" );
+}
+
+template<typename Field>
+void TestSequentialSparseLDL
+( Int n1, Int n2, Int n3, Int numRHS,
+  const BisectCtrl& ctrl,
+  const string& scratchDirectory )
+{
+    Output("Testing with ",TypeName<Field>());
+    PushIndent();
+
+    SparseMatrix<Field> A;
+    Laplacian( A, n1, n2, n3 );
+    A *= -1;
+    Matrix<Field> B, XRef;
+    Uniform( B, n1*n2*n3, numRHS );
+    ReferenceSolve( A, n1, n2, n3, ctrl, B, XRef );
+
+    TestTraversal( A, n1, n2, n3, ctrl, B, XRef );
+    TestAmalgamation( A, n1, n2, n3, ctrl, B, XRef );
+    TestOutOfCore( A, n1, n2, n3, ctrl, scratchDirectory, B, XRef );
+    TestRefactor( A, n1, n2, n3, ctrl, B );
+
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int n1 = Input("--n1","first grid dimension",20);
+        const Int n2 = Input("--n2","second grid dimension",15);
+        const Int n3 = Input("--n3","third grid dimension",10);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",5);
+        const Int cutoff = Input("--cutoff","cutoff for nested dissection",32);
+        const string scratchDirectory =
+          Input("--scratch","scratch directory for the fronts",string("."));
+        ProcessInput();
+        PrintInputReport();
+
+        BisectCtrl ctrl;
+        ctrl.cutoff = cutoff;
+
+        TestSequentialSparseLDL<double>
+        ( n1, n2, n3, numRHS, ctrl, scratchDirectory );
+        TestSequentialSparseLDL<Complex<double>>
+        ( n1, n2, n3, numRHS, ctrl, scratchDirectory );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
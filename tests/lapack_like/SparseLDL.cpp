@@ -236,6 +236,10 @@ int main( int argc, char* argv[] )
         const Int nbFact = Input("--nbFact","factorization blocksize",96);
         const Int nbSolve = Input("--nbSolve","solve blocksize",96);
         const Int cutoff = Input("--cutoff","cutoff for nested dissection",128);
+        const bool amalgamate =
+          Input("--amalgamate","relaxed amalgamation of fronts?",false);
+        const double maxAmalgamationFill =
+          Input("--maxFill","max. fraction of explicit zeros in a front",0.1);
         const bool unpack = Input("--unpack","unpack frontal matrix?",true);
         const bool print = Input("--print","print matrix?",false);
         const bool display = Input("--display","display matrix?",false);
@@ -249,6 +253,9 @@ int main( int argc, char* argv[] )
         ctrl.numSeqSeps = numSeqSeps;
         ctrl.numDistSeps = numDistSeps;
         ctrl.cutoff = cutoff;
+        ctrl.amalgamate = amalgamate;
+        ctrl.maxAmalgamationFill = maxAmalgamationFill;
+        ctrl.printAmalgamation = amalgamate;
         const El::Grid grid(comm);
 
         // TODO(poulson): Call complex variants as well